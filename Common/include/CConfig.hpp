@@ -531,6 +531,8 @@ private:
   Kind_CHT_Coupling;            /*!< \brief Kind of coupling method used at CHT interfaces. */
   bool ReconstructionGradientRequired; /*!< \brief Enable or disable a second gradient calculation for upwind reconstruction only. */
   bool LeastSquaresRequired;    /*!< \brief Enable or disable memory allocation for least-squares gradient methods. */
+  bool LeastSquares_Cache;      /*!< \brief Precompute the geometric weights of the least-squares gradients. */
+  bool Fused_Reconstruction;    /*!< \brief Compute gradients, limiters, and MUSCL reconstructed states in one pass. */
   bool Energy_Equation;         /*!< \brief Solve the energy equation for incompressible flows. */
 
   bool MUSCL,              /*!< \brief MUSCL scheme .*/
@@ -575,7 +577,13 @@ private:
   unsigned long Linear_Solver_Iter_FSI_Struc;    /*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
+  bool Linear_Solver_Prec_Level_Scheduling;      /*!< \brief Use level scheduling to thread-parallelize ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool NewtonKrylov;                             /*!< \brief Use matrix-free Newton-Krylov (JFNK) for the flow equations. */
+  unsigned long NewtonKrylov_Startup_Iter;       /*!< \brief Iterations with the assembled Jacobian before switching to JFNK. */
+  su2double NewtonKrylov_FD_Step;                /*!< \brief Relative step of the finite differences of the Jacobian-vector products. */
+  bool MatrixFree_Elasticity;                    /*!< \brief Apply the linear elasticity operator element by element instead of assembling it. */
+  unsigned short MatrixFree_Chebyshev_Degree;    /*!< \brief Degree of the Chebyshev preconditioner of the matrix-free elasticity operator (0 for Jacobi). */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_AdjFlow;  /*!< \brief Relaxation coefficient of the linear solver adjoint mean flow. */
@@ -726,6 +734,7 @@ private:
   unsigned short Analytical_Surface;  /*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format (SU2 or SU2_BINARY). */
   unsigned short Tab_FileFormat;      /*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
   unsigned long StartWindowIteration; /*!< \brief Starting Iteration for long time Windowing apporach . */
@@ -991,6 +1000,9 @@ private:
   unsigned short Kind_RadialBasisFunction;   /*!< \brief type of radial basis function to use for radial basis FSI. */
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter. */
+  bool RadialBasisFunction_Sparse;           /*!< \brief Compute the RBF weights with the centers near each target (compact basis functions). */
+  unsigned short RadialBasisFunction_SparseLayers; /*!< \brief Layers of centers beyond the support of the targets in the sparse RBF. */
+  su2double RadialBasisFunction_ReductionTol; /*!< \brief Tolerance of the greedy selection of RBF centers, relative to the radius (0 to use all donors). */
   bool Prestretch;                           /*!< \brief Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;             /*!< \brief File name for reference geometry. */
   string FEA_FileName;              /*!< \brief File name for element-based properties. */
@@ -1087,7 +1099,9 @@ private:
   default_body_force[3],         /*!< \brief Default body force vector for the COption class. */
   default_nacelle_location[5],   /*!< \brief Location of the nacelle. */
   default_hs_axes[3],            /*!< \brief Default principal axes (x, y, z) of the ellipsoid containing the heat source. */
-  default_hs_center[3];          /*!< \brief Default position of the center of the heat source. */
+  default_hs_center[3],          /*!< \brief Default position of the center of the heat source. */
+  default_mesh_box_length[3],    /*!< \brief Default length of the RECTANGLE and BOX grids for the COption class. */
+  default_mesh_box_offset[3];    /*!< \brief Default offset of the RECTANGLE and BOX grids for the COption class. */
 
   unsigned short Riemann_Solver_FEM;         /*!< \brief Riemann solver chosen for the DG method. */
   su2double Quadrature_Factor_Straight;      /*!< \brief Factor applied during quadrature of elements with a constant Jacobian. */
@@ -1118,6 +1132,10 @@ private:
   unsigned long VolumeWrtFreq;        /*!< \brief Writing frequency for solution files. */
   unsigned short* VolumeOutputFiles;  /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles;  /*!< \brief Number of File formats to output */
+  bool Async_Output;                  /*!< \brief Write the volume and restart files in a background thread. */
+  bool Restart_Compression;           /*!< \brief Compress the blocks of the binary restart files. */
+  string *Restart_SinglePrecision;    /*!< \brief Fields (or groups of fields) stored in single precision in binary restart files. */
+  unsigned short nRestart_SinglePrecision; /*!< \brief Number of entries in Restart_SinglePrecision. */
 
   bool Multizone_Mesh;            /*!< \brief Determines if the mesh contains multiple zones. */
   bool SinglezoneDriver;          /*!< \brief Determines if the single-zone driver is used. (TEMPORARY) */
@@ -1144,6 +1162,11 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool Edge_Batching;               /*!< \brief Compute the upwind fluxes of groups of edges with the vectorized kernels. */
+  unsigned short Kind_Point_Ordering; /*!< \brief Renumbering of the points applied during preprocessing. */
+  unsigned short Kind_Edge_Ordering;  /*!< \brief Numbering of the edges of the dual grid. */
+  bool Distributed_WallDistance;      /*!< \brief Compute the wall distance without gathering the walls on all ranks. */
+  bool Incremental_WallDistance;      /*!< \brief Update the wall distance after the grid moves, starting from the previous nearest elements. */
 
   unsigned short Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   unsigned short Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -3901,6 +3924,18 @@ public:
    */
   bool GetLeastSquaresRequired(void) const { return LeastSquaresRequired; }
 
+  /*!
+   * \brief Get whether the geometric weights of the least-squares gradients are precomputed and cached.
+   * \return <code>TRUE</code> means that each gradient is a single sweep over the point neighbors.
+   */
+  bool GetLeastSquares_Cache(void) const { return LeastSquares_Cache; }
+
+  /*!
+   * \brief Get whether the gradients, limiters, and MUSCL reconstructed states of the flow are computed in one pass.
+   * \return <code>TRUE</code> means that the edge loops use the states computed with the limiters.
+   */
+  bool GetFused_Reconstruction(void) const { return Fused_Reconstruction; }
+
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -3974,6 +4009,36 @@ public:
    */
   su2double GetLinear_Solver_Smoother_Relaxation(void) const { return Linear_Solver_Smoother_Relaxation; }
 
+  /*!
+   * \brief Check if the flow equations are solved with matrix-free Newton-Krylov (JFNK).
+   * \return <code>TRUE</code> if the Jacobian-vector products are approximated by finite differences of the residual.
+   */
+  bool GetNewtonKrylov(void) const { return NewtonKrylov; }
+
+  /*!
+   * \brief Get the number of iterations with the assembled Jacobian before switching to Newton-Krylov.
+   * \return Number of startup iterations.
+   */
+  unsigned long GetNewtonKrylov_Startup_Iter(void) const { return NewtonKrylov_Startup_Iter; }
+
+  /*!
+   * \brief Get the relative step of the finite differences used by the matrix-free Newton-Krylov method.
+   * \return Finite difference step.
+   */
+  su2double GetNewtonKrylov_FD_Step(void) const { return NewtonKrylov_FD_Step; }
+
+  /*!
+   * \brief Check if the linear elasticity operator (FEA and mesh deformation) is applied element by element.
+   * \return <code>TRUE</code> if the stiffness matrix is not assembled.
+   */
+  bool GetMatrixFree_Elasticity(void) const { return MatrixFree_Elasticity; }
+
+  /*!
+   * \brief Get the degree of the Chebyshev polynomial preconditioner of the matrix-free elasticity operator.
+   * \return Degree of the polynomial, 0 for block Jacobi.
+   */
+  unsigned short GetMatrixFree_Chebyshev_Degree(void) const { return MatrixFree_Chebyshev_Degree; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -5293,6 +5358,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid (SU2 or SU2_BINARY).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -8787,6 +8858,21 @@ public:
    */
   su2double GetRadialBasisFunctionParameter(void) const { return RadialBasisFunction_Parameter; }
 
+  /*!
+   * \brief Get whether the radial basis function interpolation weights are computed with the centers near each target.
+   */
+  bool GetRadialBasisFunctionSparse(void) const { return RadialBasisFunction_Sparse; }
+
+  /*!
+   * \brief Get the number of layers of centers beyond the support of the targets in the sparse RBF interpolation.
+   */
+  unsigned short GetRadialBasisFunctionSparseLayers(void) const { return RadialBasisFunction_SparseLayers; }
+
+  /*!
+   * \brief Get the tolerance of the greedy reduction of radial basis function centers (relative to the radius).
+   */
+  su2double GetRadialBasisFunctionReductionTol(void) const { return RadialBasisFunction_ReductionTol; }
+
   /*!
    * \brief Get the kind of inlet face interpolation function to use.
    */
@@ -9301,6 +9387,27 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Get whether the volume and restart files are written in a background thread.
+   * \return <code>TRUE</code> means that the solver continues while the files are written.
+   */
+  bool GetAsync_Output() const { return Async_Output; }
+
+  /*!
+   * \brief Get whether the blocks of the binary restart files are compressed.
+   */
+  bool GetRestart_Compression() const { return Restart_Compression; }
+
+  /*!
+   * \brief Get the number of fields (or groups) stored in single precision in binary restart files.
+   */
+  unsigned short GetnRestart_SinglePrecision() const { return nRestart_SinglePrecision; }
+
+  /*!
+   * \brief Get the name of the iField-th field (or group) stored in single precision in binary restart files.
+   */
+  string GetRestart_SinglePrecision(unsigned short iField) const { return Restart_SinglePrecision[iField]; }
+
   /*!
    * \brief Get the desired factorization frequency for PaStiX
    * \return Number of calls to 'Build' that trigger re-factorization.
@@ -9338,9 +9445,40 @@ public:
    */
   unsigned long GetLinear_Solver_Prec_Threads(void) const { return Linear_Solver_Prec_Threads; }
 
+  /*!
+   * \brief Get if ILU and LU_SGS are thread-parallelized with level scheduling instead of partitioning.
+   * \return <code>TRUE</code> if the result of the preconditioners does not depend on the number of threads.
+   */
+  bool GetLinear_Solver_Prec_Level_Scheduling(void) const { return Linear_Solver_Prec_Level_Scheduling; }
+
   /*!
    * \brief Get the size of the edge groups colored for OpenMP parallelization of edge loops.
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Get if the upwind fluxes are computed in batches of edges by the vectorized kernels (when supported).
+   */
+  bool GetEdge_Batching(void) const { return Edge_Batching; }
+
+  /*!
+   * \brief Get the kind of renumbering applied to the points (RCM or space filling curves).
+   */
+  unsigned short GetKind_Point_Ordering(void) const { return Kind_Point_Ordering; }
+
+  /*!
+   * \brief Get the kind of numbering of the edges (natural, sorted, or contiguous colors).
+   */
+  unsigned short GetKind_Edge_Ordering(void) const { return Kind_Edge_Ordering; }
+
+  /*!
+   * \brief Get if the wall distance is computed with the walls distributed over the ranks.
+   */
+  bool GetDistributed_WallDistance(void) const { return Distributed_WallDistance; }
+
+  /*!
+   * \brief Get if the wall distance is updated incrementally when the grid moves.
+   */
+  bool GetIncremental_WallDistance(void) const { return Incremental_WallDistance; }
+
 };
@@ -35,6 +35,7 @@
 #include <cmath>
 #include <vector>
 #include <algorithm>
+#include <limits>
 
 #include "./mpi_structure.hpp"
 #include "./option_structure.hpp"
@@ -207,8 +208,8 @@ protected:
 
   vector<CADTNodeClass> leaves; /*!< \brief Vector, which contains all the leaves of the ADT. */
 
-  vector<unsigned long> frontLeaves;    /*!< \brief Vector used in the tree traversal. */
-  vector<unsigned long> frontLeavesNew; /*!< \brief Vector used in the tree traversal. */
+  vector<vector<unsigned long> > FrontLeaves;    /*!< \brief Vectors used in the tree traversal, one per thread. */
+  vector<vector<unsigned long> > FrontLeavesNew; /*!< \brief Vectors used in the tree traversal, one per thread. */
 
 private:
   vector<su2double> coorMinLeaves; /*!< \brief Vector, which contains all the minimum coordinates
@@ -235,6 +236,12 @@ protected:
   void BuildADT(unsigned short  nDim,
                 unsigned long   nPoints,
                 const su2double *coor);
+
+  /*!
+   * \brief Function, which allocates the work vectors of the tree traversal,
+            one set per thread such that the searches are thread safe.
+   */
+  void AllocateSearchVectors(void);
 public:
   /*!
    * \brief Function, which returns whether or not the ADT is empty.
@@ -347,9 +354,9 @@ private:
   vector<int>           ranksOfElems;  /*!< \brief Vector, which contains the ranks
                                                     of the elements in the ADT. */
 
-  vector<CBBoxTargetClass> BBoxTargets; /*!< \brief Vector, used to store possible bounding
-                                                    box candidates during the nearest element
-                                                    search. */
+  vector<vector<CBBoxTargetClass> > BBoxTargets; /*!< \brief Vectors, one per thread, used to store
+                                                             possible bounding box candidates during
+                                                             the nearest element search. */
 public:
   /*!
    * \brief Constructor of the class.
@@ -411,8 +418,66 @@ public:
                                unsigned short  &markerID,
                                unsigned long   &elemID,
                                int             &rankID);
+
+  /*!
+   * \brief Function, which determines the nearest element in the ADT for the
+            given coordinate, ignoring a given set of elements.
+   * \param[in]     coor          Coordinate for which the nearest element in the ADT must be determined.
+   * \param[in]     excludedElems Indices in the ADT of the elements that must be ignored.
+   * \param[in]     nExcluded     Number of elements in excludedElems.
+   * \param[in,out] dist          On input an upper bound of the distance, on output the
+                                  distance to the nearest element if one has been found.
+   * \param[out]    elemADT       Index in the ADT of the nearest element, if one has been found.
+   * \return                      True if an element is found within the upper bound, false if not.
+   */
+  bool DetermineNearestElement(const su2double     *coor,
+                               const unsigned long *excludedElems,
+                               const unsigned long nExcluded,
+                               su2double           &dist,
+                               unsigned long       &elemADT);
+
+  /*!
+   * \brief Function, which computes the distance of the given coordinate to an element of the ADT.
+   * \param[in] elemADT Index in the ADT of the element.
+   * \param[in] coor    Coordinate for which the distance must be determined.
+   * \return            Distance from the coordinate to the element.
+   */
+  su2double DistanceToElement(const unsigned long elemADT,
+                              const su2double     *coor);
+
+  /*!
+   * \brief Function, which determines for every element of the ADT the elements
+            that share at least one point with it, including the element itself.
+   * \param[out] patchStart Start of the patch of every element in patchElems (CSR format).
+   * \param[out] patchElems Indices in the ADT of the elements of the patches.
+   */
+  void DetermineElementPatches(vector<unsigned long> &patchStart,
+                               vector<unsigned long> &patchElems) const;
+
+  /*!
+   * \brief Function, which returns the number of elements stored in the ADT.
+   * \return  The number of elements in the ADT.
+   */
+  inline unsigned long GetnElem(void) const { return elemVTK_Type.size(); }
+
 private:
 
+  /*!
+   * \brief Function, which carries out the actual nearest element search.
+   * \param[in]     coor          Coordinate for which the nearest element in the ADT must be determined.
+   * \param[in]     excludedElems Indices in the ADT of the elements that must be ignored.
+   * \param[in]     nExcluded     Number of elements in excludedElems.
+   * \param[in,out] dist2         On input an upper bound of the distance squared, on output the
+                                  distance squared to the nearest element if one has been found.
+   * \param[out]    elemADT       Index in the ADT of the nearest element, if one has been found.
+   * \return                      True if an element is found within the upper bound, false if not.
+   */
+  bool NearestElementSearch(const su2double     *coor,
+                            const unsigned long *excludedElems,
+                            const unsigned long nExcluded,
+                            su2double           &dist2,
+                            unsigned long       &elemADT);
+
   /*!
    * \brief Function, which checks whether or not the given coordinate is
             inside the given element.
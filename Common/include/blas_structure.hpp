@@ -105,6 +105,38 @@ private:
   const int kc;
   const int nc;
 
+  /* Sizes of the register blocks of the small gemm kernel, gemm_small. The
+     number of columns matches the minimum padding of the matrices used
+     in the DG solver (64 bytes, see ALIGNED_BYTES_MATMUL). */
+  enum : int {smallBlockCols = 8, smallBlockRows = 4};
+
+  /*!
+   * \brief Function, which carries out the small matrix products of the DG solver,
+            in which the number of columns of B and C is a multiple of smallBlockCols.
+            C is computed in blocks of smallBlockRows x smallBlockCols, which are kept
+            in the vector registers while the K terms of the product are accumulated.
+   * \param[in]  M  - Number of rows of A and C.
+   * \param[in]  N  - Number of columns of B and C.
+   * \param[in]  K  - Number of columns of A and number of rows of B.
+   * \param[in]  A  - Input matrix in the multiplication, row major order.
+   * \param[in]  B  - Input matrix in the multiplication, row major order.
+   * \param[out] C  - Result of the matrix product A*B, row major order.
+   */
+  void gemm_small(const int M,        const int N,        const int K,
+                  const su2double *A, const su2double *B, su2double *C) const;
+
+  /*!
+   * \brief Function, which computes a block of nRows x smallBlockCols of C for gemm_small.
+   * \param[in]  N  - Number of columns of B and C, i.e. the leading dimension of both.
+   * \param[in]  K  - Number of columns of A and number of rows of B.
+   * \param[in]  A  - Pointer to the first of the nRows rows of A.
+   * \param[in]  B  - Pointer to the first column of the block in B.
+   * \param[out] C  - Pointer to the first entry of the block in C.
+   */
+  template<int nRows>
+  void gemm_small_block(const int N,        const int K,
+                        const su2double *A, const su2double *B, su2double *C) const;
+
   /*!
    * \brief Function, which perform the implementation of the gemm functionality.
    * \param[in]  m  - Number of rows of a and c.
@@ -53,6 +53,15 @@
 
 typedef double passivedouble;
 
+/*--- Type used to store the Jacobian matrices and to apply the linear preconditioners, when SU2 is built
+ *    with -DUSE_MIXED_PRECISION it is single precision (the Krylov iterations are still done in double). ---*/
+
+#ifdef USE_MIXED_PRECISION
+typedef float su2mixedfloat;
+#else
+typedef passivedouble su2mixedfloat;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
@@ -55,6 +55,7 @@ extern "C" {
 #include "dual_grid/CEdge.hpp"
 #include "dual_grid/CVertex.hpp"
 #include "dual_grid/CTurboVertex.hpp"
+#include "dual_grid/CDualGridSoA.hpp"
 
 #include "../CConfig.hpp"
 #include "../geometry_structure_fem_part.hpp"
@@ -173,6 +174,7 @@ protected:
   finiteElementCSRFillN;                 /*!< \brief N-fill FEM sparsity (e.g. for ILUn preconditioner). */
 
   CEdgeToNonZeroMapUL edgeToCSRMap;      /*!< \brief Map edges to CSR entries referenced by them (i,j) and (j,i). */
+  CElemToNonZeroMapUL elemToCSRMap;      /*!< \brief Map elements to the FEM CSR entries referenced by their pairs of nodes. */
 
   /*--- Edge and element colorings. ---*/
 
@@ -182,6 +184,16 @@ protected:
   unsigned long edgeColorGroupSize = 1;  /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize = 1;  /*!< \brief Size of the element groups within each color. */
 
+  /*--- Contiguous copy of the dual grid. ---*/
+
+  CDualGridSoA dualGridSoA;              /*!< \brief Edge and point data in structure-of-arrays layout for the hot loops. */
+
+  /*!
+   * \brief Apply a permutation to the edges, the edge indices of the points are updated accordingly.
+   * \param[in] perm - New numbering, position iEdge is taken by the old edge perm[iEdge].
+   */
+  void PermuteEdges(const vector<unsigned long>& perm);
+
 public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -598,6 +610,12 @@ public:
    */
   inline virtual void SetRCM_Ordering(CConfig *config) {}
 
+  /*!
+   * \brief Orders the points along a space filling curve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetSFC_Ordering(CConfig *config) {}
+
   /*!
    * \brief Connects elements  .
    */
@@ -608,6 +626,13 @@ public:
    */
   void SetEdges(void);
 
+  /*!
+   * \brief Renumber the edges for data locality (sorted by points and, optionally, contiguous colors).
+   * \note Must be called right after SetEdges, before anything refers to the edge indices.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdgeOrdering(const CConfig *config);
+
   /*!
    * \brief Sets the faces of an element..
    */
@@ -1630,6 +1655,13 @@ public:
    */
   const CEdgeToNonZeroMapUL& GetEdgeToSparsePatternMap(void);
 
+  /*!
+   * \brief Get the element to sparse pattern map.
+   * \note This method builds the map and required pattern (0-fill FEM) if that has not been done yet.
+   * \return Reference to the map.
+   */
+  const CElemToNonZeroMapUL& GetElemToSparsePatternMap(void);
+
   /*!
    * \brief Get the edge coloring.
    * \note This method computes the coloring if that has not been done yet.
@@ -1656,5 +1688,26 @@ public:
    */
   inline unsigned long GetElementColorGroupSize(void) const { return elemColorGroupSize; }
 
+  /*!
+   * \brief Synchronize the contiguous copy of the dual grid with the CPoint and CEdge objects.
+   * \note Called at the end of SetControlVolume, and whenever coordinates or volumes are
+   *       modified outside of it (e.g. periodic volumes, coarse grid coordinates).
+   * \param[in] updateConnectivity - Also rebuild the edge nodes and point neighbors.
+   */
+  void SetDualGridSoA(bool updateConnectivity = false);
+
+  /*!
+   * \brief Get the contiguous copy of the dual grid.
+   * \return Reference to the structure-of-arrays dual grid.
+   */
+  inline const CDualGridSoA& GetDualGridSoA(void) const { return dualGridSoA; }
+
+  /*!
+   * \brief Get the contiguous copy of the dual grid, non-const version to populate the caches
+   *        of derived geometric quantities (e.g. the least-squares gradient weights).
+   * \return Reference to the structure-of-arrays dual grid.
+   */
+  inline CDualGridSoA& GetDualGridSoA(void) { return dualGridSoA; }
+
 };
 
@@ -31,6 +31,8 @@
 #include "meshreader/CMeshReaderFVM.hpp"
 #include "../toolboxes/C2DContainer.hpp"
 
+class CADTElemClass;
+
 /*!
  * \class CPhysicalGeometry
  * \brief Class for reading a defining the primal grid which is read from the grid file in .su2 or .cgns format.
@@ -104,6 +106,23 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  /*--- Data of the incremental wall distance, see ComputeWall_Distance_Incremental. ---*/
+  vector<unsigned long> WallDist_PatchStart;  /*!< \brief Start of the patch of each wall element in WallDist_PatchElems. */
+  vector<unsigned long> WallDist_PatchElems;  /*!< \brief Wall elements that share a point with each wall element. */
+  vector<su2double> WallDist_SurfaceCoor;     /*!< \brief Coordinates of the local wall points at the previous update. */
+  su2double WallDist_Motion = 0.0;            /*!< \brief Accumulated maximum displacement of the walls. */
+  vector<unsigned long> WallDist_Elem;        /*!< \brief Wall element whose patch is checked first, for each point. */
+  vector<su2double> WallDist_Margin;          /*!< \brief Distance to the nearest wall element outside that patch. */
+  vector<su2double> WallDist_Motion0;         /*!< \brief Value of WallDist_Motion when the margin was computed. */
+  su2activematrix WallDist_Coord;             /*!< \brief Coordinates of the points when the margin was computed. */
+
+  /*!
+   * \brief Apply a renumbering of the points to the coordinates, global indices, and connectivities.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - New numbering, position iPoint is taken by the old point Result[iPoint].
+   */
+  void ReorderPoints(CConfig *config, const vector<unsigned long>& Result);
+
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
   using CGeometry::SetVertex;
@@ -387,6 +406,23 @@ public:
    */
   void ComputeWall_Distance(CConfig *config) override;
 
+  /*!
+   * \brief Computes the wall distance with the wall partitioned among the ranks, each rank
+   *        only searches the partitions whose bounding box is close enough to its points.
+   * \param[in] WallADT - ADT of the viscous walls of this rank.
+   * \param[in] surfaceCoor - Coordinates of the points of the local viscous walls.
+   */
+  void ComputeWall_Distance_Distributed(CADTElemClass &WallADT, const vector<su2double> &surfaceCoor);
+
+  /*!
+   * \brief Updates the wall distance after the grid moved, the distance to the patch of wall elements
+   *        around the previous nearest element is exact as long as the point and the walls moved less
+   *        than the margin to the other elements, otherwise a full search of the ADT is carried out.
+   * \param[in] WallADT - ADT of all the viscous walls.
+   * \param[in] surfaceCoor - Coordinates of the points of the local viscous walls.
+   */
+  void ComputeWall_Distance_Incremental(CADTElemClass &WallADT, const vector<su2double> &surfaceCoor);
+
   /*!
    * \brief Compute surface area (positive z-direction) for force coefficient non-dimensionalization.
    * \param[in] config - Definition of the particular problem.
@@ -404,6 +440,12 @@ public:
    */
   void SetRCM_Ordering(CConfig *config) override;
 
+  /*!
+   * \brief Set a renumbering of the points along a space filling curve (Hilbert or Morton).
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSFC_Ordering(CConfig *config) override;
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -0,0 +1,202 @@
+/*!
+ * \file CDualGridSoA.hpp
+ * \brief Contiguous (structure-of-arrays) storage of the dual grid information
+ *        accessed in the edge and point loops of the finite volume solvers.
+ *        The subroutines and functions are in the <i>CDualGridSoA.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CPoint.hpp"
+#include "CEdge.hpp"
+#include "../../toolboxes/graph_toolbox.hpp"
+
+/*!
+ * \class CDualGridSoA
+ * \brief Flat copy of the edge (nodes and normals) and point (coordinates, volumes,
+ *        and neighbors) information of a grid.
+ * \note The CEdge and CPoint objects remain the "master" copy of the data, this class
+ *       is kept in sync by CGeometry every time the dual grid is (re)computed, such that
+ *       the hot loops stream through contiguous arrays instead of chasing pointers.
+ *       The neighbors of each point, and the edges that connect them, are stored in
+ *       compressed (CSR) format, in the same order as CPoint::GetPoint / GetEdge.
+ */
+class CDualGridSoA {
+private:
+  unsigned short nDim = 0;                   /*!< \brief Number of dimensions of the problem. */
+  unsigned long nPoint = 0;                  /*!< \brief Number of points (including halos). */
+  unsigned long nEdge = 0;                   /*!< \brief Number of edges. */
+
+  su2matrix<unsigned long> EdgeNodes;        /*!< \brief Nodes of each edge (nEdge x 2). */
+  su2activematrix EdgeNormal;                /*!< \brief Dual face normal of each edge (nEdge x nDim). */
+  su2activematrix Coord;                     /*!< \brief Coordinates of the points (nPoint x nDim). */
+  su2activevector Volume;                    /*!< \brief Total volume (including periodic part) of the points. */
+  CCompressedSparsePatternUL Neighbors;      /*!< \brief Neighbors of each point (CSR). */
+  su2vector<unsigned long> NeighborEdges;    /*!< \brief Edge connecting each point to each of its neighbors (same layout as Neighbors). */
+  su2matrix<unsigned long> EdgeNeighborPos;  /*!< \brief Position of each edge in the neighbors of its nodes (nEdge x 2), inverse of NeighborEdges. */
+
+  su2activematrix LeastSquaresWeights[2];    /*!< \brief Cached least-squares gradient weights of each point-neighbor pair, unweighted [0] and
+                                                         inverse-distance weighted [1] (same layout as Neighbors, nDim per pair). */
+  bool LeastSquaresWeightsSet[2] = {false, false}; /*!< \brief Whether the cached weights are consistent with the geometry. */
+
+public:
+  /*!
+   * \brief Build the connectivity (edge nodes and point neighbors) from the grid objects.
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nPoint - Number of points.
+   * \param[in] val_nEdge - Number of edges.
+   * \param[in] node - Point objects of the grid.
+   * \param[in] edge - Edge objects of the grid.
+   */
+  void SetConnectivity(unsigned short val_nDim, unsigned long val_nPoint, unsigned long val_nEdge,
+                       CPoint* const* node, CEdge* const* edge);
+
+  /*!
+   * \brief Copy the geometric quantities (coordinates, volumes, and normals) from the grid objects.
+   * \note The connectivity must have been set before.
+   * \param[in] node - Point objects of the grid.
+   * \param[in] edge - Edge objects of the grid.
+   */
+  void SetGeometry(CPoint* const* node, CEdge* const* edge);
+
+  /*!
+   * \brief Check if the connectivity matches the given sizes, i.e. if it is up to date.
+   * \param[in] val_nPoint - Number of points.
+   * \param[in] val_nEdge - Number of edges.
+   * \return True if the sizes match.
+   */
+  inline bool Matches(unsigned long val_nPoint, unsigned long val_nEdge) const {
+    return (nPoint == val_nPoint) && (nEdge == val_nEdge) && !Neighbors.empty();
+  }
+
+  /*!
+   * \brief Get one of the nodes of an edge.
+   * \param[in] iEdge - Edge index.
+   * \param[in] iNode - Position (0 or 1) of the node in the edge.
+   * \return Index of the node.
+   */
+  inline unsigned long GetNode(unsigned long iEdge, unsigned short iNode) const { return EdgeNodes(iEdge,iNode); }
+
+  /*!
+   * \brief Get the normal (the modulus is the area) of the dual face associated with an edge.
+   * \param[in] iEdge - Edge index.
+   * \return Pointer to the nDim components of the normal.
+   */
+  inline const su2double* GetNormal(unsigned long iEdge) const { return EdgeNormal[iEdge]; }
+
+  /*!
+   * \brief Get the coordinates of a point.
+   * \param[in] iPoint - Point index.
+   * \return Pointer to the nDim coordinates.
+   */
+  inline const su2double* GetCoord(unsigned long iPoint) const { return Coord[iPoint]; }
+
+  /*!
+   * \brief Get the total volume of a point, i.e. volume plus periodic volume.
+   * \param[in] iPoint - Point index.
+   * \return Volume of the control volume.
+   */
+  inline su2double GetVolume(unsigned long iPoint) const { return Volume(iPoint); }
+
+  /*!
+   * \brief Get the number of neighbors of a point.
+   * \param[in] iPoint - Point index.
+   * \return Number of neighbors.
+   */
+  inline unsigned long GetnNeighbor(unsigned long iPoint) const { return Neighbors.getNumNonZeros(iPoint); }
+
+  /*!
+   * \brief Get the neighbors of a point.
+   * \param[in] iPoint - Point index.
+   * \return Pointer to the GetnNeighbor(iPoint) neighbors of the point.
+   */
+  inline const unsigned long* GetNeighbors(unsigned long iPoint) const { return Neighbors.innerIdx(iPoint); }
+
+  /*!
+   * \brief Get the edges that connect a point to its neighbors.
+   * \param[in] iPoint - Point index.
+   * \return Pointer to the GetnNeighbor(iPoint) edges of the point.
+   */
+  inline const unsigned long* GetNeighborEdges(unsigned long iPoint) const {
+    return NeighborEdges.data() + Neighbors.outerPtr()[iPoint];
+  }
+
+  /*!
+   * \brief Get the position of an edge in the (CSR) neighbor storage of one of its nodes, i.e.
+   *        the index of the pair (node, other node) for data stored per point-neighbor pair.
+   * \param[in] iEdge - Edge index.
+   * \param[in] iNode - Position (0 or 1) of the node in the edge.
+   * \return Index in [0, number of non zeros of the neighbor pattern[.
+   */
+  inline unsigned long GetNeighborPosition(unsigned long iEdge, unsigned short iNode) const {
+    return EdgeNeighborPos(iEdge,iNode);
+  }
+
+  /*!
+   * \brief Get the sparse pattern of point neighbors.
+   * \return Reference to the CSR pattern.
+   */
+  inline const CCompressedSparsePatternUL& GetNeighborPattern(void) const { return Neighbors; }
+
+  /*!
+   * \brief Check if the least-squares gradient weights are cached for the current geometry.
+   * \note The cache is invalidated every time the geometry (or connectivity) is set.
+   * \param[in] weighted - Inverse-distance weighted (true) or unweighted (false) least-squares.
+   * \return True if the weights can be used.
+   */
+  inline bool HasLeastSquaresWeights(bool weighted) const { return LeastSquaresWeightsSet[weighted]; }
+
+  /*!
+   * \brief Get the least-squares weights of a point-neighbor pair, i.e. the vector a_ij in
+   *        grad(u)_i = sum_j a_ij (u_j - u_i), which combines the distance, the weight, and inv(R^T R).
+   * \param[in] weighted - Inverse-distance weighted (true) or unweighted (false) least-squares.
+   * \param[in] iPoint - Point index.
+   * \param[in] iNeigh - Position of the neighbor in the neighbors of iPoint.
+   * \return Pointer to the nDim components of the weight vector.
+   */
+  inline const su2double* GetLeastSquaresWeights(bool weighted, unsigned long iPoint, unsigned long iNeigh) const {
+    return LeastSquaresWeights[weighted][Neighbors.outerPtr()[iPoint]+iNeigh];
+  }
+
+  /*!
+   * \brief Non-const version of GetLeastSquaresWeights, to fill the cache.
+   */
+  inline su2double* GetLeastSquaresWeights(bool weighted, unsigned long iPoint, unsigned long iNeigh) {
+    return LeastSquaresWeights[weighted][Neighbors.outerPtr()[iPoint]+iNeigh];
+  }
+
+  /*!
+   * \brief Allocate the cache of least-squares weights, it remains invalid until SetLeastSquaresWeightsValid.
+   * \param[in] weighted - Inverse-distance weighted (true) or unweighted (false) least-squares.
+   */
+  void AllocateLeastSquaresWeights(bool weighted);
+
+  /*!
+   * \brief Mark the cached least-squares weights as consistent with the geometry.
+   * \param[in] weighted - Inverse-distance weighted (true) or unweighted (false) least-squares.
+   */
+  inline void SetLeastSquaresWeightsValid(bool weighted) { LeastSquaresWeightsSet[weighted] = true; }
+
+};
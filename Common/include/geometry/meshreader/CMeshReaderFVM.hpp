@@ -61,6 +61,13 @@ protected:
   unsigned long numberOfMarkers;                             /*!< \brief Total number of markers contained within the mesh file. */
   vector<string> markerNames;                                /*!< \brief String names for all markers in the mesh file. */
   vector<vector<unsigned long> > surfaceElementConnectivity; /*!< \brief Vector containing the surface element connectivity from the mesh file on a per-marker basis. Only the master node reads and stores this connectivity. */
+
+  /*!
+   * \brief Send linearly partitioned volume elements to all ranks that own one of their points (in the linear partitioning of the points).
+   * \note Sets localVolumeElementConnectivity and numberOfLocalElements, elements are repeated on the ranks that share their points.
+   * \param[in,out] connElems - Elements read by this rank, [globalID vtkType n0 ... n7] in chunks of SU2_CONN_SIZE (released on exit).
+   */
+  void DistributeVolumeElements(vector<unsigned long>& connElems);
   
 public:
   
@@ -45,6 +45,10 @@ private:
   string meshFilename; /*!< \brief Name of the SU2 ASCII mesh file being read. */
   ifstream mesh_file;  /*!< \brief File object for the SU2 ASCII mesh file. */
   
+  unsigned long pointByteRange[2]; /*!< \brief Offsets in the file of the first and one past the last point line of the zone. */
+  unsigned long elemByteRange[2];  /*!< \brief Offsets in the file of the first and one past the last volume element line of the zone. */
+  unsigned long markerByteOffset;  /*!< \brief Offset in the file of the NMARK= line of the zone. */
+  
   bool actuator_disk; /*!< \brief Boolean for whether we have an actuator disk to split. */
   
   unsigned long ActDiskNewPoints; /*!< \brief Total number of new grid points to add due to actuator disk splitting. */
@@ -68,6 +72,7 @@ private:
   
   /*!
    * \brief Reads all SU2 ASCII mesh metadata and checks for errors.
+   * \note The master scans the file once and records the byte offsets of the sections of the zone.
    */
   void ReadMetadata();
   
@@ -91,6 +96,30 @@ private:
    */
   void ReadSurfaceElementConnectivity();
   
+  /*!
+   * \brief Reads the lines of a section of the file that start in the linear partition of its bytes owned by this rank.
+   * \param[in] byteRange - Offsets of the first and one past the last byte of the section.
+   * \param[in] numberOfLines - Number of lines in the section, used to check the file.
+   * \param[out] lines - Null terminated lines of the rank.
+   * \param[out] firstLine - Index in the section of the first line of the rank.
+   * \param[out] numberOfLocalLines - Number of lines of the rank.
+   */
+  void ReadSectionInParallel(const unsigned long byteRange[2],
+                             unsigned long numberOfLines,
+                             vector<char>& lines,
+                             unsigned long& firstLine,
+                             unsigned long& numberOfLocalLines) const;
+  
+  /*!
+   * \brief Reads the grid points from byte ranges of the file in parallel and sends them to their linear partitions.
+   */
+  void ReadPointCoordinatesParallel();
+  
+  /*!
+   * \brief Reads the interior volume elements from byte ranges of the file in parallel and sends them to the ranks owning their points.
+   */
+  void ReadVolumeElementConnectivityParallel();
+  
   /*!
    * \brief Helper function to find the current zone in an SU2 ASCII mesh object.
    */
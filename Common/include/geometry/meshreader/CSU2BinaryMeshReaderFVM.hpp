@@ -0,0 +1,103 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid (MESH_FORMAT= SU2_BINARY) into linear partitions for the finite volume solver (FVM).
+ * \note Each zone of the file starts with a header of SU2_BINARY_HEADER_SIZE unsigned longs (see ENUM_SU2_BINARY_HEADER)
+ *       that indexes the start of the marker, point, and element sections, and of the next zone. Points are stored
+ *       as nDim doubles and elements as records of SU2_CONN_SIZE unsigned longs, [globalID vtkType n0 ... n7], hence
+ *       each rank can read its slice of the linear partitions directly, with MPI I/O when available.
+ * \author SU2 Contributors
+ */
+class CSU2BinaryMeshReaderFVM: public CMeshReaderFVM {
+
+private:
+
+  unsigned short myZone; /*!< \brief Current SU2 zone index. */
+  unsigned short nZones; /*!< \brief Total number of zones in the SU2 file. */
+
+  string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+  unsigned long zoneHeader[SU2_BINARY_HEADER_SIZE]; /*!< \brief Header of the current zone. */
+
+#ifdef HAVE_MPI
+  MPI_File mesh_file; /*!< \brief MPI file handle for the SU2 binary mesh file. */
+  MPI_Datatype wordType; /*!< \brief Type of the entries of the file (8 bytes). */
+#else
+  FILE *mesh_file;    /*!< \brief File handle for the SU2 binary mesh file. */
+#endif
+
+  /*!
+   * \brief Reads a number of 8 byte words (unsigned long or double) from the mesh file.
+   * \param[out] data - Where the words are stored.
+   * \param[in] nWords - Number of words to read.
+   * \param[in] offset - Location in bytes of the first word in the file.
+   * \param[in] collective - If true the routine is called by all ranks (collective MPI I/O).
+   */
+  void ReadWords(void *data, unsigned long nWords, unsigned long offset, bool collective);
+
+  /*!
+   * \brief Reads the header of the current zone and checks for errors.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the grid points of the linear partition of this rank.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and sends them to the ranks owning their points.
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the surface (boundary) elements of the zone on the master rank.
+   */
+  void ReadSurfaceElementConnectivity();
+
+public:
+
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                          unsigned short val_iZone,
+                          unsigned short val_nZone);
+
+  /*!
+   * \brief Destructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  ~CSU2BinaryMeshReaderFVM(void);
+
+};
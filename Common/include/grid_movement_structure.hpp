@@ -1128,10 +1128,10 @@ public:
    * \brief Add the stiffness matrix for a 2-D triangular element to the global stiffness matrix for the entire mesh (node-based).
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] StiffMatrix_Elem - Element stiffness matrix to be filled.
-   * \param[in] PointCorners - Index values for element corners
+   * \param[in] iElem - Index of the element, used to locate its blocks in the global matrix.
    * \param[in] nNodes - Number of nodes defining the element.
    */
-  void AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes);
+  void AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long iElem, unsigned short nNodes);
   
   /*!
    * \brief Check for negative volumes (all elements) after performing grid deformation.
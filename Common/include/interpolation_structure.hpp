@@ -417,7 +417,23 @@ public:
    * \param[in] dist - distance
    */
   static su2double Get_RadialBasisValue(const short unsigned int type, const su2double &radius, const su2double &dist);
-  
+
+  /*!
+   * \brief Compute the interpolation weights of compactly supported basis functions, with the centers near each
+   * target only (see Set_TransferCoeff_Sparse), this is static so it can be re-used.
+   * \param[in] nDim - number of dimensions
+   * \param[in] type - of radial basis function
+   * \param[in] radius - the characteristic dimension
+   * \param[in] nLayer - layers of centers (of the size of the radius) beyond the support of the targets
+   * \param[in] centerCoord - coordinates of the centers
+   * \param[in] targetCoord - coordinates of the targets
+   * \param[out] weights - for each target, the centers and their weights
+   */
+  static void Get_SparseInterpolationWeights(unsigned short nDim, unsigned short type, passivedouble radius,
+                                             unsigned short nLayer, const vector<passivedouble>& centerCoord,
+                                             const vector<passivedouble>& targetCoord,
+                                             vector<vector<pair<unsigned long, passivedouble> > >& weights);
+
 private:
   /*!
    * \brief If the polynomial term is included in the interpolation, and the points lie on a plane, the matrix becomes rank deficient
@@ -432,6 +448,15 @@ private:
    */
   void Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P);
 
+  /*!
+   * \brief Set up the transfer matrix with compactly supported basis functions, without forming dense matrices.
+   * The weights of each target are computed from the interpolation matrix of the centers near it, each rank
+   * computes the weights of its targets. Optionally only a subset of the donor points, selected by a greedy
+   * algorithm, are used as centers.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_TransferCoeff_Sparse(CConfig **config);
+
 };
 
 /*!
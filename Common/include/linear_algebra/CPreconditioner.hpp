@@ -59,6 +59,18 @@ public:
    * \brief Generic "preprocessing" hook derived classes may implement to build the preconditioner.
    */
   virtual void Build() {}
+
+  /*!
+   * \brief Factory method.
+   * \param[in] kind_prec - Type of preconditioner (or type of PaStiX factorization).
+   * \param[in] jacobian - Matrix that defines the preconditioner.
+   * \param[in] geometry - Geometry associated with the problem.
+   * \param[in] config - Config of the problem.
+   * \param[in] transposed - If the transpose version of the preconditioner is required.
+   * \return Pointer to the new preconditioner (Jacobi if the type is not known), owned by the caller.
+   */
+  static CPreconditioner* Create(unsigned short kind_prec, CSysMatrix<ScalarType>& jacobian,
+                                 CGeometry* geometry, CConfig* config, bool transposed);
 };
 template<class ScalarType>
 CPreconditioner<ScalarType>::~CPreconditioner() {}
@@ -172,6 +184,60 @@ public:
 };
 
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief Specialization of preconditioner that uses CSysMatrix class (smoothed aggregation AMG).
+ */
+template<class ScalarType>
+class CAMGPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CSysMatrix<ScalarType>& sparse_matrix; /*!< \brief Pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry;                   /*!< \brief Pointer to geometry associated with the matrix. */
+  CConfig* config;                       /*!< \brief Pointer to problem configuration. */
+  bool transp;                           /*!< \brief If the transpose version of the preconditioner is required. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] matrix_ref - Matrix reference that will be used to define the preconditioner.
+   * \param[in] geometry_ref - Geometry associated with the problem.
+   * \param[in] config_ref - Config of the problem.
+   * \param[in] transposed - If the transpose version of the preconditioner is required.
+   */
+  inline CAMGPreconditioner(CSysMatrix<ScalarType> & matrix_ref,
+                            CGeometry *geometry_ref, CConfig *config_ref, bool transposed) :
+    sparse_matrix(matrix_ref)
+  {
+    if((geometry_ref == nullptr) || (config_ref == nullptr))
+      SU2_MPI::Error("Preconditioner needs to be built with valid references.", CURRENT_FUNCTION);
+    geometry = geometry_ref;
+    config = config_ref;
+    transp = transposed;
+  }
+
+  /*!
+   * \note This class cannot be default constructed as that would leave us with invalid Pointers.
+   */
+  CAMGPreconditioner() = delete;
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    sparse_matrix.ComputeAMGPreconditioner(u, v, geometry, config);
+  }
+
+  /*!
+   * \note Request the associated matrix to build the preconditioner.
+   */
+  inline void Build() override {
+    sparse_matrix.BuildAMGPreconditioner(transp);
+  }
+};
+
+
 /*!
  * \class CLU_SGSPreconditioner
  * \brief Specialization of preconditioner that uses CSysMatrix class.
@@ -323,3 +389,84 @@ public:
     sparse_matrix.BuildPastixPreconditioner(geometry, config, kind_fact, transp);
   }
 };
+
+
+template<class ScalarType>
+CPreconditioner<ScalarType>* CPreconditioner<ScalarType>::Create(unsigned short kind_prec,
+                                                                 CSysMatrix<ScalarType>& jacobian,
+                                                                 CGeometry* geometry, CConfig* config,
+                                                                 bool transposed) {
+  switch (kind_prec) {
+    case JACOBI:
+      return new CJacobiPreconditioner<ScalarType>(jacobian, geometry, config, transposed);
+    case ILU:
+      return new CILUPreconditioner<ScalarType>(jacobian, geometry, config, transposed);
+    case LU_SGS:
+      return new CLU_SGSPreconditioner<ScalarType>(jacobian, geometry, config);
+    case LINELET:
+      return new CLineletPreconditioner<ScalarType>(jacobian, geometry, config);
+    case AMG:
+      return new CAMGPreconditioner<ScalarType>(jacobian, geometry, config, transposed);
+    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
+    case PASTIX_LU: case PASTIX_LDLT:
+      return new CPastixPreconditioner<ScalarType>(jacobian, geometry, config, kind_prec, transposed);
+    default:
+      return new CJacobiPreconditioner<ScalarType>(jacobian, geometry, config, transposed);
+  }
+}
+
+
+/*!
+ * \class CMixedPrecisionPreconditioner
+ * \brief Applies a preconditioner stored in lower precision (MatScalar) to vectors of higher precision (ScalarType).
+ * \note The input is rounded to MatScalar, the preconditioner is applied in that precision (which halves
+ *       the memory traffic of the sweeps when MatScalar is float), and the output is promoted back.
+ *       The temporary vectors are references because they must be shared by all threads.
+ */
+template<class ScalarType, class MatScalar>
+class CMixedPrecisionPreconditioner final : public CPreconditioner<ScalarType> {
+private:
+  CPreconditioner<MatScalar>* precond; /*!< \brief The preconditioner in lower precision, owned by this object. */
+  CSysVector<MatScalar>& u_tmp;        /*!< \brief Input of the lower precision preconditioner. */
+  CSysVector<MatScalar>& v_tmp;        /*!< \brief Output of the lower precision preconditioner. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] precond_ptr - Lower precision preconditioner, deleted by the destructor of this class.
+   * \param[in] u_ref - Temporary for the input of the preconditioner.
+   * \param[in] v_ref - Temporary for the output of the preconditioner.
+   */
+  inline CMixedPrecisionPreconditioner(CPreconditioner<MatScalar>* precond_ptr,
+                                       CSysVector<MatScalar>& u_ref, CSysVector<MatScalar>& v_ref) :
+    precond(precond_ptr), u_tmp(u_ref), v_tmp(v_ref) {}
+
+  /*!
+   * \note This class cannot be default constructed or copied as it owns the wrapped preconditioner.
+   */
+  CMixedPrecisionPreconditioner() = delete;
+  CMixedPrecisionPreconditioner(const CMixedPrecisionPreconditioner&) = delete;
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CMixedPrecisionPreconditioner() { delete precond; }
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    u_tmp.PassiveCopy(u);
+    (*precond)(u_tmp, v_tmp);
+    v.PassiveCopy(v_tmp);
+  }
+
+  /*!
+   * \note Request the wrapped preconditioner to build itself.
+   */
+  inline void Build() override {
+    precond->Build();
+  }
+};
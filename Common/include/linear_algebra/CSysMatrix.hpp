@@ -31,6 +31,8 @@
 #include "../../include/mpi_structure.hpp"
 #include "CSysVector.hpp"
 #include "CPastixWrapper.hpp"
+#include "CSysMatrixAMG.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -84,11 +86,21 @@ private:
   unsigned long omp_heavy_size;     /*!< \brief Actual chunk size used in heavy loops (e.g. over rows). */
   unsigned long omp_num_parts;      /*!< \brief Number of threads used in thread-parallel LU_SGS and ILU. */
   unsigned long *omp_partitions;    /*!< \brief Point indexes of LU_SGS and ILU thread-parallel sub partitioning. */
+  bool omp_level_sched;             /*!< \brief Use level scheduling (exact) instead of partitioning (approximate) in LU_SGS and ILU. */
+  CCompressedSparsePatternUL lower_levels;     /*!< \brief Level schedule of the forward sweep of LU_SGS. */
+  CCompressedSparsePatternUL upper_levels;     /*!< \brief Level schedule of the backward sweep of LU_SGS. */
+  CCompressedSparsePatternUL ilu_lower_levels; /*!< \brief Level schedule of the ILU factorization and forward sweep. */
+  CCompressedSparsePatternUL ilu_upper_levels; /*!< \brief Level schedule of the ILU backward sweep. */
+
+  vector<unsigned long> comm_rows;     /*!< \brief Rows sent to other ranks in the halo exchange of products (SOLUTION_MATRIX). */
+  vector<unsigned long> interior_rows; /*!< \brief Remaining rows, computed while the exchange of the comm_rows is in flight. */
 
   unsigned long nPoint;             /*!< \brief Number of points in the grid. */
   unsigned long nPointDomain;       /*!< \brief Number of points in the grid (excluding halos). */
   unsigned long nVar;               /*!< \brief Number of variables. */
   unsigned long nEqn;               /*!< \brief Number of equations. */
+  unsigned long kernel_size;        /*!< \brief Block size of the compile-time specialized kernels used by the products and
+                                                preconditioners (1 to MAXNVAR-1), 0 if the generic kernels are used. */
 
   ScalarType *matrix;               /*!< \brief Entries of the sparse matrix. */
   unsigned long nnz;                /*!< \brief Number of possible nonzero entries in the matrix. */
@@ -132,6 +144,8 @@ private:
   mutable CPastixWrapper pastix_wrapper;
 #endif
 
+  CSysMatrixAMG<ScalarType> amg;    /*!< \brief Algebraic multigrid hierarchy built from this matrix. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -146,6 +160,20 @@ private:
 
   } edge_ptr;
 
+  /*!
+   * \brief Auxilary object to wrap the element map pointers used in fast block updates, i.e. without linear searches.
+   */
+  struct {
+    const unsigned long *outer = nullptr;
+    const unsigned long *inner = nullptr;
+
+    inline unsigned long operator() (unsigned long elem, unsigned long nNode,
+                                     unsigned long iNode, unsigned long jNode) const {
+      return inner[outer[elem] + iNode*nNode + jNode];
+    }
+
+  } elem_ptr;
+
   /*!
    * \brief Handle type conversion for when we Set, Add, etc. blocks, preserving derivative information (if supported by types).
    * \note See specializations for discrete adjoint right outside this class's declaration.
@@ -197,11 +225,52 @@ private:
    */
   inline void MatrixVectorProductTransp(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
 
+  /*!
+   * \brief Calculates the matrix-vector product: product += matrix*vector, for vectors of a different type.
+   * \note Used for mixed precision, i.e. when the matrix is stored with less precision than the vectors.
+   * \param[in] matrix
+   * \param[in] vector
+   * \param[in,out] product
+   */
+  template<class OtherType>
+  inline void MatrixVectorProductAdd(const ScalarType *matrix, const OtherType *vector, OtherType *product) const;
+
+  /*!
+   * \brief Calculates the matrix-vector product: product += matrix^T * vector, for vectors of a different type.
+   * \param[in] matrix
+   * \param[in] vector
+   * \param[in,out] product
+   */
+  template<class OtherType>
+  inline void MatrixVectorProductTransp(const ScalarType *matrix, const OtherType *vector, OtherType *product) const;
+
   /*!
    * \brief Calculates the matrix-matrix product
    */
   inline void MatrixMatrixProduct(const ScalarType *matrix_a, const ScalarType *matrix_b, ScalarType *product) const;
 
+  /*!
+   * \brief Block kernels (product = matrix*vector, +=, -=, and matrix-matrix product) for a block size N fixed at
+   *        compilation, they are fully unrolled and vectorized. For N = 0 the generic kernels above are used.
+   * \note The loops over rows are templated on N and dispatched once per call according to kernel_size.
+   */
+  template<size_t N>
+  inline void BlockVectorProduct(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
+  template<size_t N, class OtherType>
+  inline void BlockVectorProductAdd(const ScalarType *matrix, const OtherType *vector, OtherType *product) const;
+  template<size_t N>
+  inline void BlockVectorProductSub(const ScalarType *matrix, const ScalarType *vector, ScalarType *product) const;
+  template<size_t N>
+  inline void BlockMatrixProduct(const ScalarType *matrix_a, const ScalarType *matrix_b, ScalarType *product) const;
+
+  /*!
+   * \brief Gauss_Elimination and MatrixInverse for a block size N fixed at compilation (generic versions for N = 0).
+   */
+  template<size_t N>
+  inline void BlockGauss_Elimination(ScalarType* matrix, ScalarType* vec) const;
+  template<size_t N>
+  inline void BlockMatrixInverse(ScalarType *matrix, ScalarType *inverse) const;
+
   /*!
    * \brief Subtract b from a and store the result in c.
    */
@@ -253,7 +322,9 @@ private:
    * \param[in] rhs - Right-hand-side of the linear system.
    * \param[in] transposed - If true the transposed of the block is used (default = false).
    * \return Solution of the linear system (overwritten on rhs).
+   * \note N is the block size of the kernels, as for the other row kernels below.
    */
+  template<size_t N>
   inline void Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed = false) const;
 
   /*!
@@ -261,6 +332,7 @@ private:
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
+  template<size_t N>
   inline void InverseDiagonalBlock(unsigned long block_i, ScalarType *invBlock, bool transposed = false) const;
 
   /*!
@@ -268,6 +340,7 @@ private:
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
    * \param[out] invBlock - Inverse block.
    */
+  template<size_t N>
   inline void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, ScalarType *invBlock) const;
 
   /*!
@@ -293,6 +366,36 @@ private:
    */
   inline void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType *val_block);
 
+  /*!
+   * \brief Factorize one row of the ILU matrix, the rows it depends on must have been factorized.
+   * \note The inverse of the diagonal block of the row is stored in invM.
+   * \param[in] row_i - Row to factorize.
+   * \param[in] begin - Rows/columns below this are ignored (thread partition).
+   * \param[in] end - Rows/columns from this on are ignored (thread partition).
+   */
+  template<size_t N>
+  inline void FactorizeRow_ILUMatrix(unsigned long row_i, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Forward substitution for one row of the ILU matrix, prod_i = vec_i - L_ij prod_j.
+   * \param[in] vec - Right hand side.
+   * \param[in,out] prod - Solution, the rows row_i depends on must have been computed.
+   * \param[in] row_i - Row of the system.
+   * \param[in] col_lb - Inclusive lower bound for column indices considered in the product.
+   */
+  template<size_t N>
+  inline void ForwardRow_ILUMatrix(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                   unsigned long row_i, unsigned long col_lb) const;
+
+  /*!
+   * \brief Backward substitution for one row of the ILU matrix, prod_i = inv(D_i) (prod_i - U_ij prod_j).
+   * \param[in,out] prod - Solution, the rows row_i depends on must have been computed.
+   * \param[in] row_i - Row of the system.
+   * \param[in] col_ub - Exclusive upper bound for column indices considered in the product.
+   */
+  template<size_t N>
+  inline void BackwardRow_ILUMatrix(CSysVector<ScalarType> & prod, unsigned long row_i, unsigned long col_ub) const;
+
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
@@ -300,6 +403,7 @@ private:
    * \param[in] col_ub - Exclusive upper bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product U(A)*vec.
    */
+  template<size_t N>
   inline void UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                            unsigned long col_ub, ScalarType *prod) const;
 
@@ -310,6 +414,7 @@ private:
    * \param[in] col_lb - Inclusive lower bound for column indices considered in multiplication.
    * \param[out] prod - Result of the product L(A)*vec.
    */
+  template<size_t N>
   inline void LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                            unsigned long col_lb, ScalarType *prod) const;
 
@@ -319,6 +424,7 @@ private:
    * \param[in] row_i - Row of the matrix to be multiplied by vector vec.
    * \return prod Result of the product D(A)*vec (stored at *prod_row_vector).
    */
+  template<size_t N>
   inline void DiagonalProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
   /*!
@@ -329,6 +435,25 @@ private:
    */
   void RowProduct(const CSysVector<ScalarType> & vec, unsigned long row_i, ScalarType *prod) const;
 
+  /*!
+   * \brief Loops of the thread-parallel matrix-vector product, factorizations and preconditioners for block size N.
+   * \note These are the hot loops, the public methods select N (see kernel_size) and handle communication.
+   */
+  template<size_t N, class OtherType, class RowList>
+  void MatrixVectorProductImpl(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod, const RowList& rows) const;
+  template<size_t N>
+  void BuildJacobiPreconditionerImpl(bool transpose);
+  template<size_t N>
+  void ComputeJacobiPreconditionerImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+  template<size_t N>
+  void FactorizeILUMatrix();
+  template<size_t N>
+  void ComputeILUPreconditionerImpl(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+  template<size_t N>
+  void LU_SGSForwardSweep(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const;
+  template<size_t N>
+  void LU_SGSBackwardSweep(CSysVector<ScalarType> & prod) const;
+
 public:
 
   /*!
@@ -354,6 +479,19 @@ public:
                   unsigned short nvar, unsigned short neqn,
                   bool EdgeConnect, CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Initializes the matrix with the dimensions and sparse pattern of another, possibly of a different type.
+   * \note Used to keep a lower precision copy of a matrix (see CSysSolve), the values are not copied.
+   * \param[in] other - Matrix from which the structure is taken.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<class OtherType>
+  void Initialize(const CSysMatrix<OtherType>& other, CGeometry *geometry, CConfig *config) {
+    Initialize(other.nPoint, other.nPointDomain, other.nVar, other.nEqn,
+               other.edge_ptr.ptr != nullptr, geometry, config);
+  }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -417,6 +555,20 @@ public:
     return nullptr;
   }
 
+  /*!
+   * \brief Get a pointer to the start of the block of a pair of nodes of an element, without searching.
+   * \note Only available for matrices with the finite element type of connectivity.
+   * \param[in] iElem - Element index.
+   * \param[in] nNodes - Number of nodes of the element.
+   * \param[in] iNode - Local index of the row node.
+   * \param[in] jNode - Local index of the column node.
+   * \return Pointer to location in memory where the block starts.
+   */
+  inline ScalarType *GetElemBlock(unsigned long iElem, unsigned long nNodes,
+                                  unsigned long iNode, unsigned long jNode) {
+    return &(matrix[elem_ptr(iElem,nNodes,iNode,jNode)*nVar*nEqn]);
+  }
+
   /*!
    * \brief Gets the value of a particular entry in block "ij".
    * \param[in] block_i - Row index.
@@ -497,6 +649,48 @@ public:
     }
   }
 
+  /*!
+   * \brief Add a scaled block (in flat format) of an element matrix to the sparse matrix, without searching.
+   * \note Only available for matrices with the finite element type of connectivity.
+   * \param[in] iElem - Element index.
+   * \param[in] nNodes - Number of nodes of the element.
+   * \param[in] iNode - Local index of the row node.
+   * \param[in] jNode - Local index of the column node.
+   * \param[in] alpha - Scale factor.
+   * \param[in] val_block - Block to add to A(i, j).
+   */
+  template<class OtherType>
+  inline void AddElemBlock(unsigned long iElem, unsigned long nNodes, unsigned long iNode, unsigned long jNode,
+                           OtherType alpha, const OtherType *val_block) {
+
+    ScalarType *bij = GetElemBlock(iElem, nNodes, iNode, jNode);
+
+    for (unsigned long iVar = 0; iVar < nVar*nEqn; iVar++)
+      bij[iVar] += PassiveAssign<ScalarType,OtherType>(alpha * val_block[iVar]);
+  }
+
+  /*!
+   * \brief Adds the block of an element matrix to the sparse matrix, without searching.
+   * \note Only available for matrices with the finite element type of connectivity.
+   * \param[in] iElem - Element index.
+   * \param[in] nNodes - Number of nodes of the element.
+   * \param[in] iNode - Local index of the row node.
+   * \param[in] jNode - Local index of the column node.
+   * \param[in] val_block - Block to add to A(i, j).
+   */
+  template<class OtherType>
+  inline void AddElemBlock(unsigned long iElem, unsigned long nNodes, unsigned long iNode, unsigned long jNode,
+                           const OtherType* const* val_block) {
+
+    ScalarType *bij = GetElemBlock(iElem, nNodes, iNode, jNode);
+
+    unsigned long iVar, jVar, offset = 0;
+
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        bij[offset++] += PassiveAssign<ScalarType,OtherType>(val_block[iVar][jVar]);
+  }
+
   /*!
    * \brief Adds the specified block to the sparse matrix.
    * \param[in] block_i - Row index.
@@ -711,22 +905,27 @@ public:
 
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
+   * \note The vectors may be of higher precision than the matrix (mixed precision). With MPI the rows
+   *       sent to other ranks are computed first, the halo exchange then overlaps the remaining rows.
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[out] prod - Result of the product.
    */
-  void MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void MatrixVectorProduct(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                            CGeometry *geometry, CConfig *config) const;
 
   /*!
    * \brief Performs the product of a sparse matrix by a CSysVector.
+   * \note The vectors may be of higher precision than the matrix (mixed precision).
    * \param[in] vec - CSysVector to be multiplied by the sparse matrix A.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[out] prod - Result of the product.
    */
-  void MatrixVectorProductTransposed(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+  template<class OtherType>
+  void MatrixVectorProductTransposed(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                      CGeometry *geometry, CConfig *config) const;
 
   /*!
@@ -812,6 +1011,22 @@ public:
   void ComputePastixPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                    CGeometry *geometry, CConfig *config) const;
 
+  /*!
+   * \brief Build the smoothed aggregation AMG preconditioner.
+   * \param[in] transposed - Flag to use the transposed matrix to construct the preconditioner.
+   */
+  void BuildAMGPreconditioner(bool transposed = false);
+
+  /*!
+   * \brief Apply one V-cycle of the AMG preconditioner to CSysVec.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                CGeometry *geometry, CConfig *config) const;
+
 };
 
 #ifdef CODI_REVERSE_TYPE
@@ -78,13 +78,18 @@ FORCEINLINE void CSysMatrix<ScalarType>::SetBlockTransposed_ILUMatrix(unsigned l
   }
 }
 
-template<class T, bool alpha, bool beta, bool transp>
-FORCEINLINE void gemv_impl(const unsigned long n, const T *a, const T *b, T *c) {
+template<class T, bool alpha, bool beta, bool transp, class MatT = T, size_t N = 0>
+FORCEINLINE void gemv_impl(const unsigned long n_, const MatT *a, const T *b, T *c) {
   /*---
    This is a templated version of GEMV with the constants as boolean
    template parameters so that they can be optimized away at compilation.
    This is still the traditional "row dot vector" method.
+   The matrix type may differ from the vector type (mixed precision),
+   the products are then accumulated in the type of the vectors.
+   When N > 0 the size is also known at compilation (n_ is ignored),
+   the loops can then be fully unrolled and vectorized.
   ---*/
+  const unsigned long n = N? N : n_;
   unsigned long i, j;
   for (i = 0; i < n; i++) {
     if (!beta) c[i] = 0.0;
@@ -95,9 +100,10 @@ FORCEINLINE void gemv_impl(const unsigned long n, const T *a, const T *b, T *c)
   }
 }
 
-template<class T>
-FORCEINLINE void gemm_impl(const unsigned long n, const T *a, const T *b, T *c) {
-  /*--- Same deal as for GEMV but here only the type is templated. ---*/
+template<class T, size_t N = 0>
+FORCEINLINE void gemm_impl(const unsigned long n_, const T *a, const T *b, T *c) {
+  /*--- Same deal as for GEMV but here only the type (and optionally the size) is templated. ---*/
+  const unsigned long n = N? N : n_;
   unsigned long i, j, k;
   for (i = 0; i < n; i++) {
     for (j = 0; j < n; j++) {
@@ -108,6 +114,78 @@ FORCEINLINE void gemm_impl(const unsigned long n, const T *a, const T *b, T *c)
   }
 }
 
+template<class T, size_t N = 0>
+FORCEINLINE void gauss_elim_impl(const unsigned long n_, T *matrix, T *vec) {
+  /*--- Gaussian elimination without pivoting, the size may be fixed at compilation (N > 0). ---*/
+  const unsigned long n = N? N : n_;
+#define A(I,J) matrix[(I)*n+(J)]
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++) {
+      T weight = A(iVar,jVar) / A(jVar,jVar);
+      for (auto kVar = jVar; kVar < n; kVar++)
+        A(iVar,kVar) -= weight * A(jVar,kVar);
+      vec[iVar] -= weight * vec[jVar];
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < n; jVar++)
+      vec[iVar] -= A(iVar,jVar) * vec[jVar];
+    vec[iVar] /= A(iVar,iVar);
+  }
+#undef A
+}
+
+template<class T, size_t N = 0>
+FORCEINLINE void matrix_inverse_impl(const unsigned long n_, T *matrix, T *inverse) {
+
+  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
+   We could call "gauss_elim_impl" multiple times or fully generalize it for multiple rhs,
+   the performance of both routines would suffer in both cases without the use of exotic templating.
+   And so it feels reasonable to have some duplication here. ---*/
+
+  const unsigned long n = N? N : n_;
+#define A(I,J) matrix[(I)*n+(J)]
+#define M(I,J) inverse[(I)*n+(J)]
+
+  /*--- Initialize the inverse with the identity. ---*/
+  for (auto iVar = 0ul; iVar < n; iVar++)
+    for (auto jVar = 0ul; jVar < n; jVar++)
+      M(iVar,jVar) = T(iVar==jVar);
+
+  /*--- Transform system in Upper Matrix ---*/
+  for (auto iVar = 1ul; iVar < n; iVar++) {
+    for (auto jVar = 0ul; jVar < iVar; jVar++)
+    {
+      T weight = A(iVar,jVar) / A(jVar,jVar);
+
+      for (auto kVar = jVar; kVar < n; kVar++)
+        A(iVar,kVar) -= weight * A(jVar,kVar);
+
+      /*--- at this stage M is lower triangular so not all cols need updating ---*/
+      for (auto kVar = 0ul; kVar <= jVar; kVar++)
+        M(iVar,kVar) -= weight * M(jVar,kVar);
+    }
+  }
+
+  /*--- Backwards substitution ---*/
+  for (auto iVar = n; iVar > 0ul;) {
+    iVar--; // unsigned type
+    for (auto jVar = iVar+1; jVar < n; jVar++)
+      for (auto kVar = 0ul; kVar < n; kVar++)
+        M(iVar,kVar) -= A(iVar,jVar) * M(jVar,kVar);
+
+    for (auto kVar = 0ul; kVar < n; kVar++)
+      M(iVar,kVar) /= A(iVar,iVar);
+  }
+#undef A
+#undef M
+}
+
 #define __MATVECPROD_SIGNATURE__(TYPE,NAME) \
 FORCEINLINE void CSysMatrix<TYPE>::NAME(const TYPE *matrix, const TYPE *vector, TYPE *product) const
 
@@ -192,40 +270,222 @@ FORCEINLINE void CSysMatrix<su2double>::MatrixMatrixProduct(const su2double *mat
 #endif // CODI_REVERSE_TYPE
 #endif // USE_MKL
 
+#if defined(USE_MKL) && defined(USE_MIXED_PRECISION)
+/*--- The JIT kernels are double precision, the single precision matrices of mixed precision builds use the naive implementation. ---*/
+template<> __MATVECPROD_SIGNATURE__(su2mixedfloat, MatrixVectorProduct) {
+  gemv_impl<su2mixedfloat,true,false,false>(nVar, matrix, vector, product);
+}
+
+template<> __MATVECPROD_SIGNATURE__(su2mixedfloat, MatrixVectorProductAdd) {
+  gemv_impl<su2mixedfloat,true,true,false>(nVar, matrix, vector, product);
+}
+
+template<> __MATVECPROD_SIGNATURE__(su2mixedfloat, MatrixVectorProductSub) {
+  gemv_impl<su2mixedfloat,false,true,false>(nVar, matrix, vector, product);
+}
+
+template<> __MATVECPROD_SIGNATURE__(su2mixedfloat, MatrixVectorProductTransp) {
+  gemv_impl<su2mixedfloat,true,true,true>(nVar, matrix, vector, product);
+}
+
+template<>
+FORCEINLINE void CSysMatrix<su2mixedfloat>::MatrixMatrixProduct(const su2mixedfloat *matrix_a, const su2mixedfloat *matrix_b,
+                                                                su2mixedfloat *product) const {
+  gemm_impl<su2mixedfloat>(nVar, matrix_a, matrix_b, product);
+}
+#endif
+
 #undef MATVECPROD_SIGNATURE
 #undef __MATVECPROD_SIGNATURE__
 
 template<class ScalarType>
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProductAdd(const ScalarType *matrix, const OtherType *vector,
+                                                                OtherType *product) const {
+  gemv_impl<OtherType,true,true,false>(nVar, matrix, vector, product);
+}
+
+template<class ScalarType>
+template<class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::MatrixVectorProductTransp(const ScalarType *matrix, const OtherType *vector,
+                                                                   OtherType *product) const {
+  gemv_impl<OtherType,true,true,true>(nVar, matrix, vector, product);
+}
+
+/*--- Block kernels of fixed size N (resolved at compilation), N = 0 falls back to the generic (possibly MKL) kernels. ---*/
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockVectorProduct(const ScalarType *matrix, const ScalarType *vector,
+                                                            ScalarType *product) const {
+  if (N) gemv_impl<ScalarType,true,false,false,ScalarType,N>(N, matrix, vector, product);
+  else MatrixVectorProduct(matrix, vector, product);
+}
+
+template<class ScalarType>
+template<size_t N, class OtherType>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockVectorProductAdd(const ScalarType *matrix, const OtherType *vector,
+                                                               OtherType *product) const {
+  if (N) gemv_impl<OtherType,true,true,false,ScalarType,N>(N, matrix, vector, product);
+  else MatrixVectorProductAdd(matrix, vector, product);
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockVectorProductSub(const ScalarType *matrix, const ScalarType *vector,
+                                                               ScalarType *product) const {
+  if (N) gemv_impl<ScalarType,false,true,false,ScalarType,N>(N, matrix, vector, product);
+  else MatrixVectorProductSub(matrix, vector, product);
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockMatrixProduct(const ScalarType *matrix_a, const ScalarType *matrix_b,
+                                                            ScalarType *product) const {
+  if (N) gemm_impl<ScalarType,N>(N, matrix_a, matrix_b, product);
+  else MatrixMatrixProduct(matrix_a, matrix_b, product);
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockGauss_Elimination(ScalarType* matrix, ScalarType* vec) const {
+  if (N) gauss_elim_impl<ScalarType,N>(N, matrix, vec);
+  else Gauss_Elimination(matrix, vec);
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::BlockMatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
+  if (N) matrix_inverse_impl<ScalarType,N>(N, matrix, inverse);
+  else MatrixInverse(matrix, inverse);
+}
+
+template<class ScalarType>
+template<size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::Gauss_Elimination(unsigned long block_i, ScalarType* rhs, bool transposed) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
   MatrixCopy(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
 
-  Gauss_Elimination(block, rhs);
+  BlockGauss_Elimination<N>(block, rhs);
 }
 
 template<class ScalarType>
+template<size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock(unsigned long block_i, ScalarType *invBlock, bool transposed) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
   MatrixCopy(&matrix[dia_ptr[block_i]*nVar*nVar], block, transposed);
 
-  MatrixInverse(block, invBlock);
+  BlockMatrixInverse<N>(block, invBlock);
 }
 
 template<class ScalarType>
+template<size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, ScalarType *invBlock) const {
 
   /*--- Copy block, as the algorithm modifies the matrix ---*/
   ScalarType block[MAXNVAR*MAXNVAR];
   MatrixCopy(&ILU_matrix[dia_ptr_ilu[block_i]*nVar*nVar], block, false);
 
-  MatrixInverse(block, invBlock);
+  BlockMatrixInverse<N>(block, invBlock);
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::FactorizeRow_ILUMatrix(unsigned long row_i, unsigned long begin,
+                                                                unsigned long end) {
+  ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[row_i]; index < dia_ptr_ilu[row_i]; index++) {
+
+    /*--- jPoint is the column index (jPoint < row_i). ---*/
+
+    auto jPoint = col_ind_ilu[index];
+
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+
+    if (jPoint < begin) continue;
+
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    BlockMatrixProduct<N>(Block_ij, &invM[jPoint*nVar*nVar], weight);
+
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+
+    for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+
+      /*--- Get the column index (kPoint > jPoint). ---*/
+
+      auto kPoint = col_ind_ilu[index_];
+
+      if (kPoint >= end) break;
+
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+      auto Block_ik = GetBlock_ILUMatrix(row_i, kPoint);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_*nVar*nVar];
+        BlockMatrixProduct<N>(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
+      Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- The diagonal block is now final, invert and store it to later compute the weights. ---*/
+
+  InverseDiagonalBlock_ILUMatrix<N>(row_i, &invM[row_i*nVar*nVar]);
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::ForwardRow_ILUMatrix(const CSysVector<ScalarType> & vec,
+                                                              CSysVector<ScalarType> & prod,
+                                                              unsigned long row_i, unsigned long col_lb) const {
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    prod[row_i*nVar+iVar] = vec[row_i*nVar+iVar];
+
+  for (auto index = row_ptr_ilu[row_i]; index < dia_ptr_ilu[row_i]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint < col_lb) continue;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    BlockVectorProductSub<N>(Block_ij, &prod[jPoint*nVar], &prod[row_i*nVar]);
+  }
+}
+
+template<class ScalarType>
+template<size_t N>
+FORCEINLINE void CSysMatrix<ScalarType>::BackwardRow_ILUMatrix(CSysVector<ScalarType> & prod, unsigned long row_i,
+                                                               unsigned long col_ub) const {
+  ScalarType aux_vec[MAXNVAR];
+
+  for (auto iVar = 0ul; iVar < nVar; iVar++)
+    aux_vec[iVar] = prod[row_i*nVar+iVar];
+
+  for (auto index = dia_ptr_ilu[row_i]+1; index < row_ptr_ilu[row_i+1]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint >= col_ub) break;
+    auto Block_ij = &ILU_matrix[index*nVar*nVar];
+    BlockVectorProductSub<N>(Block_ij, &prod[jPoint*nVar], aux_vec);
+  }
+
+  BlockVectorProduct<N>(&invM[row_i*nVar*nVar], aux_vec, &prod[row_i*nVar]);
 }
 
 template<class ScalarType>
+template<size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_ub, ScalarType *prod) const {
   unsigned long iVar, index, col_j;
@@ -235,11 +495,12 @@ FORCEINLINE void CSysMatrix<ScalarType>::UpperProduct(const CSysVector<ScalarTyp
   for (index = dia_ptr[row_i]+1; index < row_ptr[row_i+1]; index++) {
     col_j = col_ind[index];
     if (col_j < col_ub)
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
+      BlockVectorProductAdd<N>(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
   }
 }
 
 template<class ScalarType>
+template<size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarType> & vec, unsigned long row_i,
                                                       unsigned long col_lb, ScalarType *prod) const {
   unsigned long iVar, index, col_j;
@@ -249,13 +510,14 @@ FORCEINLINE void CSysMatrix<ScalarType>::LowerProduct(const CSysVector<ScalarTyp
   for (index = row_ptr[row_i]; index < dia_ptr[row_i]; index++) {
     col_j = col_ind[index];
     if (col_j >= col_lb)
-      MatrixVectorProductAdd(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
+      BlockVectorProductAdd<N>(&matrix[index*nVar*nVar], &vec[col_j*nVar], prod);
   }
 }
 
 template<class ScalarType>
+template<size_t N>
 FORCEINLINE void CSysMatrix<ScalarType>::DiagonalProduct(const CSysVector<ScalarType> & vec,
                                                          unsigned long row_i, ScalarType *prod) const {
 
-  MatrixVectorProduct(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod);
+  BlockVectorProduct<N>(&matrix[dia_ptr[row_i]*nVar*nVar], &vec[row_i*nVar], prod);
 }
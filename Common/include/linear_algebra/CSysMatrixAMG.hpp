@@ -0,0 +1,230 @@
+/*!
+ * \file CSysMatrixAMG.hpp
+ * \brief Smoothed aggregation algebraic multigrid for block-sparse matrices.
+ *        The subroutines and functions are in the <i>CSysMatrixAMG.cpp</i> file.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../datatype_structure.hpp"
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CSysMatrixAMG
+ * \brief Block-aware smoothed aggregation AMG hierarchy, applied as one V-cycle.
+ * \note The finest level is a view of the (domain part of the) BCSR data of a CSysMatrix,
+ *       the coarse levels, the prolongation (P) and restriction (R = P^T) operators are owned.
+ *       Aggregates are formed from the block strength of connection (Frobenius norm), the
+ *       tentative prolongation maps one identity block per aggregate, i.e. the near null space
+ *       is "constant per variable", which is then improved by one damped Jacobi step if the
+ *       matrix is symmetric (e.g. elasticity). For non-symmetric matrices (e.g. flow Jacobians)
+ *       smoothing P degrades the coarse operators, plain aggregation is used instead.
+ *       The hierarchy is local to each rank (like ILU), the setup runs on the master thread,
+ *       the cycle (block Jacobi smoothing and transfer operators) is thread-parallel and must
+ *       be called by all threads. The coarsest level is solved with a dense LU factorization.
+ */
+template<class ScalarType>
+class CSysMatrixAMG {
+private:
+  enum : unsigned long {MAXNVAR = 8};          /*!< \brief Maximum size of the blocks (same as CSysMatrix). */
+  enum : unsigned long {OMP_MAX_SIZE = 512};   /*!< \brief Max. chunk size of the parallel loops. */
+  enum : unsigned long {MAX_LEVELS = 20};      /*!< \brief Maximum number of levels of the hierarchy. */
+  enum : unsigned long {MAX_DENSE_SIZE = 1024}; /*!< \brief Max size (nVar x blocks) of the coarse LU. */
+  enum : unsigned long {MIN_COARSE_BLOCKS = 64}; /*!< \brief Stop coarsening below this number of blocks. */
+  enum : unsigned short {NU_PRE = 1};          /*!< \brief Number of pre smoothing sweeps. */
+  enum : unsigned short {NU_POST = 1};         /*!< \brief Number of post smoothing sweeps. */
+  enum : unsigned short {NU_COARSE = 10};      /*!< \brief Sweeps used on the coarsest level if too large for LU. */
+  enum : unsigned short {POWER_ITER = 15};     /*!< \brief Iterations used to estimate the spectral radius. */
+
+  static constexpr passivedouble THETA = 0.08;    /*!< \brief Threshold for the strength of connection. */
+  static constexpr passivedouble MAX_RATIO = 0.8; /*!< \brief Stop coarsening if a level does not shrink by this. */
+  static constexpr passivedouble SYM_TOL = 1e-6;  /*!< \brief Relative tolerance to consider the matrix symmetric. */
+
+  /*!
+   * \brief Block-compressed-row matrix with nVar x nVar blocks, (optionally) owning its data.
+   */
+  struct CBlockCSR {
+    unsigned long nRow = 0, nCol = 0;
+    const unsigned long *row_ptr = nullptr, *col_ind = nullptr, *dia_ptr = nullptr;
+    const ScalarType *values = nullptr;
+    vector<unsigned long> row_ptr_data, col_ind_data, dia_ptr_data;
+    vector<ScalarType> values_data;
+
+    /*!
+     * \brief Point the accessors to the owned data.
+     */
+    void SetOwned() {
+      row_ptr = row_ptr_data.data();
+      col_ind = col_ind_data.data();
+      dia_ptr = dia_ptr_data.empty()? nullptr : dia_ptr_data.data();
+      values = values_data.data();
+    }
+  };
+
+  /*!
+   * \brief One level of the hierarchy, the transfer operators connect it to the next (coarser) one.
+   */
+  struct CLevel {
+    CBlockCSR A;              /*!< \brief Operator of the level. */
+    CBlockCSR P;              /*!< \brief Prolongation from the next level. */
+    CBlockCSR R;              /*!< \brief Restriction to the next level. */
+    vector<ScalarType> invD;  /*!< \brief Inverse of the diagonal blocks of A. */
+    ScalarType omega = 1.0;   /*!< \brief Jacobi damping factor, 4/(3 rho(D^-1 A)). */
+    mutable vector<ScalarType> x, b, r; /*!< \brief Solution, right hand side, and residual (work vectors). */
+    unsigned long chunk = 1;  /*!< \brief Static chunk size for the thread-parallel loops. */
+  };
+
+  unsigned long nVar = 0;           /*!< \brief Size of the blocks. */
+  unsigned long nLevel = 0;         /*!< \brief Number of levels in use. */
+  vector<CLevel> levels;            /*!< \brief Levels of the hierarchy, 0 is the finest. */
+  vector<ScalarType> coarseLU;      /*!< \brief Dense LU factors of the coarsest operator. */
+  vector<unsigned long> coarsePivot;/*!< \brief Pivots of the coarse LU. */
+  bool coarseDirect = false;        /*!< \brief If the coarsest level is solved directly. */
+  bool smoothProlongation = true;   /*!< \brief Use smoothed (symmetric matrices) or plain aggregation. */
+
+  /*!
+   * \brief Block operations used by the setup and the cycle.
+   */
+  inline void BlockMatVec(const ScalarType* a, const ScalarType* b, ScalarType* c) const;
+  inline void BlockMatVecAdd(const ScalarType* a, const ScalarType* b, ScalarType* c) const;
+  inline void BlockMatVecSub(const ScalarType* a, const ScalarType* b, ScalarType* c) const;
+  inline void BlockMatMatAdd(const ScalarType* a, const ScalarType* b, ScalarType* c) const;
+  inline ScalarType BlockNorm(const ScalarType* a) const;
+
+  /*!
+   * \brief Invert a block (Gauss-Jordan with partial pivoting).
+   * \param[in] a - Block to invert.
+   * \param[out] inv - Its inverse.
+   */
+  void InvertBlock(const ScalarType* a, ScalarType* inv) const;
+
+  /*!
+   * \brief Compute the transpose of a block matrix (the blocks are also transposed).
+   * \param[in] A - Matrix, columns >= nCol are ignored.
+   * \param[out] At - Its transpose.
+   */
+  void Transpose(const CBlockCSR& A, CBlockCSR& At) const;
+
+  /*!
+   * \brief Compute the product of two block matrices, C = A * B.
+   * \param[in] A - Left operand, columns >= A.nCol are ignored.
+   * \param[in] B - Right operand.
+   * \param[out] C - Result, the diagonal pointer is set if C is square.
+   */
+  void Multiply(const CBlockCSR& A, const CBlockCSR& B, CBlockCSR& C) const;
+
+  /*!
+   * \brief Check if a matrix is (numerically) symmetric, i.e. ||A - A^T|| <= tol ||A||.
+   * \note Requires sorted column indices.
+   * \param[in] A - The matrix.
+   * \return True if symmetric.
+   */
+  bool IsSymmetric(const CBlockCSR& A) const;
+
+  /*!
+   * \brief Set the inverse diagonal and estimate the spectral radius of D^-1 A for a level.
+   * \param[in,out] level - The level.
+   */
+  void SetupSmoother(CLevel& level) const;
+
+  /*!
+   * \brief Aggregate the points of a level.
+   * \param[in] A - Operator of the level.
+   * \param[out] aggregate - Aggregate of each point.
+   * \return Number of aggregates.
+   */
+  unsigned long Aggregate(const CBlockCSR& A, vector<unsigned long>& aggregate) const;
+
+  /*!
+   * \brief Build the transfer operators of a level and the operator of the next.
+   * \param[in] iLevel - Level index.
+   * \return False if the level cannot be coarsened further.
+   */
+  bool Coarsen(unsigned long iLevel);
+
+  /*!
+   * \brief Factorize the operator of the coarsest level.
+   */
+  void FactorizeCoarse();
+
+  /*!
+   * \brief Damped block Jacobi sweeps, x += omega D^-1 (b - A x).
+   * \param[in] level - Level being smoothed.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution.
+   * \param[in] nSweep - Number of sweeps.
+   * \param[in] zeroGuess - Assume x is zero on entry.
+   */
+  void Smooth(const CLevel& level, const ScalarType* b, ScalarType* x,
+              unsigned short nSweep, bool zeroGuess) const;
+
+  /*!
+   * \brief Compute r = b - A x.
+   */
+  void Residual(const CLevel& level, const ScalarType* b, const ScalarType* x, ScalarType* r) const;
+
+  /*!
+   * \brief Recursive V-cycle.
+   * \param[in] iLevel - Current level.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Approximate solution.
+   */
+  void Cycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const;
+
+public:
+  /*!
+   * \brief Build the hierarchy (master thread only).
+   * \param[in] val_nVar - Size of the blocks.
+   * \param[in] nPointDomain - Number of rows, columns >= nPointDomain (halos) are ignored.
+   * \param[in] row_ptr - Row pointers of the matrix.
+   * \param[in] col_ind - Column indices of the matrix.
+   * \param[in] dia_ptr - Diagonal pointers of the matrix.
+   * \param[in] values - Coefficients of the matrix.
+   * \param[in] transposed - Build the hierarchy of the transpose of the matrix.
+   */
+  void Build(unsigned long val_nVar, unsigned long nPointDomain, const unsigned long* row_ptr,
+             const unsigned long* col_ind, const unsigned long* dia_ptr, const ScalarType* values,
+             bool transposed);
+
+  /*!
+   * \brief Apply one V-cycle to b (all threads).
+   * \param[in] b - Right hand side (domain part).
+   * \param[out] x - Approximate solution of Ax = b.
+   */
+  void Apply(const ScalarType* b, ScalarType* x) const;
+
+  /*!
+   * \brief Get the number of levels of the hierarchy.
+   */
+  inline unsigned long GetnLevel() const { return nLevel; }
+
+  /*!
+   * \brief Get the number of blocks of a level.
+   */
+  inline unsigned long GetnPoint(unsigned long iLevel) const { return levels[iLevel].A.nRow; }
+
+};
@@ -39,6 +39,9 @@
 #include <string>
 
 #include "CSysVector.hpp"
+#ifdef USE_MIXED_PRECISION
+#include "CSysMatrix.hpp"
+#endif
 
 class CConfig;
 class CGeometry;
@@ -81,6 +84,8 @@ private:
   mutable bool bcg_ready;    /*!< \brief Indicate if memory used by BCGSTAB is allocated. */
   mutable bool gmres_ready;  /*!< \brief Indicate if memory used by FGMRES is allocated. */
   mutable bool smooth_ready; /*!< \brief Indicate if memory used by SMOOTHER is allocated. */
+  mutable bool pgmres_ready; /*!< \brief Indicate if memory used by PIPELINED_GMRES is allocated. */
+  mutable bool pbcg_ready;   /*!< \brief Indicate if memory used by PIPELINED_BCGSTAB is allocated. */
 
   mutable VectorType r;      /*!< \brief Residual in CG and BCGSTAB. */
   mutable VectorType A_x;    /*!< \brief Result of matrix-vector product in CG and BCGSTAB. */
@@ -92,12 +97,27 @@ private:
 
   mutable vector<VectorType> W;  /*!< \brief Large matrix used by FGMRES, w^i+1 = A * z^i. */
   mutable vector<VectorType> Z;  /*!< \brief Large matrix used by FGMRES, preconditioned W. */
+  mutable vector<VectorType> AZ; /*!< \brief Products A * Z kept by the pipelined FGMRES. */
+  mutable vector<VectorType> P;  /*!< \brief Work vectors of the pipelined BCGSTAB. */
+
+  mutable vector<ScalarType> reduceBuf;         /*!< \brief Partial and reduced sums of the fused (non-blocking) reductions. */
+  mutable CBaseMPIWrapper::Request reduceReq;   /*!< \brief Request of the pending non-blocking reduction. */
 
   VectorType  LinSysSol_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType  LinSysRes_tmp;        /*!< \brief Temporary used when it is necessary to interface between active and passive types. */
   VectorType* LinSysSol_ptr;        /*!< \brief Pointer to appropriate LinSysSol (set to original or temporary in call to Solve). */
   const VectorType* LinSysRes_ptr;  /*!< \brief Pointer to appropriate LinSysRes (set to original or temporary in call to Solve). */
 
+  const ProductType* external_mat_vec = nullptr;  /*!< \brief Product used by Solve instead of the matrix (matrix-free methods). */
+  PrecondType* external_precond = nullptr;        /*!< \brief Preconditioner used by Solve instead of one built from the matrix. */
+
+#ifdef USE_MIXED_PRECISION
+  CSysMatrix<su2mixedfloat> PrecondMatrix;   /*!< \brief Lower precision copy of the matrix from which the preconditioners are built. */
+  bool PrecondMatrix_ready = false;          /*!< \brief Indicate if the structure of PrecondMatrix is allocated. */
+  CSysVector<su2mixedfloat> PrecondIn_tmp;   /*!< \brief Input of the lower precision preconditioner. */
+  CSysVector<su2mixedfloat> PrecondOut_tmp;  /*!< \brief Output of the lower precision preconditioner. */
+#endif
+
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -166,6 +186,23 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<VectorType> & w) const;
 
+  /*!
+   * \brief Start the reduction (sum over threads and ranks) of several scalars.
+   * \note Must be called by all threads, across ranks the reduction is non-blocking (for passive
+   *       types) such that it can be overlapped with work that does not depend on its result,
+   *       only one reduction may be pending at a time. See FinishReduction.
+   * \param[in] n - Number of scalars.
+   * \param[in] local - Contribution of the calling thread, e.g. from CSysVector::localDot.
+   */
+  void StartReduction(unsigned long n, const ScalarType* local) const;
+
+  /*!
+   * \brief Wait for the reduction started by StartReduction and get its result.
+   * \param[in] n - Number of scalars (as in StartReduction).
+   * \param[out] global - The reduced values, the same for all threads and ranks.
+   */
+  void FinishReduction(unsigned long n, ScalarType* global) const;
+
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -214,6 +251,20 @@ private:
    */
   void HandleTemporariesOut(CSysVector<su2double> & LinSysSol);
 
+  /*!
+   * \brief Create a preconditioner for the matrix.
+   * \note In mixed precision builds the preconditioner is built from, and applied with, a single precision
+   *       copy of the matrix (except for PaStiX), the matrix-vector products still use the matrix.
+   * \param[in] kind_prec - Type of preconditioner.
+   * \param[in] Jacobian - Matrix that defines the preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] transposed - If the transpose version of the preconditioner is required.
+   * \return Pointer to the new preconditioner, owned by the caller.
+   */
+  PrecondType* CreatePreconditioner(unsigned short kind_prec, MatrixType & Jacobian, CGeometry *geometry,
+                                    CConfig *config, bool transposed);
+
 public:
 
   /*!
@@ -269,6 +320,46 @@ public:
                                   const PrecondType & precond, ScalarType tol, unsigned long m,
                                   ScalarType & residual, bool monitoring, CConfig *config) const;
 
+  /*!
+   * \brief Pipelined Generalized Minimal Residual method
+   * \note The dot products of each iteration are fused into one non-blocking reduction which is
+   *       overlapped with the preconditioner and the matrix-vector product (p(1)-GMRES, classical
+   *       Gram-Schmidt with selective re-orthogonalization). Since the next Krylov vector is
+   *       preconditioned before it is orthogonalized, the preconditioner must be fixed (i.e. not
+   *       flexible), which is the case for all preconditioners in SU2.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PGMRES_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                  const PrecondType & precond, ScalarType tol, unsigned long m,
+                                  ScalarType & residual, bool monitoring, CConfig *config) const;
+
+  /*!
+   * \brief Pipelined Biconjugate Gradient Stabilized Method
+   * \note Preconditioned p-BiCGStab of Cools and Vanroose (2017), the dot products are fused into two
+   *       non-blocking reductions per iteration, each overlapped with one application of the
+   *       preconditioner and of the matrix, at the cost of more vector updates than BCGSTAB.
+   * \param[in] b - the right hand size vector
+   * \param[in,out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum number of iterations
+   * \param[out] residual - final normalized residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] config - Definition of the particular problem.
+   */
+  unsigned long PBCGSTAB_LinSolver(const VectorType & b, VectorType & x, const ProductType & mat_vec,
+                                   const PrecondType & precond, ScalarType tol, unsigned long m,
+                                   ScalarType & residual, bool monitoring, CConfig *config) const;
+
   /*!
    * \brief Generic smoother (modified Richardson iteration with preconditioner)
    * \param[in] b - the right hand size vector
@@ -287,6 +378,7 @@ public:
 
   /*!
    * \brief Solve the linear system using a Krylov subspace method
+   * \note In mixed precision builds only the preconditioner is applied in single precision, see CreatePreconditioner.
    * \param[in] Jacobian - Jacobian Matrix for the linear system
    * \param[in] LinSysRes - Linear system residual
    * \param[in,out] LinSysSol - Linear system solution
@@ -296,6 +388,22 @@ public:
   unsigned long Solve(MatrixType & Jacobian, const CSysVector<su2double> & LinSysRes, CSysVector<su2double> & LinSysSol,
                       CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Set a matrix-vector product to be used by Solve instead of the product with the matrix,
+   *        which is then only used to build the preconditioner (e.g. for Jacobian-free Newton-Krylov).
+   * \note The product is not owned by CSysSolve.
+   * \param[in] product - The matrix-vector product, nullptr to go back to the product with the matrix.
+   */
+  inline void SetMatrixFreeProduct(const ProductType* product) { external_mat_vec = product; }
+
+  /*!
+   * \brief Set a preconditioner to be used by Solve instead of one built from the matrix. Together with
+   *        SetMatrixFreeProduct this allows solving systems whose matrix is not allocated.
+   * \note The preconditioner is not owned by CSysSolve, Solve calls its Build method.
+   * \param[in] precond - The preconditioner, nullptr to go back to the preconditioners of the matrix.
+   */
+  inline void SetMatrixFreePreconditioner(PrecondType* precond) { external_precond = precond; }
+
   /*!
    * \brief Solve the adjoint linear system using a Krylov subspace method
    * \param[in] Jacobian - Jacobian Matrix for the linear system
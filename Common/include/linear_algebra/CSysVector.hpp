@@ -258,6 +258,15 @@ public:
    */
   ScalarType dot(const CSysVector & u) const;
 
+  /*!
+   * \brief Contribution of the calling thread to the dot product between "this" and another vector.
+   * \note No reduction is performed (over threads or ranks), this is used to fuse several
+   *       dot products into a single reduction, e.g. by the pipelined Krylov solvers.
+   * \param[in] u - Another vector.
+   * \return partial result of the dot product
+   */
+  ScalarType localDot(const CSysVector & u) const;
+
   /*!
    * \brief squared L2 norm of the vector (via dot with self)
    * \return squared L2 norm
@@ -282,6 +291,11 @@ public:
    */
   inline const ScalarType & operator[](unsigned long i) const { return vec_val[i]; }
 
+  /*!
+   * \brief Pointer to the values (block after block).
+   */
+  inline const ScalarType* data() const { return vec_val; }
+
   /*!
    * \brief copies the contents of the calling CSysVector into an array
    * \param[out] u_array - array into which information is being copied
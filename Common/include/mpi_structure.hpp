@@ -80,6 +80,12 @@ class CBaseMPIWrapper;
 template<> struct SelectMPIWrapper<passivedouble> { typedef CBaseMPIWrapper W; };
 #endif
 
+/*--- The single precision type of mixed precision builds is always passive. ---*/
+#ifdef USE_MIXED_PRECISION
+class CBaseMPIWrapper;
+template<> struct SelectMPIWrapper<su2mixedfloat> { typedef CBaseMPIWrapper W; };
+#endif
+
 /*!
  * \class CMPIWrapper
  * \brief Class for defining the MPI wrapper routines; this class features as a base class for
@@ -172,6 +178,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request *request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -412,6 +421,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request *request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -231,6 +231,11 @@ inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
 }
 
+inline void CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request *request) {
+  MPI_Iallreduce(sendbuf,recvbuf,count,datatype,op,comm,request);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                                 void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm) {
   MPI_Gather(sendbuf,sendcnt,sendtype,recvbuf,recvcnt,recvtype,root,comm);
@@ -591,6 +596,11 @@ inline void  CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
    CopyData(sendbuf, recvbuf, count, datatype);
 }
 
+inline void  CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                     Datatype datatype, Op op, Comm comm, Request *request){
+   CopyData(sendbuf, recvbuf, count, datatype);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                    void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm){
   CopyData(sendbuf, recvbuf, sendcnt, sendtype);
@@ -133,6 +133,30 @@ const int SU2_CONN_SIZE   = 10;  /*!< \brief Size of the connectivity array that
                                              that we read from a mesh file in the format [[globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. */
 const int SU2_CONN_SKIP   = 2;   /*!< \brief Offset to skip the globalID and VTK type at the start of the element connectivity list for each CGNS element. */
 
+const int SU2_COMPRESSED_RESTART_MAGIC = 535533; /*!< \brief First entry of binary restart files written in blocks (reduced precision and/or compression), 535532 is the plain format. */
+
+const unsigned long SU2_BINARY_MESH_MAGIC   = 53553242; /*!< \brief Hex representation of "SU2B", first entry of each zone of a binary SU2 mesh. */
+const unsigned long SU2_BINARY_MESH_VERSION = 1;        /*!< \brief Version of the binary SU2 mesh format. */
+
+/*!
+ * \brief Entries of the zone header of the binary SU2 mesh format (all unsigned long), offsets are in bytes from the start of the file.
+ */
+enum ENUM_SU2_BINARY_HEADER {
+  BIN_MESH_MAGIC         = 0,   /*!< \brief SU2_BINARY_MESH_MAGIC. */
+  BIN_MESH_VERSION       = 1,   /*!< \brief SU2_BINARY_MESH_VERSION. */
+  BIN_MESH_IZONE         = 2,   /*!< \brief Index of the zone. */
+  BIN_MESH_NZONE         = 3,   /*!< \brief Number of zones in the file. */
+  BIN_MESH_NDIM          = 4,   /*!< \brief Dimension of the zone. */
+  BIN_MESH_NPOIN         = 5,   /*!< \brief Number of points. */
+  BIN_MESH_NELEM         = 6,   /*!< \brief Number of volume elements. */
+  BIN_MESH_NMARK         = 7,   /*!< \brief Number of markers. */
+  BIN_MESH_MARKER_OFFSET = 8,   /*!< \brief Start of the marker section. */
+  BIN_MESH_POINT_OFFSET  = 9,   /*!< \brief Start of the point coordinates (nPoint x nDim doubles). */
+  BIN_MESH_ELEM_OFFSET   = 10,  /*!< \brief Start of the volume elements (nElem x SU2_CONN_SIZE unsigned longs). */
+  BIN_MESH_NEXT_ZONE     = 11,  /*!< \brief Start of the next zone (end of file for the last zone). */
+  SU2_BINARY_HEADER_SIZE = 16   /*!< \brief Size of the header, the last entries are reserved. */
+};
+
 /*!
  * \brief Boolean answers
  */
@@ -1586,13 +1610,15 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief SU2 binary input format. */
 };
 static const MapType<string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
 };
 
 /*!
@@ -1818,6 +1844,8 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER = 8,             /*!< \brief Iterative smoother. */
   PASTIX_LDLT = 9,          /*!< \brief PaStiX LDLT (complete) factorization. */
   PASTIX_LU = 10,           /*!< \brief PaStiX LU (complete) factorization. */
+  PIPELINED_GMRES = 11,     /*!< \brief Generalized Minimal Residual method with communication hiding (not flexible, fused non-blocking reductions). */
+  PIPELINED_BCGSTAB = 12,   /*!< \brief Biconjugate Gradient Stabilized method with communication hiding. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1830,6 +1858,36 @@ static const MapType<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = {
   MakePair("SMOOTHER", SMOOTHER)
   MakePair("PASTIX_LDLT", PASTIX_LDLT)
   MakePair("PASTIX_LU", PASTIX_LU)
+  MakePair("PIPELINED_GMRES", PIPELINED_GMRES)
+  MakePair("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB)
+};
+
+/*!
+ * \brief Renumbering of the grid points (local to each rank) applied during preprocessing.
+ */
+enum ENUM_POINT_ORDERING {
+  RCM_ORDERING = 0,      /*!< \brief Reverse Cuthill-McKee, minimizes the bandwidth of the matrices. */
+  HILBERT_ORDERING = 1,  /*!< \brief Sort the points along a Hilbert space filling curve. */
+  MORTON_ORDERING = 2,   /*!< \brief Sort the points along a Morton (Z-order) space filling curve. */
+};
+static const MapType<string, ENUM_POINT_ORDERING> Point_Ordering_Map = {
+  MakePair("RCM", RCM_ORDERING)
+  MakePair("HILBERT", HILBERT_ORDERING)
+  MakePair("MORTON", MORTON_ORDERING)
+};
+
+/*!
+ * \brief Numbering of the edges of the dual grid.
+ */
+enum ENUM_EDGE_ORDERING {
+  NATURAL_EDGES = 0,       /*!< \brief Order in which the edges are found when looping over points. */
+  SORTED_EDGES = 1,        /*!< \brief Sorted by their (min point, max point) pair. */
+  COLOR_TILED_EDGES = 2,   /*!< \brief Sorted, then the edges of each color are made contiguous. */
+};
+static const MapType<string, ENUM_EDGE_ORDERING> Edge_Ordering_Map = {
+  MakePair("NATURAL", NATURAL_EDGES)
+  MakePair("SORTED", SORTED_EDGES)
+  MakePair("COLOR_TILED", COLOR_TILED_EDGES)
 };
 
 /*!
@@ -1889,6 +1947,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   PASTIX_ILU= 5,     /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P= 6,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P= 7,  /*!< \brief PaStiX LDLT as preconditioner. */
+  AMG = 8,           /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
 };
 static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("JACOBI", JACOBI)
@@ -1898,6 +1957,7 @@ static const MapType<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = {
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
+  MakePair("AMG", AMG)
 };
 
 /*!
@@ -0,0 +1,80 @@
+/*!
+ * \file compression_toolbox.hpp
+ * \brief Lossless compression of binary output blocks (byte shuffle and LZ4 block format).
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * \brief Self-contained compression routines, the compressed blocks follow the LZ4 block format
+ *        (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md) and can be decoded by any
+ *        LZ4 implementation. Blocks are independent (no dictionary) so they can be decoded in parallel.
+ */
+namespace CompressionToolbox {
+
+/*!
+ * \brief Group the bytes of an array of elements by significance, i.e. first the byte 0 of all elements,
+ *        then byte 1, etc. For floating point data the sign and exponent bytes become long runs of (nearly)
+ *        equal values, which the LZ4 matching can exploit whereas it cannot in the interleaved layout.
+ * \param[in] src - Elements to shuffle.
+ * \param[in] nElem - Number of elements.
+ * \param[in] elemSize - Size of each element in bytes.
+ * \param[out] dst - Shuffled bytes (nElem*elemSize, must not overlap src).
+ */
+void ByteShuffle(const uint8_t* src, size_t nElem, size_t elemSize, uint8_t* dst);
+
+/*!
+ * \brief Inverse of ByteShuffle.
+ * \param[in] src - Shuffled bytes.
+ * \param[in] nElem - Number of elements.
+ * \param[in] elemSize - Size of each element in bytes.
+ * \param[out] dst - Elements (nElem*elemSize, must not overlap src).
+ */
+void ByteUnshuffle(const uint8_t* src, size_t nElem, size_t elemSize, uint8_t* dst);
+
+/*!
+ * \brief Compress a block of data with a greedy (fast) LZ4 matcher.
+ * \param[in] src - Data to compress.
+ * \param[in] srcSize - Size of the data in bytes (less than 4GB).
+ * \param[out] dst - Compressed block.
+ * \param[in] dstCapacity - Size of dst in bytes.
+ * \return Size of the compressed block, 0 if it does not fit in dstCapacity.
+ */
+size_t LZ4Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+
+/*!
+ * \brief Decompress a LZ4 block whose decompressed size is known.
+ * \param[in] src - Compressed block.
+ * \param[in] srcSize - Size of the compressed block in bytes.
+ * \param[out] dst - Decompressed data.
+ * \param[in] dstSize - Size of the decompressed data in bytes.
+ * \return False if the block is corrupted or does not decompress to exactly dstSize bytes.
+ */
+bool LZ4Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+
+}
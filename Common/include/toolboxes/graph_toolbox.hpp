@@ -254,8 +254,17 @@ template<typename Index_t>
 using CEdgeToNonZeroMap = C2DContainer<unsigned long, Index_t, StorageType::RowMajor, 64, DynamicSize, 2>;
 
 
+/*!
+ * \brief Alias a type of compressed pattern as the element map class, for each element
+ *        (outer index) it stores the non zero entries of a sparse pattern referenced by
+ *        each pair of nodes of the element (inner indices, nNode^2 per element).
+ */
+template<typename Index_t>
+using CElemToNonZeroMap = CCompressedSparsePattern<Index_t>;
+
 using CCompressedSparsePatternUL = CCompressedSparsePattern<unsigned long>;
 using CEdgeToNonZeroMapUL = CEdgeToNonZeroMap<unsigned long>;
+using CElemToNonZeroMapUL = CElemToNonZeroMap<unsigned long>;
 
 
 /*!
@@ -384,6 +393,50 @@ CEdgeToNonZeroMap<Index_t> mapEdgesToSparsePattern(Geometry_t& geometry,
 }
 
 
+/*!
+ * \brief Build a lookup table of the absolute positions of the non zero entries
+ *        of a compressed sparse pattern, accessed when visiting the FEM elements
+ *        of a grid. For each element the positions of the entries (i,j) for all
+ *        pairs of its nodes are stored in row major order, i.e. the entry of nodes
+ *        iNode and jNode is at iNode*nNode+jNode, relative to the start of the element.
+ *        The table can then be used to assemble element matrices without searches.
+ * \param[in] geometry - Definition of the grid.
+ * \param[in] pattern - Sparse pattern (FEM type).
+ * \return Element map, the elements are the outer indices.
+ */
+template<class Geometry_t, typename Index_t>
+CElemToNonZeroMap<Index_t> mapElemsToSparsePattern(Geometry_t& geometry,
+                                                   const CCompressedSparsePattern<Index_t>& pattern)
+{
+  assert(!pattern.empty());
+
+  const Index_t nElem = geometry.GetnElem();
+
+  su2vector<Index_t> outerPtr(nElem+1);
+  outerPtr(0) = 0;
+  for(Index_t iElem = 0; iElem < nElem; ++iElem)
+  {
+    const Index_t nNode = geometry.elem[iElem]->GetnNodes();
+    outerPtr(iElem+1) = outerPtr(iElem) + nNode*nNode;
+  }
+
+  su2vector<Index_t> innerIdx(outerPtr(nElem));
+
+  for(Index_t iElem = 0; iElem < nElem; ++iElem)
+  {
+    const auto elem = geometry.elem[iElem];
+    const Index_t nNode = elem->GetnNodes();
+
+    for(Index_t iNode = 0; iNode < nNode; ++iNode)
+      for(Index_t jNode = 0; jNode < nNode; ++jNode)
+        innerIdx(outerPtr(iElem) + iNode*nNode + jNode) =
+          pattern.quickFindInnerIdx(elem->GetNode(iNode), elem->GetNode(jNode));
+  }
+
+  return CElemToNonZeroMap<Index_t>(std::move(outerPtr), std::move(innerIdx));
+}
+
+
 /*!
  * \brief Color contiguous groups of outer indices of a sparse pattern such that
  *        within each color, any two groups do not have inner indices in common.
@@ -520,6 +573,62 @@ T colorSparsePattern(const T& pattern, size_t groupSize = 1, bool balanceColors
 }
 
 
+/*!
+ * \brief Group the outer indices of a (square) sparse pattern in levels (wavefronts) such
+ *        that the indices of a level only depend on indices of previous levels.
+ * \note  Outer index i depends on inner index j if j < i when scheduling a forward sweep
+ *        (lower triangular part), or if j > i for a backward sweep (upper triangular part).
+ *        Processing the levels in order, and the indices within a level in any order (e.g.
+ *        in parallel), gives the same result as the sequential sweep, which makes this
+ *        suitable for Gauss-Seidel-type sweeps and incomplete factorizations.
+ *        As for the coloring, the levels are returned as a compressed sparse pattern where
+ *        the levels are the outer indices, the indices within a level are in ascending order.
+ * \param[in] pattern - Sparse pattern (e.g. of a matrix).
+ * \param[in] numOuter - Only the first numOuter outer indices are scheduled, inner indices
+ *            larger or equal to this (e.g. halo points) are not dependencies.
+ * \param[in] lower - Schedule the forward (true) or the backward (false) sweep.
+ * \return Level schedule in the same type of the input pattern.
+ */
+template<class T>
+T levelSchedulePattern(const T& pattern, typename T::IndexType numOuter, bool lower)
+{
+  using Index_t = typename T::IndexType;
+
+  assert(numOuter <= pattern.getOuterSize());
+
+  /*--- Level of each outer index, one more than the highest level of its dependencies. ---*/
+  std::vector<Index_t> level(numOuter, 0);
+  Index_t nLevel = (numOuter > 0);
+
+  for(Index_t k = 0; k < numOuter; ++k)
+  {
+    const Index_t iOuter = lower? k : numOuter-1-k;
+
+    for(Index_t iNZ = 0; iNZ < pattern.getNumNonZeros(iOuter); ++iNZ)
+    {
+      const Index_t jOuter = pattern.getInnerIdx(iOuter, iNZ);
+      const bool depends = lower? (jOuter < iOuter) : (jOuter > iOuter && jOuter < numOuter);
+      if(depends) level[iOuter] = std::max(level[iOuter], level[jOuter]+1);
+    }
+    nLevel = std::max(nLevel, level[iOuter]+1);
+  }
+
+  /*--- Compress the level information (counting sort). ---*/
+
+  su2vector<Index_t> levelPtr(nLevel+1);
+  for(Index_t iLevel = 0; iLevel <= nLevel; ++iLevel) levelPtr(iLevel) = 0;
+  for(Index_t iOuter = 0; iOuter < numOuter; ++iOuter) ++levelPtr(level[iOuter]+1);
+  for(Index_t iLevel = 0; iLevel < nLevel; ++iLevel) levelPtr(iLevel+1) += levelPtr(iLevel);
+
+  su2vector<Index_t> outerIdx(numOuter);
+  std::vector<Index_t> pos(levelPtr.data(), levelPtr.data()+nLevel);
+  for(Index_t iOuter = 0; iOuter < numOuter; ++iOuter)
+    outerIdx(pos[level[iOuter]]++) = iOuter;
+
+  return T(std::move(levelPtr), std::move(outerIdx));
+}
+
+
 /*!
  * \brief Create the natural coloring (equivalent to the normal sequential loop
  *        order) for a given number of inner indexes.
@@ -0,0 +1,148 @@
+/*!
+ * \file parsing_toolbox.hpp
+ * \brief Allocation free parsing of numbers from ASCII buffers (used by the mesh readers).
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+
+/*!
+ * \namespace ParsingToolbox
+ * \brief Functions in the style of std::from_chars, they read a number at the position of a
+ *        character pointer and advance the pointer past it. The buffers must be null-terminated.
+ */
+namespace ParsingToolbox {
+
+/*!
+ * \brief Skip spaces, tabs, and carriage returns (line feeds are not skipped).
+ * \param[in,out] p - Position in the buffer.
+ */
+inline void SkipBlanks(const char*& p) {
+  while (*p == ' ' || *p == '\t' || *p == '\r') ++p;
+}
+
+/*!
+ * \brief Move to the start of the next line.
+ * \param[in,out] p - Position in the buffer.
+ */
+inline void SkipLine(const char*& p) {
+  while (*p != '\n' && *p != '\0') ++p;
+  if (*p == '\n') ++p;
+}
+
+/*!
+ * \brief Parse a non-negative integer.
+ * \param[in,out] p - Position in the buffer, leading blanks are skipped.
+ * \param[out] value - The number.
+ * \return False if there is no number at the position.
+ */
+inline bool ParseUnsigned(const char*& p, unsigned long& value) {
+  SkipBlanks(p);
+  if (*p < '0' || *p > '9') return false;
+  unsigned long v = 0;
+  for (; *p >= '0' && *p <= '9'; ++p) v = 10*v + (*p - '0');
+  value = v;
+  return true;
+}
+
+/*!
+ * \brief Parse a floating point number.
+ * \note Decimal mantissas that fit in 53 bits, with small exponents, are converted exactly
+ *       with one floating point operation (the result is the correctly rounded value), the
+ *       remaining cases fall back to strtod. Trailing zeros do not count towards the 53 bits.
+ * \param[in,out] p - Position in the buffer, leading blanks are skipped.
+ * \param[out] value - The number.
+ * \return False if there is no number at the position.
+ */
+inline bool ParseDouble(const char*& p, double& value) {
+
+  static const double powersOf10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                      1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                      1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  SkipBlanks(p);
+  const char* start = p;
+
+  bool negative = false;
+  if (*p == '-' || *p == '+') negative = (*p++ == '-');
+
+  /*--- Digits are accumulated in an integer mantissa, zeros are only
+   multiplied in when followed by a non-zero digit. ---*/
+
+  uint64_t mantissa = 0;
+  int nDigits = 0, nZeros = 0, exponent = 0;
+  bool anyDigit = false, exact = true, fraction = false;
+
+  for (;; ++p) {
+    if (*p == '.' && !fraction) { fraction = true; continue; }
+    if (*p < '0' || *p > '9') break;
+    anyDigit = true;
+    exponent -= fraction;
+    if (*p == '0') {
+      nZeros += (mantissa != 0);
+      continue;
+    }
+    nDigits += nZeros+1;
+    if (nDigits > 19) { exact = false; continue; }
+    for (; nZeros > 0; --nZeros) mantissa *= 10;
+    mantissa = 10*mantissa + (*p - '0');
+  }
+  exponent += nZeros;
+
+  if (!anyDigit) {
+    /*--- Not a decimal number (e.g. inf or nan), let the C library decide. ---*/
+    char* end = nullptr;
+    value = strtod(start, &end);
+    p = end;
+    return end != start;
+  }
+
+  if (*p == 'e' || *p == 'E') {
+    const char* q = p+1;
+    bool negExp = false;
+    if (*q == '-' || *q == '+') negExp = (*q++ == '-');
+    if (*q >= '0' && *q <= '9') {
+      int e = 0;
+      for (; *q >= '0' && *q <= '9'; ++q) e = (e < 10000)? 10*e + (*q - '0') : e;
+      exponent += negExp? -e : e;
+      p = q;
+    }
+  }
+
+  if (exact && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) {
+    const double m = double(mantissa);
+    value = (exponent < 0)? m / powersOf10[-exponent] : m * powersOf10[exponent];
+    if (negative) value = -value;
+    return true;
+  }
+
+  char* end = nullptr;
+  value = strtod(start, &end);
+  p = end;
+  return true;
+}
+
+}
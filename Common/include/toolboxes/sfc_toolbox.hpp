@@ -0,0 +1,154 @@
+/*!
+ * \file sfc_toolbox.hpp
+ * \brief Space filling curves (Morton and Hilbert) used to order points for data locality.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+namespace SFCToolbox {
+
+/*!
+ * \brief Number of bits used per coordinate, such that the key fits in 64 bits.
+ * \param[in] nDim - Number of dimensions (2 or 3).
+ */
+inline unsigned short BitsPerDim(unsigned short nDim) { return (nDim == 2)? 32 : 21; }
+
+/*!
+ * \brief Interleave the bits of the (quantized) coordinates, most significant first.
+ * \param[in] X - Quantized coordinates.
+ * \param[in] nDim - Number of dimensions.
+ * \return The interleaved key.
+ */
+inline uint64_t InterleaveBits(const uint32_t* X, unsigned short nDim) {
+  uint64_t key = 0;
+  for (int iBit = BitsPerDim(nDim)-1; iBit >= 0; --iBit)
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      key = (key << 1) | ((X[iDim] >> iBit) & 1u);
+  return key;
+}
+
+/*!
+ * \brief Position of a point along the Morton (Z-order) curve.
+ * \param[in] X - Quantized coordinates.
+ * \param[in] nDim - Number of dimensions.
+ */
+inline uint64_t MortonKey(const uint32_t* X, unsigned short nDim) { return InterleaveBits(X, nDim); }
+
+/*!
+ * \brief Position of a point along the Hilbert curve.
+ * \note Uses the "transpose" algorithm of J. Skilling, AIP Conf. Proc. 707, 381 (2004),
+ *       the coordinates are converted in place to the transposed Hilbert index which is then
+ *       interleaved like a Morton key. Unlike the Morton curve, consecutive keys are always
+ *       face neighbors, which avoids the large jumps at the boundaries of the Z blocks.
+ * \param[in] Xin - Quantized coordinates.
+ * \param[in] nDim - Number of dimensions.
+ */
+inline uint64_t HilbertKey(const uint32_t* Xin, unsigned short nDim) {
+  uint32_t X[3] = {0, 0, 0};
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X[iDim] = Xin[iDim];
+
+  const uint32_t M = 1u << (BitsPerDim(nDim)-1);
+
+  /*--- Inverse undo. ---*/
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q-1;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      if (X[iDim] & Q) {
+        X[0] ^= P;
+      } else {
+        const uint32_t t = (X[0] ^ X[iDim]) & P;
+        X[0] ^= t; X[iDim] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encode. ---*/
+  for (unsigned short iDim = 1; iDim < nDim; ++iDim) X[iDim] ^= X[iDim-1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+    if (X[nDim-1] & Q) t ^= Q-1;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) X[iDim] ^= t;
+
+  return InterleaveBits(X, nDim);
+}
+
+/*!
+ * \brief Sort a set of points along a space filling curve.
+ * \param[in] nPoint - Number of points.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] coord - Functor returning coordinate iDim of point iPoint, coord(iPoint, iDim).
+ * \param[in] hilbert - Use the Hilbert curve (true) or the Morton curve (false).
+ * \return Permutation, position i of the sorted sequence is point perm[i].
+ */
+template<class CoordFunc>
+std::vector<unsigned long> SortPoints(unsigned long nPoint, unsigned short nDim,
+                                      const CoordFunc& coord, bool hilbert) {
+  using std::vector;
+
+  /*--- Bounding box, the same scale is used in all directions to preserve the aspect ratio. ---*/
+  double xmin[3] = {0.0, 0.0, 0.0}, range = 0.0;
+
+  if (nPoint) {
+    double xmax[3] = {0.0, 0.0, 0.0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      xmin[iDim] = xmax[iDim] = coord(0, iDim);
+
+    for (unsigned long iPoint = 1; iPoint < nPoint; ++iPoint) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        xmin[iDim] = std::min(xmin[iDim], double(coord(iPoint, iDim)));
+        xmax[iDim] = std::max(xmax[iDim], double(coord(iPoint, iDim)));
+      }
+    }
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      range = std::max(range, xmax[iDim]-xmin[iDim]);
+  }
+
+  /*--- Quantize the coordinates and compute the keys. ---*/
+  const double maxInt = double((uint64_t(1) << BitsPerDim(nDim)) - 1);
+  const double scale = (range > 0.0)? maxInt/range : 0.0;
+
+  vector<uint64_t> key(nPoint);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    uint32_t X[3] = {0, 0, 0};
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      X[iDim] = uint32_t(std::min(maxInt, (double(coord(iPoint, iDim))-xmin[iDim])*scale));
+    key[iPoint] = hilbert? HilbertKey(X, nDim) : MortonKey(X, nDim);
+  }
+
+  /*--- Sort, ties (coincident points) keep their original relative order. ---*/
+  vector<unsigned long> perm(nPoint);
+  std::iota(perm.begin(), perm.end(), 0ul);
+  std::stable_sort(perm.begin(), perm.end(),
+                   [&key](unsigned long a, unsigned long b) { return key[a] < key[b]; });
+  return perm;
+}
+
+}
@@ -34,6 +34,7 @@
 
 #include "../include/ad_structure.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
+#include "../include/omp_structure.hpp"
 
 using namespace PrintingToolbox;
 
@@ -527,6 +528,24 @@ void CConfig::addPythonOption(const string name) {
   option_map.insert(pair<string, COptionBase *>(name, val));
 }
 
+/*!
+ * \brief Read the header of the first zone of a binary SU2 mesh.
+ * \param[in] val_mesh_filename - Name of the mesh file.
+ * \param[out] header - Entries of the header, see ENUM_SU2_BINARY_HEADER.
+ */
+static void ReadSU2BinaryMeshHeader(const string& val_mesh_filename, unsigned long* header) {
+
+  FILE *mesh_file = fopen(val_mesh_filename.c_str(), "rb");
+  if (!mesh_file)
+    SU2_MPI::Error(string("There is no geometry file called ") + val_mesh_filename, CURRENT_FUNCTION);
+
+  const size_t ret = fread(header, sizeof(unsigned long), SU2_BINARY_HEADER_SIZE, mesh_file);
+  fclose(mesh_file);
+
+  if ((ret != SU2_BINARY_HEADER_SIZE) || (header[BIN_MESH_MAGIC] != SU2_BINARY_MESH_MAGIC))
+    SU2_MPI::Error(val_mesh_filename + string(" is not an SU2 binary mesh file."), CURRENT_FUNCTION);
+}
+
 unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_format) {
 
   int nZone = 1; /* Default value if nothing is specified. */
@@ -635,6 +654,12 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
 
       break;
     }
+    case SU2_BINARY: {
+      unsigned long header[SU2_BINARY_HEADER_SIZE];
+      ReadSU2BinaryMeshHeader(val_mesh_filename, header);
+      nZone = header[BIN_MESH_NZONE];
+      break;
+    }
     case RECTANGLE: {
       nZone = 1;
       break;
@@ -745,6 +770,12 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
 
       break;
     }
+    case SU2_BINARY: {
+      unsigned long header[SU2_BINARY_HEADER_SIZE];
+      ReadSU2BinaryMeshHeader(val_mesh_filename, header);
+      nDim = header[BIN_MESH_NDIM];
+      break;
+    }
     case RECTANGLE: {
       nDim = 2;
       break;
@@ -1014,6 +1045,7 @@ void CConfig::SetPointersNull(void) {
   HistoryOutput = NULL;
   VolumeOutput = NULL;
   VolumeOutputFiles = NULL;
+  Restart_SinglePrecision = NULL;
   ConvField = NULL;
 
   /*--- Variable initialization ---*/
@@ -1667,6 +1699,18 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("LINEAR_SOLVER_SMOOTHER_RELAXATION", Linear_Solver_Smoother_Relaxation, 1.0);
   /* DESCRIPTION: Custom number of threads used for additive domain decomposition for ILU and LU_SGS (0 is "auto"). */
   addUnsignedLongOption("LINEAR_SOLVER_PREC_THREADS", Linear_Solver_Prec_Threads, 0);
+  /* DESCRIPTION: Thread-parallelize ILU and LU_SGS with level scheduling (exact) instead of domain decomposition (approximate). */
+  addBoolOption("LINEAR_SOLVER_PREC_LEVEL_SCHEDULING", Linear_Solver_Prec_Level_Scheduling, false);
+  /* DESCRIPTION: Solve the flow equations with matrix-free Newton-Krylov, the Jacobian is only used by the preconditioner. */
+  addBoolOption("NEWTON_KRYLOV", NewtonKrylov, false);
+  /* DESCRIPTION: Number of iterations with the assembled Jacobian before switching to Newton-Krylov. */
+  addUnsignedLongOption("NEWTON_KRYLOV_STARTUP_ITER", NewtonKrylov_Startup_Iter, 0);
+  /* DESCRIPTION: Relative step of the finite differences of the matrix-free Jacobian-vector products. */
+  addDoubleOption("NEWTON_KRYLOV_FD_STEP", NewtonKrylov_FD_Step, 1e-7);
+  /* DESCRIPTION: Apply the linear elasticity operator (FEA and mesh deformation) element by element, without assembling the stiffness matrix. */
+  addBoolOption("MATRIX_FREE_ELASTICITY", MatrixFree_Elasticity, false);
+  /* DESCRIPTION: Degree of the Chebyshev preconditioner of the matrix-free elasticity operator, 0 for block Jacobi. */
+  addUnsignedShortOption("MATRIX_FREE_CHEBYSHEV_DEGREE", MatrixFree_Chebyshev_Degree, 0);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
   addDoubleOption("RELAXATION_FACTOR_ADJFLOW", Relaxation_Factor_AdjFlow, 1.0);
   /* DESCRIPTION: Relaxation of the CHT coupling */
@@ -1757,6 +1801,12 @@ void CConfig::SetConfig_Options() {
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients used only for upwind reconstruction \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: NO_GRADIENT. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD_RECON", Kind_Gradient_Method_Recon, Gradient_Map, NO_GRADIENT);
+  /*!\brief LEAST_SQUARES_CACHE
+   *  \n DESCRIPTION: Precompute the geometric weights of the least-squares gradients, recomputed only when the grid moves. DEFAULT: NO \ingroup Config*/
+  addBoolOption("LEAST_SQUARES_CACHE", LeastSquares_Cache, false);
+  /*!\brief FUSED_RECONSTRUCTION
+   *  \n DESCRIPTION: Compute the reconstruction gradients, limiters, and MUSCL states of the flow in one pass. DEFAULT: NO \ingroup Config*/
+  addBoolOption("FUSED_RECONSTRUCTION", Fused_Reconstruction, false);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1919,17 +1969,19 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format, SU2 (ASCII) or SU2_BINARY. \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
 
   /* DESCRIPTION: List of the length of the RECTANGLE or BOX grid in the x,y,z directions. (default: (1.0,1.0,1.0) ).  */
-  array<su2double, 3> default_mesh_box_length = {{1.0, 1.0, 1.0}};
-  addDoubleArrayOption("MESH_BOX_LENGTH", 3, Mesh_Box_Length, default_mesh_box_length.data());
+  default_mesh_box_length[0] = 1.0; default_mesh_box_length[1] = 1.0; default_mesh_box_length[2] = 1.0;
+  addDoubleArrayOption("MESH_BOX_LENGTH", 3, Mesh_Box_Length, default_mesh_box_length);
 
   /* DESCRIPTION: List of the offset from 0.0 of the RECTANGLE or BOX grid in the x,y,z directions. (default: (0.0,0.0,0.0) ). */
-  array<su2double, 3> default_mesh_box_offset = {{0.0, 0.0, 0.0}};
-  addDoubleArrayOption("MESH_BOX_OFFSET", 3, Mesh_Box_Offset, default_mesh_box_offset.data());
+  default_mesh_box_offset[0] = 0.0; default_mesh_box_offset[1] = 0.0; default_mesh_box_offset[2] = 0.0;
+  addDoubleArrayOption("MESH_BOX_OFFSET", 3, Mesh_Box_Offset, default_mesh_box_offset);
 
   /* DESCRIPTION: Determine if the mesh file supports multizone. \n DEFAULT: true (temporarily) */
   addBoolOption("MULTIZONE_MESH", Multizone_Mesh, true);
@@ -2476,6 +2528,19 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Radius for radial basis function */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PARAMETER", RadialBasisFunction_Parameter, 1);
 
+  /* DESCRIPTION: Compute the radial basis function interpolation weights of each target point with the
+   * centers near it, for compactly supported functions (WENDLAND_C2) without polynomial term.
+   *  Options: NO, YES \ingroup Config */
+  addBoolOption("RADIAL_BASIS_FUNCTION_SPARSE", RadialBasisFunction_Sparse, false);
+
+  /* DESCRIPTION: Layers of centers, of the size of the radius, used by the sparse radial basis function
+   * interpolation beyond the support of the target points (more is closer to the interpolation with all centers). */
+  addUnsignedShortOption("RADIAL_BASIS_FUNCTION_SPARSE_LAYERS", RadialBasisFunction_SparseLayers, 1);
+
+  /* DESCRIPTION: Greedy reduction of the centers of the sparse radial basis function interpolation, centers
+   * are added until all donor points are within this tolerance times the radius of a center (0 uses all donors). */
+  addDoubleOption("RADIAL_BASIS_FUNCTION_REDUCTION_TOL", RadialBasisFunction_ReductionTol, 0.0);
+
    /*!\par INLETINTERPOLATION \n
    * DESCRIPTION: Type of spanwise interpolation to use for the inlet face. \n OPTIONS: see \link Inlet_SpanwiseInterpolation_Map \endlink
    * Sets Kind_InletInterpolation \ingroup Config
@@ -2777,6 +2842,12 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("OUTPUT_WRT_FREQ", VolumeWrtFreq, 250);
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
+  /* DESCRIPTION: Write the restart and volume files in a background thread (requires MPI_THREAD_MULTIPLE) */
+  addBoolOption("ASYNC_OUTPUT", Async_Output, false);
+  /* DESCRIPTION: Compress the binary restart files (lossless) */
+  addBoolOption("RESTART_COMPRESSION", Restart_Compression, false);
+  /* DESCRIPTION: Volume output fields or groups stored in single precision in the binary restart files */
+  addStringListOption("RESTART_SINGLE_PRECISION", nRestart_SinglePrecision, Restart_SinglePrecision);
 
   /* DESCRIPTION: Using Uncertainty Quantification with SST Turbulence Model */
   addBoolOption("USING_UQ", using_uq, false);
@@ -2802,9 +2873,27 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Level of fill for PaStiX incomplete LU factorization. */
   addUnsignedShortOption("PASTIX_FILL_LEVEL", pastix_fill_lvl, 1);
 
-  /* DESCRIPTION: Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  /* DESCRIPTION: Size of the edge groups colored for OpenMP parallelization of edge loops,
+   *              a multiple of the edge batch width (8) enables the vectorized upwind fluxes. */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Compute the upwind fluxes (ROE, HLLC, AUSM) in batches of edges with the vectorized kernels. */
+  addBoolOption("EDGE_BATCHING", Edge_Batching, true);
+
+  /* DESCRIPTION: Renumbering of the points for data locality (RCM, HILBERT, MORTON). */
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_ORDERING);
+
+  /* DESCRIPTION: Numbering of the edges (NATURAL, SORTED, COLOR_TILED). */
+  addEnumOption("EDGE_ORDERING", Kind_Edge_Ordering, Edge_Ordering_Map, NATURAL_EDGES);
+
+  /* DESCRIPTION: Compute the wall distance with the viscous walls distributed over the ranks
+   *              instead of gathering them on every rank. */
+  addBoolOption("DISTRIBUTED_WALL_DISTANCE", Distributed_WallDistance, false);
+
+  /* DESCRIPTION: Update the wall distance of turbulence models when the grid moves, only the
+   *              elements near the previous nearest wall element are checked when possible. */
+  addBoolOption("INCREMENTAL_WALL_DISTANCE", Incremental_WallDistance, false);
+
   /* END_CONFIG_OPTIONS */
 
 }
@@ -3162,6 +3251,16 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     VolumeOutputFiles[2] = SURFACE_PARAVIEW_BINARY;
   }
 
+  /*--- Asynchronous output is only implemented for the time loop of SU2_CFD, and the
+   background thread cannot use the AD tape of the discrete adjoint. ---*/
+  if ((val_software != SU2_CFD) || DiscreteAdjoint) Async_Output = false;
+
+  /*--- The adjoint restart files are read by SU2_DOT, which only reads the plain binary format. ---*/
+  if (ContinuousAdjoint || DiscreteAdjoint) {
+    Restart_Compression = false;
+    nRestart_SinglePrecision = 0;
+  }
+
   /*--- Check if SU2 was build with TecIO support, as that is required for Tecplot Binary output. ---*/
 #ifndef HAVE_TECIO
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
@@ -4749,6 +4848,28 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 
 
+  if ((Mesh_Out_FileFormat != SU2) && (Mesh_Out_FileFormat != SU2_BINARY)) {
+    SU2_MPI::Error("MESH_OUT_FORMAT must be SU2 or SU2_BINARY.", CURRENT_FUNCTION);
+  }
+
+  if (RadialBasisFunction_Sparse && (Kind_Interpolation == RADIAL_BASIS_FUNCTION)) {
+    if ((Kind_RadialBasisFunction != WENDLAND_C2) || RadialBasisFunction_PolynomialOption)
+      SU2_MPI::Error("RADIAL_BASIS_FUNCTION_SPARSE requires KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2\n"
+                     "and RADIAL_BASIS_FUNCTION_POLYNOMIAL_TERM= NO.", CURRENT_FUNCTION);
+  }
+  if (Distributed_WallDistance && (DiscreteAdjoint || (DirectDiff != NO_DERIVATIVE))) {
+    SU2_MPI::Error("DISTRIBUTED_WALL_DISTANCE is not compatible with algorithmic differentiation.", CURRENT_FUNCTION);
+  }
+  if (Incremental_WallDistance) {
+    if (Distributed_WallDistance)
+      SU2_MPI::Error("INCREMENTAL_WALL_DISTANCE cannot be combined with DISTRIBUTED_WALL_DISTANCE.", CURRENT_FUNCTION);
+    if (DiscreteAdjoint || (DirectDiff != NO_DERIVATIVE))
+      SU2_MPI::Error("INCREMENTAL_WALL_DISTANCE is not compatible with algorithmic differentiation.", CURRENT_FUNCTION);
+  }
+  if (RadialBasisFunction_ReductionTol < 0.0) {
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_REDUCTION_TOL must be positive, or 0 to disable the reduction.", CURRENT_FUNCTION);
+  }
+
   /* Set a default for the size of the RECTANGLE / BOX grid sizes. */
 
   if (nMesh_Box_Size == 0) {
@@ -4882,6 +5003,15 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     LeastSquaresRequired = true;
   }
 
+  /* The cached least-squares weights are not recorded on the tape (no geometric sensitivities),
+   and they do not include the contributions of periodic neighbors, which are communicated. */
+
+  if (DiscreteAdjoint || (nMarker_PerBound > 0)) LeastSquares_Cache = false;
+
+  /* Same for the fused reconstruction, which is not pre-accumulated (AD) either. */
+
+  if (DiscreteAdjoint || ContinuousAdjoint || (nMarker_PerBound > 0)) Fused_Reconstruction = false;
+
   if (Kind_Gradient_Method == LEAST_SQUARES) {
     SU2_MPI::Error(string("LEAST_SQUARES gradient method not allowed for viscous / source terms.\n") +
                    string("Please select either WEIGHTED_LEAST_SQUARES or GREEN_GAUSS."),
@@ -6413,8 +6543,14 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
             case BCGSTAB:
             case FGMRES:
             case RESTARTED_FGMRES:
+            case PIPELINED_GMRES:
+            case PIPELINED_BCGSTAB:
               if (Kind_Linear_Solver == BCGSTAB)
                 cout << "BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_BCGSTAB)
+                cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              else if (Kind_Linear_Solver == PIPELINED_GMRES)
+                cout << "Pipelined GMRES is used for solving the linear system." << endl;
               else
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
@@ -6422,6 +6558,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -6430,6 +6567,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An AMG"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
@@ -6467,6 +6605,11 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case PIPELINED_GMRES: case PIPELINED_BCGSTAB:
+              cout << "A pipelined Krylov method is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case CONJUGATE_GRADIENT:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
@@ -7822,6 +7965,7 @@ CConfig::~CConfig(void) {
   if (VolumeOutput != NULL) delete [] VolumeOutput;
   if (Mesh_Box_Size != NULL) delete [] Mesh_Box_Size;
   if (VolumeOutputFiles != NULL) delete [] VolumeOutputFiles;
+  if (Restart_SinglePrecision != NULL) delete [] Restart_SinglePrecision;
 
   if (ConvField != NULL) delete [] ConvField;
 
@@ -9287,10 +9431,12 @@ su2double CConfig::GetSpline(vector<su2double>&xa, vector<su2double>&ya, vector<
 void CConfig::Tick(double *val_start_time) {
 
 #ifdef PROFILE
-#ifndef HAVE_MPI
-  *val_start_time = double(clock())/double(CLOCKS_PER_SEC);
-#else
+#if defined(HAVE_MPI)
   *val_start_time = MPI_Wtime();
+#elif defined(HAVE_OMP)
+  *val_start_time = omp_get_wtime();
+#else
+  *val_start_time = double(clock())/double(CLOCKS_PER_SEC);
 #endif
 
 #endif
@@ -9303,10 +9449,12 @@ void CConfig::Tock(double val_start_time, string val_function_name, int val_grou
 
   double val_stop_time = 0.0, val_elapsed_time = 0.0;
 
-#ifndef HAVE_MPI
-  val_stop_time = double(clock())/double(CLOCKS_PER_SEC);
-#else
+#if defined(HAVE_MPI)
   val_stop_time = MPI_Wtime();
+#elif defined(HAVE_OMP)
+  val_stop_time = omp_get_wtime();
+#else
+  val_stop_time = double(clock())/double(CLOCKS_PER_SEC);
 #endif
 
   /*--- Compute the elapsed time for this subroutine ---*/
@@ -9519,8 +9667,12 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) {
   const double val_elapsed_time = val_stop_time - val_start_time;
 
   /* Create the CLong3T from the M-N-K values and check if it is already
-     stored in the map GEMM_Profile_MNK. */
+     stored in the map GEMM_Profile_MNK. The update of the profiling data
+     is serialized, as the matrix multiplications may be done by threads. */
   CLong3T MNK(M, N, K);
+
+  SU2_OMP_CRITICAL
+  {
   map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
   if(MI == GEMM_Profile_MNK.end()) {
@@ -9544,6 +9696,7 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) {
     GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
     GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
   }
+  }
 
 #endif
 
@@ -27,6 +27,7 @@
  */
 
 #include "../include/adt_structure.hpp"
+#include "../include/omp_structure.hpp"
 
 /* Define the tolerance to decide whether or not a point is inside an element. */
 const su2double tolInsideElem   =  1.e-10;
@@ -261,6 +262,22 @@ void CADTBaseClass::BuildADT(unsigned short  nDim,
   }
 }
 
+void CADTBaseClass::AllocateSearchVectors(void) {
+
+  /*--- Each thread gets its own front vectors, such that the tree can be
+        searched concurrently. Some memory is reserved to avoid frequent
+        reallocations during the searches. ---*/
+  const int nThreads = omp_get_max_threads();
+
+  FrontLeaves.resize(nThreads);
+  FrontLeavesNew.resize(nThreads);
+
+  for(int i=0; i<nThreads; ++i) {
+    FrontLeaves[i].reserve(200);
+    FrontLeavesNew[i].reserve(200);
+  }
+}
+
 CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
                                          unsigned long  nPoints,
                                          su2double      *coor,
@@ -334,10 +351,8 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   /*--- Build the tree. ---*/
   BuildADT(nDim, localPointIDs.size(), coorPoints.data());
 
-  /*--- Reserve the memory for frontLeaves and frontLeavesNew,
-        which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
+  /*--- Allocate the vectors needed during the tree search. ---*/
+  AllocateSearchVectors();
 }
 
 void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
@@ -374,7 +389,10 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
 
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
-     previous search. */
+     previous search. The work vectors of the calling thread are used. */
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
   frontLeaves.clear();
   frontLeaves.push_back(0);
 
@@ -457,7 +475,7 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
           frontLeavesNew to frontLeaves for the next round. If the new front
           is empty the entire tree has been traversed and a break can be made
           from the infinite loop. ---*/
-    frontLeaves = frontLeavesNew;
+    frontLeaves.swap(frontLeavesNew);
     if(frontLeaves.size() == 0) break;
   }
 
@@ -692,11 +710,12 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
   /* Build the ADT of the bounding boxes. */
   BuildADT(2*nDim, nElem, BBoxCoor.data());
 
-  /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
-        which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
-  BBoxTargets.reserve(200);
+  /*--- Allocate the vectors needed during the tree search, including
+        the storage of the candidate bounding boxes. ---*/
+  AllocateSearchVectors();
+
+  BBoxTargets.resize(omp_get_max_threads());
+  for(auto &targets : BBoxTargets) targets.reserve(200);
 }
 
 bool CADTElemClass::DetermineContainingElement(const su2double *coor,
@@ -708,7 +727,10 @@ bool CADTElemClass::DetermineContainingElement(const su2double *coor,
 
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
-     previous search. */
+     previous search. The work vectors of the calling thread are used. */
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+
   frontLeaves.clear();
   frontLeaves.push_back(0);
 
@@ -776,7 +798,7 @@ bool CADTElemClass::DetermineContainingElement(const su2double *coor,
           frontLeavesNew to frontLeaves for the next round. If the new front
           is empty the entire tree has been traversed and a break can be made
           from the infinite loop. ---*/
-    frontLeaves = frontLeavesNew;
+    frontLeaves.swap(frontLeavesNew);
     if(frontLeaves.size() == 0) break;
   }
 
@@ -793,6 +815,102 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
 
   AD_BEGIN_PASSIVE
 
+  /*--- Carry out the search without excluded elements and without an upper
+        bound of the distance. As the tree is not empty, an element is always
+        found. ---*/
+  unsigned long jj = 0;
+  dist = numeric_limits<passivedouble>::max();
+  NearestElementSearch(coor, nullptr, 0, dist, jj);
+
+  markerID = localMarkers[jj];
+  elemID   = localElemIDs[jj];
+  rankID   = ranksOfElems[jj];
+
+  AD_END_PASSIVE
+
+  /* At the moment the square of the distance is stored in dist. Compute
+     the correct value. */
+  Dist2ToElement(jj, coor, dist);
+  dist = sqrt(dist);
+}
+
+bool CADTElemClass::DetermineNearestElement(const su2double     *coor,
+                                            const unsigned long *excludedElems,
+                                            const unsigned long nExcluded,
+                                            su2double           &dist,
+                                            unsigned long       &elemADT) {
+
+  AD_BEGIN_PASSIVE
+
+  su2double dist2 = dist*dist;
+  const bool found = NearestElementSearch(coor, excludedElems, nExcluded, dist2, elemADT);
+
+  AD_END_PASSIVE
+
+  if( found ) dist = DistanceToElement(elemADT, coor);
+  return found;
+}
+
+su2double CADTElemClass::DistanceToElement(const unsigned long elemADT,
+                                           const su2double     *coor) {
+  su2double dist2;
+  Dist2ToElement(elemADT, coor, dist2);
+  return sqrt(dist2);
+}
+
+void CADTElemClass::DetermineElementPatches(vector<unsigned long> &patchStart,
+                                            vector<unsigned long> &patchElems) const {
+
+  /*--- Determine the elements of every point of the ADT in CSR format. ---*/
+  const unsigned long nElem   = GetnElem();
+  const unsigned long nPoints = coorPoints.size()/nDim;
+
+  vector<unsigned long> pointElemStart(nPoints+1, 0);
+  for(unsigned long i=0; i<nDOFsPerElem[nElem]; ++i)
+    ++pointElemStart[elemConns[i]+1];
+
+  for(unsigned long i=0; i<nPoints; ++i)
+    pointElemStart[i+1] += pointElemStart[i];
+
+  vector<unsigned long> pointElems(pointElemStart[nPoints]);
+  vector<unsigned long> counter(pointElemStart.begin(), pointElemStart.end()-1);
+
+  for(unsigned long i=0; i<nElem; ++i)
+    for(unsigned long j=nDOFsPerElem[i]; j<nDOFsPerElem[i+1]; ++j)
+      pointElems[counter[elemConns[j]]++] = i;
+
+  /*--- The patch of an element is the union of the elements of its points. ---*/
+  patchStart.assign(1, 0);
+  patchElems.clear();
+
+  for(unsigned long i=0; i<nElem; ++i) {
+    const unsigned long start = patchElems.size();
+
+    for(unsigned long j=nDOFsPerElem[i]; j<nDOFsPerElem[i+1]; ++j) {
+      const unsigned long p = elemConns[j];
+      patchElems.insert(patchElems.end(), pointElems.begin()+pointElemStart[p],
+                        pointElems.begin()+pointElemStart[p+1]);
+    }
+
+    sort(patchElems.begin()+start, patchElems.end());
+    patchElems.erase(unique(patchElems.begin()+start, patchElems.end()), patchElems.end());
+    patchStart.push_back(patchElems.size());
+  }
+}
+
+bool CADTElemClass::NearestElementSearch(const su2double     *coor,
+                                         const unsigned long *excludedElems,
+                                         const unsigned long nExcluded,
+                                         su2double           &dist2,
+                                         unsigned long       &elemADT) {
+
+  /* Lambda, which determines whether or not an element must be ignored.
+     The guaranteed distances of the bounding boxes of excluded elements
+     are not valid and can therefore not be used to reduce the distance. */
+  auto isExcluded = [&](const unsigned long elem) {
+    return find(excludedElems, excludedElems+nExcluded, elem) != excludedElems+nExcluded;
+  };
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 1: Initialize the distance (squared) to the quaranteed distance ---*/
   /*---         of the central bounding box of the root element.             ---*/
@@ -801,9 +919,8 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
   unsigned long kk = leaves[0].centralNodeID;
   const su2double *coorBBMin = BBoxCoor.data() + nDimADT*kk;
   const su2double *coorBBMax = coorBBMin + nDim;
-  unsigned long jj = 0;
 
-  dist = 0.0;
+  su2double dist = 0.0;
   for(unsigned short k=0; k<nDim; ++k) {
     const su2double dsMin = fabs(coor[k] - coorBBMin[k]);
     const su2double dsMax = fabs(coor[k] - coorBBMax[k]);
@@ -812,6 +929,9 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
     dist += ds*ds;
   }
 
+  if( isExcluded(kk) ) dist = dist2;
+  else                 dist = min(dist, dist2);
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -821,7 +941,11 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
 
   /* Start at the root leaf of the ADT, i.e. initialize frontLeaves such that
      it only contains the root leaf. Make sure to wipe out any data from a
-     previous search. */
+     previous search. The work vectors of the calling thread are used. */
+  vector<unsigned long> &frontLeaves    = FrontLeaves[omp_get_thread_num()];
+  vector<unsigned long> &frontLeavesNew = FrontLeavesNew[omp_get_thread_num()];
+  vector<CBBoxTargetClass> &BBoxTargets = this->BBoxTargets[omp_get_thread_num()];
+
   BBoxTargets.clear();
   frontLeaves.clear();
   frontLeaves.push_back(0);
@@ -861,8 +985,8 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
           /* Check if the possible minimum distance is less than or equal to
              the currently stored distance. If so, this bounding box is a
              candidate for the actual minimum distance and must be stored
-             in BBoxTargets. */
-          if(posDist2 <= dist) {
+             in BBoxTargets, unless its element is excluded. */
+          if((posDist2 <= dist) && !isExcluded(kk)) {
 
             /*--- Compute the guaranteed minimum distance for this bounding box. ---*/
             su2double guarDist2 = 0.0;
@@ -905,6 +1029,8 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
                   bounding box of this leaf and update the currently stored
                   minimum wall distance. ---*/
             kk = leaves[kk].centralNodeID;
+            if( isExcluded(kk) ) continue;
+
             coorBBMin = BBoxCoor.data() + nDimADT*kk;
             coorBBMax = coorBBMin + nDim;
 
@@ -927,7 +1053,7 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
           frontLeavesNew to frontLeaves for the next round. If the new front
           is empty the entire tree has been traversed and a break can be made
           from the infinite loop. ---*/
-    frontLeaves = frontLeavesNew;
+    frontLeaves.swap(frontLeavesNew);
     if(frontLeaves.size() == 0) break;
   }
 
@@ -942,6 +1068,7 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
   sort(BBoxTargets.begin(), BBoxTargets.end());
 
   /* Loop over the candidate bounding boxes. */
+  bool found = false;
   for(unsigned long i=0; i<BBoxTargets.size(); ++i) {
 
     /* Break the loop if the possible minimum distance is larger than
@@ -960,20 +1087,14 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
     su2double dist2Elem;
     Dist2ToElement(ii, coor, dist2Elem);
     if(dist2Elem <= dist) {
-      jj       = ii;
-      dist     = dist2Elem;
-      markerID = localMarkers[ii];
-      elemID   = localElemIDs[ii];
-      rankID   = ranksOfElems[ii];
+      elemADT = ii;
+      dist    = dist2Elem;
+      found   = true;
     }
   }
 
-  AD_END_PASSIVE
-
-  /* At the moment the square of the distance is stored in dist. Compute
-     the correct value. */
-  Dist2ToElement(jj, coor, dist);
-  dist = sqrt(dist);
+  if( found ) dist2 = dist;
+  return found;
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID,
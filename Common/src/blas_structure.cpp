@@ -27,6 +27,7 @@
  */
 
 #include "../include/blas_structure.hpp"
+#include "../include/omp_structure.hpp"
 #include <cstring>
 
 /* MKL or BLAS, if supported. */
@@ -65,11 +66,22 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
 #endif
 
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
-  /* Native implementation of the matrix product. This optimized implementation
-     assumes that the matrices are in column major order. This can be
-     accomplished by swapping N and M and A and B. This implementation is based
-     on https://github.com/flame/how-to-optimize-gemm. */
-  gemm_imp(N, M, K, B, A, C);
+  /* Native implementation of the matrix product. The matrices of the DG
+     solver are padded, such that the number of columns of B and C is a
+     multiple of the register block size. These small products are carried
+     out by a register blocked kernel, which works directly on the row major
+     matrices. */
+  if(N%smallBlockCols == 0) {
+    gemm_small(M, N, K, A, B, C);
+  }
+  else {
+
+    /* General case. This optimized implementation assumes that the matrices
+       are in column major order. This can be accomplished by swapping N and M
+       and A and B. This implementation is based on
+       https://github.com/flame/how-to-optimize-gemm. */
+    gemm_imp(N, M, K, B, A, C);
+  }
 
 #else
 #ifdef HAVE_LIBXSMM
@@ -138,6 +150,55 @@ void CBlasStructure::gemv(const int M,        const int N,   const su2double *A,
 
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
 
+/* Function, which carries out the small matrix products of the DG solver. */
+void CBlasStructure::gemm_small(const int M,        const int N,        const int K,
+                                const su2double *A, const su2double *B, su2double *C) const {
+
+  /* Loop over the blocks of columns of C. */
+  for(int j=0; j<N; j+=smallBlockCols) {
+
+    /* Loop over the full blocks of rows. The remaining rows, if any,
+       are treated one by one. */
+    int i = 0;
+    for(; i<=M-smallBlockRows; i+=smallBlockRows)
+      gemm_small_block<smallBlockRows>(N, K, A+i*K, B+j, C+i*N+j);
+
+    for(; i<M; ++i)
+      gemm_small_block<1>(N, K, A+i*K, B+j, C+i*N+j);
+  }
+}
+
+/* Function, which computes a block of C for gemm_small. */
+template<int nRows>
+void CBlasStructure::gemm_small_block(const int N,        const int K,
+                                      const su2double *A, const su2double *B, su2double *C) const {
+
+  /* Local block of C, which the compiler keeps in the (vector) registers. */
+  su2double c[nRows][smallBlockCols];
+
+  for(int r=0; r<nRows; ++r) {
+    SU2_OMP_SIMD
+    for(int l=0; l<smallBlockCols; ++l) c[r][l] = 0.0;
+  }
+
+  /* Accumulate the contributions of the K columns of A. The order of the
+     summation is the same as for the general implementation. */
+  for(int p=0; p<K; ++p) {
+    const su2double *b = B + p*N;
+    for(int r=0; r<nRows; ++r) {
+      const su2double a = A[r*K+p];
+      SU2_OMP_SIMD
+      for(int l=0; l<smallBlockCols; ++l) c[r][l] += a*b[l];
+    }
+  }
+
+  /* Store the block in C. */
+  for(int r=0; r<nRows; ++r) {
+    SU2_OMP_SIMD
+    for(int l=0; l<smallBlockCols; ++l) C[r*N+l] = c[r][l];
+  }
+}
+
 /* Macros for accessing submatrices of a matmul using the leading dimension. */
 #define A(i, j) a[(j)*lda + (i)]
 #define B(i, j) b[(j)*ldb + (i)]
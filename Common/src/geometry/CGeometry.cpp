@@ -29,6 +29,8 @@
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/omp_structure.hpp"
 
+#include <numeric>
+
 /*--- Cross product ---*/
 
 #define CROSS(dest,v1,v2) \
@@ -1584,6 +1586,73 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::SetEdgeOrdering(const CConfig *config) {
+
+  const auto kindOrdering = config->GetKind_Edge_Ordering();
+
+  if ((kindOrdering == NATURAL_EDGES) || (nEdge == 0)) return;
+
+  assert(edgeToCSRMap.empty() && "Edges cannot be renumbered after the edge map is built.");
+
+  /*--- Sort the edges by (min point, max point), SetEdges creates the edges with iPoint < jPoint.
+   *    Edges are then visited in the same order as the rows of the matrix, and consecutive edges
+   *    share their first point. ---*/
+
+  vector<unsigned long> perm(nEdge);
+  iota(perm.begin(), perm.end(), 0ul);
+
+  sort(perm.begin(), perm.end(), [this](unsigned long a, unsigned long b) {
+    const auto iPoint = edge[a]->GetNode(0), jPoint = edge[b]->GetNode(0);
+    return (iPoint < jPoint) || ((iPoint == jPoint) && (edge[a]->GetNode(1) < edge[b]->GetNode(1)));
+  });
+
+  PermuteEdges(perm);
+
+  if (kindOrdering != COLOR_TILED_EDGES) return;
+
+  /*--- Color the sorted edges and renumber them such that the edges of each color are contiguous.
+   *    The coloring is by groups of contiguous edges and the groups keep their relative order, thus
+   *    each group is a tile of edges that reference a compact range of points, and a thread works
+   *    on consecutive tiles (in memory) instead of jumping over the edges of the other colors. ---*/
+
+  const auto& coloring = GetEdgeColoring();
+
+  const auto nColor = coloring.getOuterSize();
+  if (nColor < 2) return;
+
+  perm.assign(coloring.innerIdx(), coloring.innerIdx()+nEdge);
+
+  su2vector<unsigned long> outerPtr(nColor+1);
+  su2vector<unsigned long> innerIdx(nEdge);
+
+  for (auto iColor = 0ul; iColor <= nColor; ++iColor)
+    outerPtr(iColor) = coloring.outerPtr()[iColor];
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge)
+    innerIdx(iEdge) = iEdge;
+
+  PermuteEdges(perm);
+
+  edgeColoring = CCompressedSparsePatternUL(move(outerPtr), move(innerIdx));
+}
+
+void CGeometry::PermuteEdges(const vector<unsigned long>& perm) {
+
+  vector<CEdge*> auxEdge(edge, edge+nEdge);
+  vector<long> newIndex(nEdge);
+
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    edge[iEdge] = auxEdge[perm[iEdge]];
+    newIndex[perm[iEdge]] = iEdge;
+  }
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iNode = 0; iNode < node[iPoint]->GetnPoint(); ++iNode) {
+      const auto iEdge = node[iPoint]->GetEdge(iNode);
+      if (iEdge >= 0) node[iPoint]->SetEdge(newIndex[iEdge], iNode);
+    }
+  }
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -4036,6 +4105,14 @@ const CEdgeToNonZeroMapUL& CGeometry::GetEdgeToSparsePatternMap(void)
   return edgeToCSRMap;
 }
 
+const CElemToNonZeroMapUL& CGeometry::GetElemToSparsePatternMap(void)
+{
+  if (elemToCSRMap.empty()) {
+    elemToCSRMap = mapElemsToSparsePattern(*this, GetSparsePattern(ConnectivityType::FiniteElement, 0));
+  }
+  return elemToCSRMap;
+}
+
 const CCompressedSparsePatternUL& CGeometry::GetEdgeColoring(void)
 {
   if (edgeColoring.empty() && nEdge) {
@@ -4104,3 +4181,11 @@ const CCompressedSparsePatternUL& CGeometry::GetElementColoring(void)
   }
   return elemColoring;
 }
+
+void CGeometry::SetDualGridSoA(bool updateConnectivity)
+{
+  if (updateConnectivity || !dualGridSoA.Matches(nPoint, nEdge))
+    dualGridSoA.SetConnectivity(nDim, nPoint, nEdge, node, edge);
+
+  dualGridSoA.SetGeometry(node, edge);
+}
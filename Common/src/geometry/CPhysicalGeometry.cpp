@@ -27,9 +27,12 @@
 
 #include "../../include/geometry/CPhysicalGeometry.hpp"
 #include "../../include/adt_structure.hpp"
+#include "../../include/omp_structure.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../include/toolboxes/sfc_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
@@ -194,7 +197,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   else {
 
     switch (val_format) {
-      case SU2: case CGNS_GRID: case RECTANGLE: case BOX:
+      case SU2: case SU2_BINARY: case CGNS_GRID: case RECTANGLE: case BOX:
         Read_Mesh_FVM(config, val_mesh_filename, val_iZone, val_nZone);
         break;
       default:
@@ -3969,11 +3972,17 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
 
   unsigned short val_format = config->GetMesh_FileFormat();
 
+  double tick = 0.0;
+  config->Tick(&tick);
+
   CMeshReaderFVM *MeshFVM = NULL;
   switch (val_format) {
     case SU2:
       MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     case CGNS_GRID:
       MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
       break;
@@ -3988,6 +3997,8 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig        *config,
       break;
   }
 
+  config->Tock(tick, "Read_Mesh_FVM", 0);
+
   /*--- Store the dimension of the problem ---*/
 
   nDim = MeshFVM->GetDimension();
@@ -5163,11 +5174,25 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   /*---         surface elements. A nearest point search does not give     ---*/
   /*---         accurate results, especially not for the integration       ---*/
   /*---         points of the elements close to a wall boundary.           ---*/
+  /*---         In distributed mode only the local part of the wall is     ---*/
+  /*---         stored in the ADT, see ComputeWall_Distance_Distributed.   ---*/
   /*--------------------------------------------------------------------------*/
 
+  const bool distributed = config->GetDistributed_WallDistance();
+
   /* Build the ADT. */
   CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                           markerIDs, elemIDs, true);
+                           markerIDs, elemIDs, !distributed);
+
+  if ( distributed ) {
+    ComputeWall_Distance_Distributed(WallADT, surfaceCoor);
+    return;
+  }
+
+  if ( config->GetIncremental_WallDistance() ) {
+    ComputeWall_Distance_Incremental(WallADT, surfaceCoor);
+    return;
+  }
 
   /* Release the memory of the vectors used to build the ADT. To make sure
      that all the memory is deleted, the swap function is used. */
@@ -5194,8 +5219,11 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   else {
 
     /*--- Solid wall boundary nodes are present. Compute the wall
-     distance for all nodes. ---*/
+     distance for all nodes, the searches of the ADT are thread safe. ---*/
 
+    SU2_OMP_PARALLEL
+    {
+    SU2_OMP_FOR_DYN(256)
     for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
       unsigned short markerID;
       unsigned long  elemID;
@@ -5206,6 +5234,367 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
                                    elemID, rankID);
       node[iPoint]->SetWall_Distance(dist);
     }
+    }
+  }
+
+}
+
+void CPhysicalGeometry::ComputeWall_Distance_Distributed(CADTElemClass &WallADT,
+                                                         const vector<su2double> &surfaceCoor) {
+
+  /*--- Every rank stores the viscous walls of its own partition. The partitions are spatially
+        compact, hence a point only needs to search the partitions whose bounding box is closer
+        than an upper bound of its wall distance. The searches in the local ADT of a partition
+        are done by the rank that owns it, the coordinates are sent there and the distances
+        are sent back. The work and memory per rank scale with the local part of the wall. ---*/
+
+  const unsigned long nPointLocal = GetnPoint();
+  const unsigned long nWallPoint = surfaceCoor.size()/nDim;
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Gather the bounding boxes of the local walls. An empty     ---*/
+  /*---         wall is marked by a box with min > max.                    ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<passivedouble> bboxLocal(2*nDim), bboxAll(2*nDim*size);
+
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+    bboxLocal[iDim] = numeric_limits<passivedouble>::max();
+    bboxLocal[nDim+iDim] = numeric_limits<passivedouble>::lowest();
+  }
+  if (!WallADT.IsEmpty()) {
+    for (unsigned long iVertex = 0; iVertex < nWallPoint; ++iVertex) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        const passivedouble x = SU2_TYPE::GetValue(surfaceCoor[iVertex*nDim+iDim]);
+        bboxLocal[iDim] = min(bboxLocal[iDim], x);
+        bboxLocal[nDim+iDim] = max(bboxLocal[nDim+iDim], x);
+      }
+    }
+  }
+
+  SU2_MPI::Allgather(bboxLocal.data(), 2*nDim, MPI_DOUBLE, bboxAll.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  vector<int> wallRanks;
+  for (int iRank = 0; iRank < size; ++iRank)
+    if (bboxAll[2*nDim*iRank] <= bboxAll[2*nDim*iRank+nDim]) wallRanks.push_back(iRank);
+
+  /*--- No solid walls in the entire mesh, set the wall distance to zero. ---*/
+
+  if (wallRanks.empty()) {
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; ++iPoint)
+      node[iPoint]->SetWall_Distance(0.0);
+    return;
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Gather a subsample of the wall points of all ranks. The    ---*/
+  /*---         distance to the nearest sample point is an upper bound of  ---*/
+  /*---         the wall distance that does not depend on the local wall.  ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const unsigned long maxSampleGlobal = 16384;
+  const unsigned long nSampleMax = max<unsigned long>(1, maxSampleGlobal/wallRanks.size());
+  const unsigned long nSampleLocal = WallADT.IsEmpty()? 0 : min(nWallPoint, nSampleMax);
+
+  vector<passivedouble> sampleLocal(nSampleLocal*nDim);
+  for (unsigned long iSample = 0; iSample < nSampleLocal; ++iSample) {
+    const unsigned long iVertex = (iSample*nWallPoint)/nSampleLocal;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      sampleLocal[iSample*nDim+iDim] = SU2_TYPE::GetValue(surfaceCoor[iVertex*nDim+iDim]);
+  }
+
+#ifdef HAVE_MPI
+  vector<int> sampleCounts(size), sampleDispl(size+1, 0);
+  int nSampleSend = sampleLocal.size();
+  SU2_MPI::Allgather(&nSampleSend, 1, MPI_INT, sampleCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  for (int iRank = 0; iRank < size; ++iRank)
+    sampleDispl[iRank+1] = sampleDispl[iRank] + sampleCounts[iRank];
+
+  vector<passivedouble> sampleAll(sampleDispl[size]);
+  SU2_MPI::Allgatherv(sampleLocal.data(), nSampleSend, MPI_DOUBLE, sampleAll.data(),
+                      sampleCounts.data(), sampleDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+#else
+  const vector<passivedouble>& sampleAll = sampleLocal;
+#endif
+
+  const unsigned long nSampleGlobal = sampleAll.size()/nDim;
+  vector<su2double> sampleCoor(sampleAll.begin(), sampleAll.end());
+  vector<unsigned long> sampleIDs(nSampleGlobal);
+  for (unsigned long iSample = 0; iSample < nSampleGlobal; ++iSample) sampleIDs[iSample] = iSample;
+
+  CADTPointsOnlyClass SampleADT(nDim, nSampleGlobal, sampleCoor.data(), sampleIDs.data(), false);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Search the local wall and determine the ranks whose wall   ---*/
+  /*---         can be closer than the upper bound of the distance. The    ---*/
+  /*---         candidates are stored in CSR format (two passes).          ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<su2double> wallDist(nPointLocal);
+  vector<unsigned long> candStart(nPointLocal+1, 0);
+  vector<int> candRanks;
+
+  /*--- Distance from a point to the wall bounding box of a rank, a lower bound of the distance to that wall. ---*/
+  auto boxDistance = [&](const su2double* coor, int iRank) {
+    const passivedouble* bbMin = &bboxAll[2*nDim*iRank];
+    const passivedouble* bbMax = bbMin + nDim;
+    passivedouble dist2 = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      const passivedouble x = SU2_TYPE::GetValue(coor[iDim]);
+      const passivedouble ds = max(max(bbMin[iDim]-x, x-bbMax[iDim]), passivedouble(0.0));
+      dist2 += ds*ds;
+    }
+    return sqrt(dist2);
+  };
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; ++iPoint) {
+
+      const su2double* coor = node[iPoint]->GetCoord();
+      unsigned short markerID;
+      unsigned long  elemID;
+      int            rankID;
+      su2double      dist;
+
+      SampleADT.DetermineNearestNode(coor, dist, elemID, rankID);
+      wallDist[iPoint] = dist;
+
+      if (!WallADT.IsEmpty()) {
+        WallADT.DetermineNearestElement(coor, dist, markerID, elemID, rankID);
+        wallDist[iPoint] = min(wallDist[iPoint], dist);
+      }
+
+      const passivedouble bound = SU2_TYPE::GetValue(wallDist[iPoint]);
+      unsigned long nCand = 0;
+      for (auto iRank : wallRanks)
+        if ((iRank != rank) && (boxDistance(coor, iRank) <= bound)) ++nCand;
+      candStart[iPoint+1] = nCand;
+    }
+
+    SU2_OMP_MASTER
+    {
+      for (unsigned long iPoint = 0; iPoint < nPointLocal; ++iPoint)
+        candStart[iPoint+1] += candStart[iPoint];
+      candRanks.resize(candStart[nPointLocal]);
+    }
+    SU2_OMP_BARRIER
+
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; ++iPoint) {
+
+      const su2double* coor = node[iPoint]->GetCoord();
+      const passivedouble bound = SU2_TYPE::GetValue(wallDist[iPoint]);
+      unsigned long iCand = candStart[iPoint];
+      for (auto iRank : wallRanks)
+        if ((iRank != rank) && (boxDistance(coor, iRank) <= bound)) candRanks[iCand++] = iRank;
+    }
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 4: Send the coordinates of the points to the candidate ranks. ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<int> sendCounts(size, 0), recvCounts(size), sendDispl(size+1, 0), recvDispl(size+1, 0);
+
+  for (auto iRank : candRanks) ++sendCounts[iRank];
+
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendDispl[iRank+1] = sendDispl[iRank] + sendCounts[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + recvCounts[iRank];
+  }
+
+  /*--- Points for which a rank is a candidate, in the order of the send buffer. ---*/
+
+  vector<unsigned long> sendPoints(sendDispl[size]);
+  vector<passivedouble> sendCoor(sendDispl[size]*nDim);
+  {
+    vector<int> pos(sendDispl.begin(), sendDispl.end()-1);
+    for (unsigned long iPoint = 0; iPoint < nPointLocal; ++iPoint) {
+      for (auto iCand = candStart[iPoint]; iCand < candStart[iPoint+1]; ++iCand) {
+        const int iSend = pos[candRanks[iCand]]++;
+        sendPoints[iSend] = iPoint;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          sendCoor[iSend*nDim+iDim] = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+      }
+    }
+  }
+  vector<int>().swap(candRanks);
+
+  vector<passivedouble> recvCoor(recvDispl[size]*nDim);
+  {
+    vector<int> sendCountsCoor(size), recvCountsCoor(size), sendDisplCoor(size), recvDisplCoor(size);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendCountsCoor[iRank] = sendCounts[iRank]*nDim;  sendDisplCoor[iRank] = sendDispl[iRank]*nDim;
+      recvCountsCoor[iRank] = recvCounts[iRank]*nDim;  recvDisplCoor[iRank] = recvDispl[iRank]*nDim;
+    }
+    SU2_MPI::Alltoallv(sendCoor.data(), sendCountsCoor.data(), sendDisplCoor.data(), MPI_DOUBLE,
+                       recvCoor.data(), recvCountsCoor.data(), recvDisplCoor.data(), MPI_DOUBLE,
+                       MPI_COMM_WORLD);
+  }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 5: Search the local wall for the received points and return   ---*/
+  /*---         the distances, the final distance is the minimum.          ---*/
+  /*--------------------------------------------------------------------------*/
+
+  const unsigned long nRecv = recvDispl[size];
+  vector<passivedouble> recvDist(nRecv), sendDist(sendDispl[size]);
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iRecv = 0; iRecv < nRecv; ++iRecv) {
+      su2double coor[3] = {0.0}, dist;
+      unsigned short markerID;
+      unsigned long  elemID;
+      int            rankID;
+
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) coor[iDim] = recvCoor[iRecv*nDim+iDim];
+
+      WallADT.DetermineNearestElement(coor, dist, markerID, elemID, rankID);
+      recvDist[iRecv] = SU2_TYPE::GetValue(dist);
+    }
+  }
+
+  SU2_MPI::Alltoallv(recvDist.data(), recvCounts.data(), recvDispl.data(), MPI_DOUBLE,
+                     sendDist.data(), sendCounts.data(), sendDispl.data(), MPI_DOUBLE,
+                     MPI_COMM_WORLD);
+
+  for (unsigned long iSend = 0; iSend < sendPoints.size(); ++iSend) {
+    const auto iPoint = sendPoints[iSend];
+    wallDist[iPoint] = min(wallDist[iPoint], su2double(sendDist[iSend]));
+  }
+
+  for (unsigned long iPoint = 0; iPoint < nPointLocal; ++iPoint)
+    node[iPoint]->SetWall_Distance(wallDist[iPoint]);
+
+}
+
+void CPhysicalGeometry::ComputeWall_Distance_Incremental(CADTElemClass &WallADT,
+                                                         const vector<su2double> &surfaceCoor) {
+
+  /*--- The ADT contains the walls of all ranks, gathered in the same order every time it is built,
+   hence the elements keep their index in the ADT from one update to the next. For each point the
+   patch of wall elements around its nearest element is stored, together with the distance to the
+   nearest element outside of the patch (the margin). When the point moved by dp and every wall
+   point by at most dw, the elements outside of the patch are still at least margin-dp-dw away, if
+   the distance to the patch is smaller than that it is the exact wall distance. ---*/
+
+  if ( WallADT.IsEmpty() ) {
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+      node[iPoint]->SetWall_Distance(0.0);
+    WallDist_Elem.clear();
+    return;
+  }
+
+  const unsigned long nElemWall = WallADT.GetnElem();
+  const unsigned long nSurfacePoint = surfaceCoor.size()/nDim;
+  const passivedouble maxDist = numeric_limits<passivedouble>::max();
+
+  /*--- Maximum displacement of the walls since the previous update, the stored data can only be
+   used if the walls and the mesh are the same on all ranks. ---*/
+
+  const bool sameWalls = (WallDist_PatchStart.size() == nElemWall+1) &&
+                         (WallDist_SurfaceCoor.size() == surfaceCoor.size()) &&
+                         (WallDist_Elem.size() == nPoint);
+
+  su2double motion[2] = {0.0, sameWalls? 0.0 : 1.0}, motionMax[2] = {0.0};
+
+  if (sameWalls) {
+    for (unsigned long iVertex = 0; iVertex < nSurfacePoint; ++iVertex) {
+      su2double dist2 = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        dist2 += pow(surfaceCoor[iVertex*nDim+iDim] - WallDist_SurfaceCoor[iVertex*nDim+iDim], 2);
+      motion[0] = max(motion[0], dist2);
+    }
+    motion[0] = sqrt(motion[0]);
+  }
+
+  SU2_MPI::Allreduce(motion, motionMax, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+  if (motionMax[1] > 0.0) {
+
+    /*--- First update, or the walls changed, every point needs a full search. ---*/
+
+    WallADT.DetermineElementPatches(WallDist_PatchStart, WallDist_PatchElems);
+
+    WallDist_Motion = 0.0;
+    WallDist_Elem.assign(nPoint, nElemWall);
+    WallDist_Margin.resize(nPoint);
+    WallDist_Motion0.resize(nPoint);
+    WallDist_Coord.resize(nPoint, nDim);
+  }
+  else {
+    WallDist_Motion += motionMax[0];
+  }
+
+  WallDist_SurfaceCoor = surfaceCoor;
+
+  /*--- Update the distance of every point. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_DYN(256)
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+      const su2double* coor = node[iPoint]->GetCoord();
+      unsigned long nearestElem = WallDist_Elem[iPoint];
+      su2double dist = maxDist;
+      bool valid = false;
+
+      if (nearestElem < nElemWall) {
+
+        /*--- Distance to the patch of the previous nearest element. ---*/
+
+        const auto iElem = nearestElem;
+        for (auto k = WallDist_PatchStart[iElem]; k < WallDist_PatchStart[iElem+1]; ++k) {
+          const auto jElem = WallDist_PatchElems[k];
+          const su2double distElem = WallADT.DistanceToElement(jElem, coor);
+          if (distElem < dist) {
+            dist = distElem;
+            nearestElem = jElem;
+          }
+        }
+
+        su2double pointMotion = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          pointMotion += pow(coor[iDim] - WallDist_Coord(iPoint,iDim), 2);
+        pointMotion = sqrt(pointMotion);
+
+        const su2double wallMotion = WallDist_Motion - WallDist_Motion0[iPoint];
+
+        valid = (dist <= WallDist_Margin[iPoint] - pointMotion - wallMotion);
+      }
+
+      if (!valid) {
+
+        /*--- Full search, the distance to the patch (if any) is an upper bound. When no element
+         is closer than the bound, the nearest element of the patch is the nearest element. ---*/
+
+        WallADT.DetermineNearestElement(coor, nullptr, 0, dist, nearestElem);
+
+        /*--- New margin, the distance to the nearest element outside of its patch. ---*/
+
+        const auto start = WallDist_PatchStart[nearestElem];
+        const auto nPatch = WallDist_PatchStart[nearestElem+1] - start;
+
+        su2double margin = maxDist;
+        unsigned long marginElem;
+        WallADT.DetermineNearestElement(coor, &WallDist_PatchElems[start], nPatch, margin, marginElem);
+
+        WallDist_Elem[iPoint] = nearestElem;
+        WallDist_Margin[iPoint] = margin;
+        WallDist_Motion0[iPoint] = WallDist_Motion;
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+          WallDist_Coord(iPoint,iDim) = coor[iDim];
+      }
+
+      node[iPoint]->SetWall_Distance(dist);
+    }
   }
 
 }
@@ -5439,9 +5828,9 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
 }
 
 void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
   vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
 
   inQueue = new bool [nPoint];
@@ -5529,6 +5918,33 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
 
+  ReorderPoints(config, Result);
+
+}
+
+void CPhysicalGeometry::SetSFC_Ordering(CConfig *config) {
+
+  /*--- Sort the domain points along the curve, the MPI points are kept at the end. ---*/
+
+  const bool hilbert = (config->GetKind_Point_Ordering() == HILBERT_ORDERING);
+
+  auto coord = [this](unsigned long iPoint, unsigned short iDim) {
+    return SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+  };
+
+  vector<unsigned long> Result = SFCToolbox::SortPoints(nPointDomain, nDim, coord, hilbert);
+
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result.push_back(iPoint);
+
+  ReorderPoints(config, Result);
+
+}
+
+void CPhysicalGeometry::ReorderPoints(CConfig *config, const vector<unsigned long>& Result) {
+  unsigned long iPoint, iElem;
+  unsigned short iDim, iNode, iMarker;
+
   /*--- Reset old data structures ---*/
 
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -8464,6 +8880,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
 
   config->SetDomainVolume(DomainVolume);
 
+  /*--- Synchronize the contiguous copy of the dual grid. ---*/
+  SetDualGridSoA(action == ALLOCATE);
+
   delete[] Coord_Edge_CG;
   delete[] Coord_FaceElem_CG;
   delete[] Coord_Elem_CG;
@@ -9738,6 +10157,11 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
+    if (Restart_Vars[0] == SU2_COMPRESSED_RESTART_MAGIC) {
+      SU2_MPI::Error(string("File ") + string(fname) + string(" was written with RESTART_COMPRESSION or\n") +
+                     string("RESTART_SINGLE_PRECISION, the sensitivities must be read from a plain binary restart file."), CURRENT_FUNCTION);
+    }
+
     if (Restart_Vars[0] != 535532) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
@@ -9834,6 +10258,11 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
+    if (Restart_Vars[0] == SU2_COMPRESSED_RESTART_MAGIC) {
+      SU2_MPI::Error(string("File ") + string(fname) + string(" was written with RESTART_COMPRESSION or\n") +
+                     string("RESTART_SINGLE_PRECISION, the sensitivities must be read from a plain binary restart file."), CURRENT_FUNCTION);
+    }
+
     if (Restart_Vars[0] != 535532) {
 
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
@@ -10055,7 +10484,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_MAGIC)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -10093,7 +10522,7 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_MAGIC)) {
 
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
@@ -0,0 +1,116 @@
+/*!
+ * \file CDualGridSoA.cpp
+ * \brief Contiguous storage of the dual grid information.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/geometry/dual_grid/CDualGridSoA.hpp"
+
+void CDualGridSoA::SetConnectivity(unsigned short val_nDim, unsigned long val_nPoint, unsigned long val_nEdge,
+                                   CPoint* const* node, CEdge* const* edge) {
+
+  nDim = val_nDim;
+  nPoint = val_nPoint;
+  nEdge = val_nEdge;
+
+  /*--- Nodes of the edges. ---*/
+
+  EdgeNodes.resize(nEdge,2);
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
+    EdgeNodes(iEdge,0) = edge[iEdge]->GetNode(0);
+    EdgeNodes(iEdge,1) = edge[iEdge]->GetNode(1);
+  }
+
+  /*--- Neighbors of the points and respective edges, in compressed format. ---*/
+
+  su2vector<unsigned long> outerPtr(nPoint+1);
+  outerPtr(0) = 0;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint)
+    outerPtr(iPoint+1) = outerPtr(iPoint) + node[iPoint]->GetnPoint();
+
+  su2vector<unsigned long> innerIdx(outerPtr(nPoint));
+  NeighborEdges.resize(outerPtr(nPoint));
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); ++iNeigh) {
+      innerIdx(outerPtr(iPoint)+iNeigh) = node[iPoint]->GetPoint(iNeigh);
+      NeighborEdges(outerPtr(iPoint)+iNeigh) = node[iPoint]->GetEdge(iNeigh);
+    }
+  }
+
+  /*--- Inverse map, from the edges to the neighbor storage of their nodes. ---*/
+
+  EdgeNeighborPos.resize(nEdge,2);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (auto k = outerPtr(iPoint); k < outerPtr(iPoint+1); ++k) {
+      const auto iEdge = NeighborEdges(k);
+      EdgeNeighborPos(iEdge, (EdgeNodes(iEdge,0) == iPoint)? 0 : 1) = k;
+    }
+  }
+
+  Neighbors = CCompressedSparsePatternUL(move(outerPtr), move(innerIdx));
+
+  /*--- Size the geometric quantities, these are set by SetGeometry. ---*/
+
+  EdgeNormal.resize(nEdge,nDim) = su2double(0.0);
+  Coord.resize(nPoint,nDim) = su2double(0.0);
+  Volume.resize(nPoint) = su2double(0.0);
+
+  /*--- The least-squares weights depend on the connectivity, they are rebuilt on demand. ---*/
+
+  for (auto& weights : LeastSquaresWeights) weights.resize(0,0);
+  LeastSquaresWeightsSet[0] = LeastSquaresWeightsSet[1] = false;
+
+}
+
+void CDualGridSoA::SetGeometry(CPoint* const* node, CEdge* const* edge) {
+
+  /*--- The grid may have moved, invalidate the cached least-squares weights. ---*/
+
+  LeastSquaresWeightsSet[0] = LeastSquaresWeightsSet[1] = false;
+
+  for (unsigned long iEdge = 0; iEdge < nEdge; ++iEdge) {
+    const su2double* normal = edge[iEdge]->GetNormal();
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      EdgeNormal(iEdge,iDim) = normal[iDim];
+  }
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      Coord(iPoint,iDim) = node[iPoint]->GetCoord(iDim);
+
+    Volume(iPoint) = node[iPoint]->GetVolume() + node[iPoint]->GetPeriodicVolume();
+  }
+
+}
+
+void CDualGridSoA::AllocateLeastSquaresWeights(bool weighted) {
+
+  LeastSquaresWeights[weighted].resize(Neighbors.getNumNonZeros(), nDim) = su2double(0.0);
+  LeastSquaresWeightsSet[weighted] = false;
+
+}
@@ -27,6 +27,7 @@
  */
 
 #include "../../../include/geometry/meshreader/CMeshReaderFVM.hpp"
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
 
 CMeshReaderFVM::CMeshReaderFVM(CConfig        *val_config,
                                unsigned short val_iZone,
@@ -56,3 +57,86 @@ CMeshReaderFVM::CMeshReaderFVM(CConfig        *val_config,
 }
 
 CMeshReaderFVM::~CMeshReaderFVM(void) { }
+
+void CMeshReaderFVM::DistributeVolumeElements(vector<unsigned long>& connElems) {
+
+  const unsigned long nElemRead = connElems.size()/SU2_CONN_SIZE;
+
+  if (size == SINGLE_NODE) {
+    numberOfLocalElements = nElemRead;
+    localVolumeElementConnectivity.swap(connElems);
+    return;
+  }
+
+  /*--- Number of nodes of each element, unused entries of the
+   connectivity are zero which is also a valid point index. ---*/
+
+  vector<unsigned short> nPoinPerElem(nElemRead);
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    switch (connElems[iElem*SU2_CONN_SIZE+1]) {
+      case TRIANGLE:      nPoinPerElem[iElem] = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nPoinPerElem[iElem] = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nPoinPerElem[iElem] = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nPoinPerElem[iElem] = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nPoinPerElem[iElem] = N_POINTS_PRISM;         break;
+      case PYRAMID:       nPoinPerElem[iElem] = N_POINTS_PYRAMID;       break;
+      default:
+        SU2_MPI::Error("Unknown volume element type in the mesh file.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Count the entries to send to each rank, the flag avoids sending
+   the same element twice to a rank that owns several of its points. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  vector<int> nSend(size,0), nRecv(size,0), sendDispl(size+1,0), recvDispl(size+1,0);
+  vector<long> flag(size,-1);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    for (unsigned short iNode = 0; iNode < nPoinPerElem[iElem]; iNode++) {
+      const auto iPoint = connElems[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode];
+      const int iProcessor = pointPartitioner.GetRankContainingIndex(iPoint);
+      if (flag[iProcessor] != long(iElem)) {
+        flag[iProcessor] = iElem;
+        nSend[iProcessor] += SU2_CONN_SIZE;
+      }
+    }
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  for (int iProcessor = 0; iProcessor < size; iProcessor++) {
+    sendDispl[iProcessor+1] = sendDispl[iProcessor] + nSend[iProcessor];
+    recvDispl[iProcessor+1] = recvDispl[iProcessor] + nRecv[iProcessor];
+  }
+
+  /*--- Load the send buffer and exchange the elements, the elements
+   received from each rank remain sorted by global index. ---*/
+
+  vector<unsigned long> connSend(sendDispl[size]);
+  vector<int> index(sendDispl.begin(), sendDispl.end()-1);
+  flag.assign(size,-1);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    for (unsigned short iNode = 0; iNode < nPoinPerElem[iElem]; iNode++) {
+      const auto iPoint = connElems[iElem*SU2_CONN_SIZE + SU2_CONN_SKIP + iNode];
+      const int iProcessor = pointPartitioner.GetRankContainingIndex(iPoint);
+      if (flag[iProcessor] != long(iElem)) {
+        flag[iProcessor] = iElem;
+        for (int jNode = 0; jNode < SU2_CONN_SIZE; jNode++)
+          connSend[index[iProcessor]++] = connElems[iElem*SU2_CONN_SIZE + jNode];
+      }
+    }
+  }
+  vector<unsigned long>().swap(connElems);
+
+  localVolumeElementConnectivity.resize(recvDispl[size]);
+
+  SU2_MPI::Alltoallv(connSend.data(), nSend.data(), sendDispl.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), nRecv.data(), recvDispl.data(),
+                     MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  numberOfLocalElements = recvDispl[size]/SU2_CONN_SIZE;
+
+}
@@ -28,6 +28,93 @@
 
 #include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
+#include "../../../include/toolboxes/parsing_toolbox.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <algorithm>
+
+namespace {
+
+/*!
+ * \brief Buffered forward reader of a text file that keeps track of the byte offset
+ *        of the lines, large sections can be skipped without copying their lines.
+ */
+class CLineScanner {
+private:
+  FILE* file;
+  vector<char> buffer;
+  unsigned long bufferOffset = 0;  /*!< \brief Offset in the file of the start of the buffer. */
+  unsigned long begin = 0, end = 0;
+
+  /*!
+   * \brief Discard the consumed part of the buffer and read more of the file.
+   * \return False at the end of the file.
+   */
+  bool Refill() {
+    memmove(buffer.data(), buffer.data()+begin, end-begin);
+    bufferOffset += begin;
+    end -= begin;
+    begin = 0;
+    if (end == buffer.size()) buffer.resize(2*buffer.size());
+    const auto nRead = fread(buffer.data()+end, 1, buffer.size()-end, file);
+    end += nRead;
+    return nRead > 0;
+  }
+
+public:
+  CLineScanner(FILE* fhr) : file(fhr), buffer(1<<22) {}
+
+  /*!
+   * \brief Offset in the file of the next line.
+   */
+  unsigned long Offset() const { return bufferOffset + begin; }
+
+  /*!
+   * \brief Copy the next line, without the line feed.
+   * \return False at the end of the file.
+   */
+  bool GetLine(string& line) {
+    while (true) {
+      auto pos = static_cast<const char*>(memchr(buffer.data()+begin, '\n', end-begin));
+      if (pos != nullptr) {
+        const unsigned long lineEnd = pos - buffer.data();
+        line.assign(buffer.data()+begin, lineEnd-begin);
+        begin = lineEnd+1;
+        return true;
+      }
+      if (!Refill()) {
+        if (begin == end) return false;
+        line.assign(buffer.data()+begin, end-begin);
+        begin = end;
+        return true;
+      }
+    }
+  }
+
+  /*!
+   * \brief Skip lines.
+   * \return Number of lines skipped, less than requested at the end of the file.
+   */
+  unsigned long SkipLines(unsigned long nLines) {
+    unsigned long iLine = 0;
+    while (iLine < nLines) {
+      auto pos = static_cast<const char*>(memchr(buffer.data()+begin, '\n', end-begin));
+      if (pos != nullptr) {
+        begin = pos - buffer.data() + 1;
+        iLine++;
+      }
+      else if (!Refill()) {
+        if (begin < end) { begin = end; iLine++; }
+        break;
+      }
+    }
+    return iLine;
+  }
+};
+
+}
 
 CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig        *val_config,
                                                unsigned short val_iZone,
@@ -62,8 +149,16 @@ CSU2ASCIIMeshReaderFVM::CSU2ASCIIMeshReaderFVM(CConfig        *val_config,
   /* Read and store the points, interior elements, and surface elements.
    We store only the points and interior elements on our rank's linear
    partition, but the master stores the entire set of surface connectivity. */
-  ReadPointCoordinates();
-  ReadVolumeElementConnectivity();
+  if (actuator_disk) {
+    ReadPointCoordinates();
+    ReadVolumeElementConnectivity();
+  }
+  else {
+    /* Without the splitting, the sections are read in parallel from
+     the byte ranges that were found with the metadata. */
+    ReadPointCoordinatesParallel();
+    ReadVolumeElementConnectivityParallel();
+  }
   ReadSurfaceElementConnectivity();
   
 }
@@ -75,170 +170,216 @@ void CSU2ASCIIMeshReaderFVM::ReadMetadata() {
   bool harmonic_balance = config->GetTime_Marching() == HARMONIC_BALANCE;
   bool multizone_file = config->GetMultizone_Mesh();
   
-  /*--- Open grid file ---*/
-  
-  mesh_file.open(meshFilename.c_str(), ios::in);
-  if (mesh_file.fail()) {
-    SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
-                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
-  }
+  /*--- The master scans the file once, recording the byte offsets of the
+   sections of our zone, the lines of the points and elements are skipped
+   without being parsed. The metadata is then broadcast to all ranks. ---*/
   
-  /*--- If more than one, find the curent zone in the mesh file. ---*/
+  enum : unsigned short {FOUND_NDIME, FOUND_NPOIN, FOUND_NELEM, FOUND_NMARK, FOUND_AOA, FOUND_AOS,
+                         NDIME, NPOIN, NELEM, NMARK, POINT_BEGIN, POINT_END, ELEM_BEGIN, ELEM_END,
+                         MARKER_BEGIN, NUMBER_OF_METADATA};
+  unsigned long metadata[NUMBER_OF_METADATA] = {0};
+  passivedouble offsets[2] = {0.0, 0.0};
   
-  string text_line;
-  string::size_type position;
-  if ((nZones > 1 && multizone_file) || harmonic_balance) {
-    if (harmonic_balance) {
-      if (rank == MASTER_NODE)
+  if (rank == MASTER_NODE) {
+    
+    /*--- Open grid file ---*/
+    
+    FILE* fhr = fopen(meshFilename.c_str(), "rb");
+    if (fhr == nullptr) {
+      SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
+                     string(" \n Check that the file exists."), CURRENT_FUNCTION);
+    }
+    CLineScanner scanner(fhr);
+    
+    /*--- If more than one, find the curent zone in the mesh file. ---*/
+    
+    string text_line;
+    string::size_type position;
+    if ((nZones > 1 && multizone_file) || harmonic_balance) {
+      if (harmonic_balance) {
         cout << "Reading time instance " << config->GetiInst()+1 << "." << endl;
-    } else {
-      bool foundZone = false;
-      while (getline (mesh_file,text_line)) {
-        /*--- Search for the current domain ---*/
-        position = text_line.find ("IZONE=",0);
-        if (position != string::npos) {
-          text_line.erase (0,6);
-          unsigned short jZone = atoi(text_line.c_str());
-          if (jZone == myZone+1) {
-            if (rank == MASTER_NODE)
+      } else {
+        bool foundZone = false;
+        while (scanner.GetLine(text_line)) {
+          /*--- Search for the current domain ---*/
+          position = text_line.find ("IZONE=",0);
+          if (position != string::npos) {
+            text_line.erase (0,6);
+            unsigned short jZone = atoi(text_line.c_str());
+            if (jZone == myZone+1) {
               cout << "Reading zone " << myZone << " from native SU2 ASCII mesh." << endl;
-            foundZone = true;
-            break;
+              foundZone = true;
+              break;
+            }
           }
         }
-      }
-      if (!foundZone) {
-        SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
-                       string(" \n Check the SU2 ASCII file format."),
-                       CURRENT_FUNCTION);
+        if (!foundZone) {
+          SU2_MPI::Error(string("Could not find the IZONE= keyword or the zone contents.") +
+                         string(" \n Check the SU2 ASCII file format."),
+                         CURRENT_FUNCTION);
+        }
       }
     }
-  }
-  
-  /*--- Read the metadata: problem dimension, offsets for angle
-   of attack and angle of sideslip, global points, global elements,
-   and number of markers. Perform error checks as we go. ---*/
-  
-  bool foundNDIME = false, foundNPOIN = false;
-  bool foundNELEM = false, foundNMARK = false;
-  
-  while (getline (mesh_file, text_line)) {
     
-    /*--- Read the dimension of the problem ---*/
+    /*--- Read the metadata: problem dimension, offsets for angle
+     of attack and angle of sideslip, global points, global elements,
+     and number of markers. ---*/
     
-    position = text_line.find ("NDIME=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      dimension = atoi(text_line.c_str());
-      foundNDIME = true;
-    }
-    
-    /*--- The AoA and AoS offset values are optional. ---*/
+    unsigned long lineOffset = scanner.Offset();
     
-    position = text_line.find ("AOA_OFFSET=",0);
-    if (position != string::npos) {
-      su2double AoA_Offset = 0.0;
-      text_line.erase (0,11);
-      AoA_Offset = atof(text_line.c_str());
+    while (scanner.GetLine(text_line)) {
+      
+      /*--- Read the dimension of the problem ---*/
       
-      /*--- The offset is in deg ---*/
+      position = text_line.find ("NDIME=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        metadata[NDIME] = atoi(text_line.c_str());
+        metadata[FOUND_NDIME] = true;
+      }
       
-      su2double AoA_Current = config->GetAoA() + AoA_Offset;
+      /*--- The AoA and AoS offset values are optional. ---*/
       
-      if (config->GetDiscard_InFiles() == false) {
-        if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
-          cout.precision(6);
-          cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
-          cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
-        }
-        config->SetAoA_Offset(AoA_Offset);
-        config->SetAoA(AoA_Current);
+      position = text_line.find ("AOA_OFFSET=",0);
+      if (position != string::npos) {
+        text_line.erase (0,11);
+        offsets[0] = atof(text_line.c_str());
+        metadata[FOUND_AOA] = true;
       }
-      else {
-        if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
-          cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+      
+      position = text_line.find ("AOS_OFFSET=",0);
+      if (position != string::npos) {
+        text_line.erase (0,11);
+        offsets[1] = atof(text_line.c_str());
+        metadata[FOUND_AOS] = true;
       }
       
-    }
-    
-    position = text_line.find ("AOS_OFFSET=",0);
-    if (position != string::npos) {
-      su2double AoS_Offset = 0.0;
-      text_line.erase (0,11);
-      AoS_Offset = atof(text_line.c_str());
+      position = text_line.find ("NPOIN=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        metadata[NPOIN] = atol(text_line.c_str());
+        metadata[POINT_BEGIN] = scanner.Offset();
+        if (scanner.SkipLines(metadata[NPOIN]) != metadata[NPOIN]) {
+          SU2_MPI::Error("Unexpected end of the SU2 ASCII mesh file while skipping the points.", CURRENT_FUNCTION);
+        }
+        metadata[POINT_END] = scanner.Offset();
+        metadata[FOUND_NPOIN] = true;
+      }
       
-      /*--- The offset is in deg ---*/
+      position = text_line.find ("NELEM=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        metadata[NELEM] = atol(text_line.c_str());
+        metadata[ELEM_BEGIN] = scanner.Offset();
+        if (scanner.SkipLines(metadata[NELEM]) != metadata[NELEM]) {
+          SU2_MPI::Error("Unexpected end of the SU2 ASCII mesh file while skipping the elements.", CURRENT_FUNCTION);
+        }
+        metadata[ELEM_END] = scanner.Offset();
+        metadata[FOUND_NELEM] = true;
+      }
       
-      su2double AoS_Current = config->GetAoS() + AoS_Offset;
+      /*--- The markers are read from the start of this line. ---*/
       
-      if (config->GetDiscard_InFiles() == false) {
-        if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
-          cout.precision(6);
-          cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
-          cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
-        }
-        config->SetAoS_Offset(AoS_Offset);
-        config->SetAoS(AoS_Current);
+      position = text_line.find ("NMARK=",0);
+      if (position != string::npos) {
+        text_line.erase (0,6);
+        metadata[NMARK] = atoi(text_line.c_str());
+        metadata[MARKER_BEGIN] = lineOffset;
+        metadata[FOUND_NMARK] = true;
       }
-      else {
-        if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
-          cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+      
+      /* Stop before we reach the next zone then check for errors below. */
+      position = text_line.find ("IZONE=",0);
+      if (position != string::npos) {
+        break;
       }
       
+      lineOffset = scanner.Offset();
     }
     
-    position = text_line.find ("NPOIN=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfGlobalPoints = atoi(text_line.c_str());
-      for (unsigned long iPoint = 0; iPoint < numberOfGlobalPoints; iPoint++)
-        getline (mesh_file, text_line);
-      foundNPOIN = true;
-    }
+    /* Close the mesh file. */
+    fclose(fhr);
+  }
+  
+  SU2_MPI::Bcast(metadata, NUMBER_OF_METADATA, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(offsets, 2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  
+  dimension = metadata[NDIME];
+  numberOfGlobalPoints = metadata[NPOIN];
+  numberOfGlobalElements = metadata[NELEM];
+  numberOfMarkers = metadata[NMARK];
+  
+  pointByteRange[0] = metadata[POINT_BEGIN];
+  pointByteRange[1] = metadata[POINT_END];
+  elemByteRange[0] = metadata[ELEM_BEGIN];
+  elemByteRange[1] = metadata[ELEM_END];
+  markerByteOffset = metadata[MARKER_BEGIN];
+  
+  if (metadata[FOUND_AOA]) {
     
-    position = text_line.find ("NELEM=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfGlobalElements = atoi(text_line.c_str());
-      for (unsigned long iElem = 0; iElem < numberOfGlobalElements; iElem++)
-        getline (mesh_file, text_line);
-      foundNELEM = true;
-    }
+    su2double AoA_Offset = offsets[0];
     
-    position = text_line.find ("NMARK=",0);
-    if (position != string::npos) {
-      text_line.erase (0,6);
-      numberOfMarkers = atoi(text_line.c_str());
-      foundNMARK = true;
-    }
+    /*--- The offset is in deg ---*/
     
-    /* Stop before we reach the next zone then check for errors below. */
-    position = text_line.find ("IZONE=",0);
-    if (position != string::npos) {
-      break;
+    su2double AoA_Current = config->GetAoA() + AoA_Offset;
+    
+    if (config->GetDiscard_InFiles() == false) {
+      if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))  {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+        cout << "         AoA offset in mesh file (" << AoA_Offset << " deg.) = " << AoA_Current << " deg." << endl;
+      }
+      config->SetAoA_Offset(AoA_Offset);
+      config->SetAoA(AoA_Current);
     }
+    else {
+      if ((rank == MASTER_NODE) && (AoA_Offset != 0.0))
+        cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+    }
+    
   }
   
-  /* Close the mesh file. */
-  mesh_file.close();
+  if (metadata[FOUND_AOS]) {
+    
+    su2double AoS_Offset = offsets[1];
+    
+    /*--- The offset is in deg ---*/
+    
+    su2double AoS_Current = config->GetAoS() + AoS_Offset;
+    
+    if (config->GetDiscard_InFiles() == false) {
+      if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))  {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+        cout << "         AoS offset in mesh file (" << AoS_Offset << " deg.) = " << AoS_Current << " deg." << endl;
+      }
+      config->SetAoS_Offset(AoS_Offset);
+      config->SetAoS(AoS_Current);
+    }
+    else {
+      if ((rank == MASTER_NODE) && (AoS_Offset != 0.0))
+        cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+    }
+    
+  }
   
   /* Throw an error if any of the keywords was not found. */
-  if (!foundNDIME) {
+  if (!metadata[FOUND_NDIME]) {
     SU2_MPI::Error(string("Could not find NDIME= keyword.") +
                    string(" \n Check the SU2 ASCII file format."),
                    CURRENT_FUNCTION);
   }
-  if (!foundNPOIN) {
+  if (!metadata[FOUND_NPOIN]) {
     SU2_MPI::Error(string("Could not find NPOIN= keyword.") +
                    string(" \n Check the SU2 ASCII file format."),
                    CURRENT_FUNCTION);
   }
-  if (!foundNELEM) {
+  if (!metadata[FOUND_NELEM]) {
     SU2_MPI::Error(string("Could not find NELEM= keyword.") +
                    string(" \n Check the SU2 ASCII file format."),
                    CURRENT_FUNCTION);
   }
-  if (!foundNMARK) {
+  if (!metadata[FOUND_NMARK]) {
     SU2_MPI::Error(string("Could not find NMARK= keyword.") +
                    string(" \n Check the SU2 ASCII file format."),
                    CURRENT_FUNCTION);
@@ -1192,8 +1333,8 @@ void CSU2ASCIIMeshReaderFVM::ReadSurfaceElementConnectivity() {
    however, the surface connectivity is still handled by the
    master node (and eventually distributed by the master as well). ---*/
   
-  mesh_file.open(meshFilename, ios::in);
-  FastForwardToMyZone();
+  mesh_file.open(meshFilename, ios::in | ios::binary);
+  mesh_file.seekg(markerByteOffset);
   
   string text_line;
   string::size_type position;
@@ -1420,3 +1561,216 @@ void CSU2ASCIIMeshReaderFVM::FastForwardToMyZone() {
   }
   
 }
+
+void CSU2ASCIIMeshReaderFVM::ReadSectionInParallel(const unsigned long byteRange[2],
+                                                   unsigned long numberOfLines,
+                                                   vector<char>& lines,
+                                                   unsigned long& firstLine,
+                                                   unsigned long& numberOfLocalLines) const {
+
+  /*--- Each rank reads a linear partition of the bytes of the section and
+   takes the lines that start in it, i.e. a line that crosses the end of
+   the partition is completed with bytes past it. ---*/
+
+  CLinearPartitioner bytePartitioner(byteRange[1]-byteRange[0], 0);
+
+  const unsigned long chunkBegin = byteRange[0] + bytePartitioner.GetFirstIndexOnRank(rank);
+  const unsigned long chunkEnd = chunkBegin + bytePartitioner.GetSizeOnRank(rank);
+
+  /*--- The byte before the partition tells whether a line starts at its beginning. ---*/
+
+  const unsigned long readBegin = (chunkBegin > byteRange[0])? chunkBegin-1 : chunkBegin;
+
+  FILE* fhr = fopen(meshFilename.c_str(), "rb");
+  if (fhr == nullptr) {
+    SU2_MPI::Error(string("Error opening SU2 ASCII grid.") +
+                   string(" \n Check that the file exists."), CURRENT_FUNCTION);
+  }
+
+  auto readBytes = [&](unsigned long offset, unsigned long nBytes) {
+    const auto start = lines.size();
+    lines.resize(start+nBytes);
+    if (fseek(fhr, offset, SEEK_SET) != 0 ||
+        fread(lines.data()+start, 1, nBytes, fhr) != nBytes) {
+      SU2_MPI::Error("Unexpected end of the SU2 ASCII mesh file.", CURRENT_FUNCTION);
+    }
+  };
+
+  lines.clear();
+  if (chunkEnd > chunkBegin) readBytes(readBegin, chunkEnd-readBegin);
+
+  /*--- First line that starts in the partition. ---*/
+
+  unsigned long lineBegin = 0;
+  if (readBegin < chunkBegin) {
+    auto pos = static_cast<const char*>(memchr(lines.data(), '\n', lines.size()));
+    lineBegin = (pos == nullptr)? lines.size() : pos - lines.data() + 1;
+  }
+
+  /*--- Complete the last line with the bytes that follow the partition,
+   the first line feed at or after the last byte ends it. ---*/
+
+  unsigned long lineEnd = lineBegin;
+  if (lineBegin < lines.size()) {
+    const unsigned long lastByte = chunkEnd-1-readBegin;
+    const unsigned long extraBytes = 4096;
+
+    while (true) {
+      auto pos = static_cast<const char*>(memchr(lines.data()+lastByte, '\n', lines.size()-lastByte));
+      if (pos != nullptr) {
+        lineEnd = pos - lines.data() + 1;
+        break;
+      }
+      const unsigned long readEnd = readBegin + lines.size();
+      if (readEnd == byteRange[1]) {
+        lineEnd = lines.size();
+        break;
+      }
+      readBytes(readEnd, min(extraBytes, byteRange[1]-readEnd));
+    }
+  }
+  fclose(fhr);
+
+  /*--- Keep only the lines of this rank and terminate the buffer for the parsers. ---*/
+
+  lines.resize(lineEnd);
+  lines.erase(lines.begin(), lines.begin()+lineBegin);
+
+  numberOfLocalLines = count(lines.begin(), lines.end(), '\n');
+  if (!lines.empty() && lines.back() != '\n') numberOfLocalLines++;
+  lines.push_back('\0');
+
+  /*--- Global index of our first line. ---*/
+
+  vector<unsigned long> linesPerRank(size);
+  SU2_MPI::Allgather(&numberOfLocalLines, 1, MPI_UNSIGNED_LONG,
+                     linesPerRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  firstLine = 0;
+  for (int iRank = 0; iRank < rank; iRank++) firstLine += linesPerRank[iRank];
+
+  if (accumulate(linesPerRank.begin(), linesPerRank.end(), 0ul) != numberOfLines) {
+    SU2_MPI::Error(string("Unexpected number of lines in a section of the SU2 ASCII mesh.") +
+                   string(" \n Check the SU2 ASCII file format (no empty lines between records)."),
+                   CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2ASCIIMeshReaderFVM::ReadPointCoordinatesParallel() {
+
+  vector<char> lines;
+  unsigned long firstLine = 0, numberOfLines = 0;
+
+  ReadSectionInParallel(pointByteRange, numberOfGlobalPoints, lines, firstLine, numberOfLines);
+
+  /*--- Parse the coordinates, anything after them on the line (the point index) is ignored. ---*/
+
+  vector<passivedouble> coords(numberOfLines*dimension);
+
+  const char* pos = lines.data();
+  for (unsigned long iLine = 0; iLine < numberOfLines; iLine++) {
+    for (int iDim = 0; iDim < dimension; iDim++) {
+      if (!ParsingToolbox::ParseDouble(pos, coords[iLine*dimension+iDim])) {
+        SU2_MPI::Error(string("Could not read the coordinates of point ") +
+                       to_string(firstLine+iLine) + string(" of the SU2 ASCII mesh."), CURRENT_FUNCTION);
+      }
+    }
+    ParsingToolbox::SkipLine(pos);
+  }
+  vector<char>().swap(lines);
+
+  /*--- Send the points to their owners in the linear partitioning, both the
+   lines read and the owned points are contiguous ranges of global indices. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  vector<unsigned long> firstLinePerRank(size), linesPerRank(size);
+  SU2_MPI::Allgather(&firstLine, 1, MPI_UNSIGNED_LONG, firstLinePerRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&numberOfLines, 1, MPI_UNSIGNED_LONG, linesPerRank.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  auto overlap = [](unsigned long begin1, unsigned long end1, unsigned long begin2, unsigned long end2) {
+    const auto begin = max(begin1, begin2), end = min(end1, end2);
+    return (end > begin)? end-begin : 0ul;
+  };
+
+  const unsigned long myFirstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  vector<int> nSend(size), nRecv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    const auto firstPoint = pointPartitioner.GetFirstIndexOnRank(iRank);
+    nSend[iRank] = dimension * overlap(firstLine, firstLine+numberOfLines,
+                                       firstPoint, firstPoint+pointPartitioner.GetSizeOnRank(iRank));
+    nRecv[iRank] = dimension * overlap(firstLinePerRank[iRank], firstLinePerRank[iRank]+linesPerRank[iRank],
+                                       myFirstPoint, myFirstPoint+numberOfLocalPoints);
+    sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+    recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+  }
+
+  vector<passivedouble> localCoords(numberOfLocalPoints*dimension);
+
+  SU2_MPI::Alltoallv(coords.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE,
+                     localCoords.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+  localPointCoordinates.resize(dimension);
+  for (int iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[iDim][iPoint] = localCoords[iPoint*dimension+iDim];
+  }
+
+}
+
+void CSU2ASCIIMeshReaderFVM::ReadVolumeElementConnectivityParallel() {
+
+  vector<char> lines;
+  unsigned long firstLine = 0, numberOfLines = 0;
+
+  ReadSectionInParallel(elemByteRange, numberOfGlobalElements, lines, firstLine, numberOfLines);
+
+  /*--- Parse the elements into [globalID vtkType n0 ... n7] records, the
+   element index at the end of the lines is ignored, the global index
+   is the position of the element in the section. ---*/
+
+  vector<unsigned long> connElems(numberOfLines*SU2_CONN_SIZE, 0);
+
+  const char* pos = lines.data();
+  for (unsigned long iLine = 0; iLine < numberOfLines; iLine++) {
+
+    unsigned long* record = &connElems[iLine*SU2_CONN_SIZE];
+    record[0] = firstLine+iLine;
+
+    unsigned long VTK_Type = 0;
+    bool success = ParsingToolbox::ParseUnsigned(pos, VTK_Type);
+
+    unsigned short nNodes = 0;
+    switch (VTK_Type) {
+      case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNodes = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNodes = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNodes = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNodes = N_POINTS_PYRAMID;       break;
+      default: success = false; break;
+    }
+    record[1] = VTK_Type;
+
+    for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+      success = success && ParsingToolbox::ParseUnsigned(pos, record[SU2_CONN_SKIP+iNode]);
+
+    if (!success) {
+      SU2_MPI::Error(string("Could not read volume element ") + to_string(firstLine+iLine) +
+                     string(" of the SU2 ASCII mesh.\n Check the element type and connectivity."),
+                     CURRENT_FUNCTION);
+    }
+    ParsingToolbox::SkipLine(pos);
+  }
+  vector<char>().swap(lines);
+
+  /*--- Each rank keeps the elements that contain one of its points. ---*/
+
+  DistributeVolumeElements(connElems);
+
+}
@@ -0,0 +1,252 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+#include <limits>
+
+static_assert(sizeof(unsigned long) == 8 && sizeof(passivedouble) == 8,
+              "The SU2 binary mesh format requires 8 byte unsigned longs and doubles.");
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(CConfig        *val_config,
+                                                 unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+: CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+
+  /* Single surface actuator disks are split by the ASCII reader, the
+   binary files are expected to already contain the repeated points. */
+  bool actuator_disk = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                         (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                        ((config->GetKind_SU2() == SU2_CFD) ||
+                         ((config->GetKind_SU2() == SU2_DEF) &&
+                          (config->GetActDisk_SU2_DEF()))));
+  if (actuator_disk && !config->GetActDisk_DoubleSurface()) {
+    SU2_MPI::Error(string("Actuator disk splitting is not supported by the SU2 binary mesh reader.\n") +
+                   string("Convert a mesh with double surfaces (repeated points) or use the ASCII format."),
+                   CURRENT_FUNCTION);
+  }
+
+  /* Store the current zone to be read and the total number of zones. */
+  myZone = val_iZone;
+  nZones = val_nZone;
+
+  /* All ranks open the file, the data of each rank is at a known location. */
+  meshFilename = config->GetMesh_FileName();
+
+#ifdef HAVE_MPI
+  int ierr = MPI_File_open(MPI_COMM_WORLD, meshFilename.c_str(), MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &mesh_file);
+  if (ierr != MPI_SUCCESS) {
+    SU2_MPI::Error(string("Error opening SU2 binary grid ") + meshFilename +
+                   string(".\n Check that the file exists."), CURRENT_FUNCTION);
+  }
+  MPI_Type_contiguous(sizeof(unsigned long), MPI_BYTE, &wordType);
+  MPI_Type_commit(&wordType);
+#else
+  mesh_file = fopen(meshFilename.c_str(), "rb");
+  if (!mesh_file) {
+    SU2_MPI::Error(string("Error opening SU2 binary grid ") + meshFilename +
+                   string(".\n Check that the file exists."), CURRENT_FUNCTION);
+  }
+#endif
+
+  /* Read the header of our zone and perform some basic error checks. */
+  ReadMetadata();
+
+  /* Read and store the points, interior elements, and surface elements.
+   We store only the points and interior elements on our rank's linear
+   partition, but the master stores the entire set of surface connectivity. */
+  ReadPointCoordinates();
+  ReadVolumeElementConnectivity();
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_Type_free(&wordType);
+  MPI_File_close(&mesh_file);
+#else
+  fclose(mesh_file);
+#endif
+
+}
+
+CSU2BinaryMeshReaderFVM::~CSU2BinaryMeshReaderFVM(void) { }
+
+void CSU2BinaryMeshReaderFVM::ReadWords(void *data, unsigned long nWords, unsigned long offset, bool collective) {
+
+#ifdef HAVE_MPI
+  if (nWords > (unsigned long)std::numeric_limits<int>::max()) {
+    SU2_MPI::Error("The SU2 binary mesh is too large for the number of ranks, use more ranks.", CURRENT_FUNCTION);
+  }
+
+  int ierr;
+  if (collective)
+    ierr = MPI_File_read_at_all(mesh_file, MPI_Offset(offset), data, int(nWords), wordType, MPI_STATUS_IGNORE);
+  else
+    ierr = MPI_File_read_at(mesh_file, MPI_Offset(offset), data, int(nWords), wordType, MPI_STATUS_IGNORE);
+
+  if (ierr != MPI_SUCCESS)
+    SU2_MPI::Error(string("Error reading SU2 binary grid ") + meshFilename, CURRENT_FUNCTION);
+#else
+  if ((fseek(mesh_file, long(offset), SEEK_SET) != 0) ||
+      (fread(data, sizeof(unsigned long), nWords, mesh_file) != nWords))
+    SU2_MPI::Error(string("Error reading SU2 binary grid ") + meshFilename, CURRENT_FUNCTION);
+#endif
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+
+  /*--- The master follows the index of the zones up to our zone and
+   broadcasts its header. For single zone and harmonic balance problems
+   (all instances share the same mesh) the first zone is read. ---*/
+
+  const bool multizone_file = (nZones > 1) && config->GetMultizone_Mesh();
+  const unsigned short readZone = multizone_file? myZone : 0;
+
+  if (rank == MASTER_NODE) {
+    unsigned long zoneOffset = 0;
+    for (unsigned short iZone = 0; iZone <= readZone; iZone++) {
+      ReadWords(zoneHeader, SU2_BINARY_HEADER_SIZE, zoneOffset, false);
+
+      if ((zoneHeader[BIN_MESH_MAGIC] != SU2_BINARY_MESH_MAGIC) ||
+          (zoneHeader[BIN_MESH_VERSION] != SU2_BINARY_MESH_VERSION)) {
+        SU2_MPI::Error(string("File ") + meshFilename + string(" is not an SU2 binary mesh (version ") +
+                       to_string(SU2_BINARY_MESH_VERSION) + string(").\n") +
+                       string("Binary meshes are created by SU2_DEF with MESH_OUT_FORMAT= SU2_BINARY."),
+                       CURRENT_FUNCTION);
+      }
+      if (readZone >= zoneHeader[BIN_MESH_NZONE]) {
+        SU2_MPI::Error(string("Could not find zone ") + to_string(readZone) + string(" in ") + meshFilename,
+                       CURRENT_FUNCTION);
+      }
+      zoneOffset = zoneHeader[BIN_MESH_NEXT_ZONE];
+    }
+    if (multizone_file)
+      cout << "Reading zone " << myZone << " from native SU2 binary mesh." << endl;
+  }
+
+  SU2_MPI::Bcast(zoneHeader, SU2_BINARY_HEADER_SIZE, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  dimension              = zoneHeader[BIN_MESH_NDIM];
+  numberOfGlobalPoints   = zoneHeader[BIN_MESH_NPOIN];
+  numberOfGlobalElements = zoneHeader[BIN_MESH_NELEM];
+  numberOfMarkers        = zoneHeader[BIN_MESH_NMARK];
+
+  if ((dimension != 2) && (dimension != 3)) {
+    SU2_MPI::Error(string("Invalid dimension in SU2 binary grid ") + meshFilename, CURRENT_FUNCTION);
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints,0);
+
+  /* Our points are contiguous in the file, read them with one call. */
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<passivedouble> coords(numberOfLocalPoints*dimension);
+
+  ReadWords(coords.data(), coords.size(),
+            zoneHeader[BIN_MESH_POINT_OFFSET] + firstPoint*dimension*sizeof(passivedouble), true);
+
+  /* Load into the coordinate class data structure. */
+  localPointCoordinates.resize(dimension);
+  for (int k = 0; k < dimension; k++) {
+    localPointCoordinates[k].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++)
+      localPointCoordinates[k][iPoint] = coords[iPoint*dimension + k];
+  }
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+
+  /*--- Each rank reads a linear partition of the elements, then the elements
+   are sent to every rank that owns one of their points in the linear
+   partitioning of the points. ---*/
+
+  CLinearPartitioner elementPartitioner(numberOfGlobalElements,0);
+  const unsigned long nElemRead = elementPartitioner.GetSizeOnRank(rank);
+  const unsigned long firstElem = elementPartitioner.GetFirstIndexOnRank(rank);
+
+  vector<unsigned long> connElems(nElemRead*SU2_CONN_SIZE);
+
+  ReadWords(connElems.data(), connElems.size(),
+            zoneHeader[BIN_MESH_ELEM_OFFSET] + firstElem*SU2_CONN_SIZE*sizeof(unsigned long), true);
+
+  DistributeVolumeElements(connElems);
+
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+
+  /*--- Only the master stores the surface connectivity. Each marker is
+   stored as [nameLength nElemBound], the name padded to a multiple of
+   8 bytes, and the element records. ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  surfaceElementConnectivity.resize(numberOfMarkers);
+  markerNames.resize(numberOfMarkers);
+
+  unsigned long offset = zoneHeader[BIN_MESH_MARKER_OFFSET];
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+
+    unsigned long markerInfo[2];
+    ReadWords(markerInfo, 2, offset, false);
+    offset += 2*sizeof(unsigned long);
+
+    const unsigned long nameWords = (markerInfo[0] + sizeof(unsigned long)-1) / sizeof(unsigned long);
+    vector<char> name(nameWords*sizeof(unsigned long));
+    ReadWords(name.data(), nameWords, offset, false);
+    offset += nameWords*sizeof(unsigned long);
+
+    markerNames[iMarker].assign(name.data(), markerInfo[0]);
+
+    if (markerNames[iMarker] == "SEND_RECEIVE") {
+      SU2_MPI::Error(string("Mesh file contains deprecated SEND_RECEIVE marker!\n\n") +
+                     string("Please remove any SEND_RECEIVE markers from the SU2 mesh."),
+                     CURRENT_FUNCTION);
+    }
+
+    surfaceElementConnectivity[iMarker].resize(markerInfo[1]*SU2_CONN_SIZE);
+    ReadWords(surfaceElementConnectivity[iMarker].data(), markerInfo[1]*SU2_CONN_SIZE, offset, false);
+    offset += markerInfo[1]*SU2_CONN_SIZE*sizeof(unsigned long);
+
+    if ((dimension == 3) && (markerInfo[1] > 0) && (surfaceElementConnectivity[iMarker][1] == LINE)) {
+      SU2_MPI::Error(string("Line boundary conditions are not possible for 3D calculations.") +
+                     string("Please check the SU2 binary mesh file."), CURRENT_FUNCTION);
+    }
+  }
+
+}
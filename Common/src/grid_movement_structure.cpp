@@ -216,6 +216,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner<su2double>(StiffMatrix, geometry, config, false);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner();
+    		mat_vec = new CSysMatrixVectorProduct<su2double>(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner<su2double>(StiffMatrix, geometry, config, false);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
@@ -234,6 +240,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProductTransposed<su2double>(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner<su2double>(StiffMatrix, geometry, config, true);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner(true);
+    		mat_vec = new CSysMatrixVectorProductTransposed<su2double>(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner<su2double>(StiffMatrix, geometry, config, true);
+    	}
 
     }
     
@@ -546,6 +558,9 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
   
   /*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
   
+  double tick = 0.0;
+  config->Tick(&tick);
+
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
     
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
@@ -576,9 +591,11 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     if (nDim == 2) SetFEA_StiffMatrix2D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
     if (nDim == 3) SetFEA_StiffMatrix3D(geometry, config, StiffMatrix_Elem, PointCorners, CoordCorners, nNodes, ElemVolume, ElemDistance);
     
-    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, PointCorners, nNodes);
+    AddFEA_StiffMatrix(geometry, StiffMatrix_Elem, iElem, nNodes);
     
   }
+
+  config->Tock(tick, "SetFEAMethodContributions_Elem", 2);
   
   /*--- Deallocate memory and exit ---*/
   
@@ -1570,7 +1587,7 @@ void CVolumetricMovement::SetFEA_StiffMatrix3D(CGeometry *geometry, CConfig *con
   
 }
 
-void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long PointCorners[8], unsigned short nNodes) {
+void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **StiffMatrix_Elem, unsigned long iElem, unsigned short nNodes) {
   
   unsigned short iVar, jVar, iDim, jDim;
   
@@ -1597,7 +1614,7 @@ void CVolumetricMovement::AddFEA_StiffMatrix(CGeometry *geometry, su2double **St
         }
       }
 
-      StiffMatrix.AddBlock(PointCorners[iVar], PointCorners[jVar], StiffMatrix_Node);
+      StiffMatrix.AddElemBlock(iElem, nNodes, iVar, jVar, StiffMatrix_Node);
       
     }
   }
@@ -9678,7 +9695,7 @@ void CElasticityMovement::SetStiffnessMatrix(CGeometry *geometry, CConfig *confi
           }
         }
 
-        StiffMatrix.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_ij);
+        StiffMatrix.AddElemBlock(iElem, NelNodes, iNode, jNode, Jacobian_ij);
 
       }
 
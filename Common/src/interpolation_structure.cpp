@@ -25,6 +25,11 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../include/interpolation_structure.hpp"
+#include "../include/adt_structure.hpp"
+#include <numeric>
+#include <unordered_map>
+#include <map>
+#include <array>
 
 #if defined(HAVE_MKL)
 #include "mkl.h"
@@ -596,126 +601,202 @@ CNearestNeighbor::~CNearestNeighbor() {}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
-  int iProcessor, pProcessor, nProcessor = size;
-  int markDonor, markTarget;
+  /*--- The donor points are not gathered on all ranks. Each rank determines a
+   search box around its target points, that is guaranteed to contain their
+   nearest donors, and receives only the donor points inside it. The nearest
+   donors are then found with an ADT of the received points. ---*/
 
-  unsigned short nDim, iMarkerInt, nMarkerInt, iDonor;    
+  const unsigned short nDim = donor_geometry->GetnDim();
+  const unsigned short nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
+  const su2double big = numeric_limits<passivedouble>::max();
 
-  unsigned long nVertexDonor, nVertexTarget, Point_Target, jVertex, iVertexTarget;
-  unsigned long Global_Point_Donor;
-  long pGlobalPoint = 0;
+  for (unsigned short iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
 
-  su2double *Coord_i, *Coord_j, dist, mindist, maxdist;
+    /*--- On the donor side: find the tag of the boundary sharing the interface ---*/
+    const int markDonor = Find_InterfaceMarker(config[donorZone], iMarkerInt);
 
-  /*--- Initialize variables --- */
-  
-  nMarkerInt = (int) ( config[donorZone]->GetMarker_n_ZoneInterface() / 2 );
-  
-  nDim = donor_geometry->GetnDim();
+    /*--- On the target side: find the tag of the boundary sharing the interface ---*/
+    const int markTarget = Find_InterfaceMarker(config[targetZone], iMarkerInt);
 
-  iDonor = 0;
-  
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
+    /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
+    if( !CheckInterfaceBoundary(markDonor, markTarget) )
+      continue;
 
+    const unsigned long nVertexDonor = (markDonor != -1)? donor_geometry->GetnVertex(markDonor) : 0;
+    const unsigned long nVertexTarget = (markTarget != -1)? target_geometry->GetnVertex(markTarget) : 0;
 
-  /*--- Cycle over nMarkersInt interface to determine communication pattern ---*/
+    /*--- Donor points owned by this rank and their bounding box, [min max] for each dimension. ---*/
 
-  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
+    vector<su2double> donorCoord, donorBox(2*nDim);
+    vector<long> donorGlobalPoint;
 
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      donorBox[2*iDim] = big;
+      donorBox[2*iDim+1] = -big;
+    }
 
-    /*--- On the donor side: find the tag of the boundary sharing the interface ---*/
-    markDonor  = Find_InterfaceMarker(config[donorZone],  iMarkerInt);
-      
-    /*--- On the target side: find the tag of the boundary sharing the interface ---*/
-    markTarget = Find_InterfaceMarker(config[targetZone], iMarkerInt);
+    for (unsigned long iVertex = 0; iVertex < nVertexDonor; iVertex++) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->node[iPoint]->GetDomain()) continue;
 
-    /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
-    if( !CheckInterfaceBoundary(markDonor, markTarget) )
-      continue;
+      donorGlobalPoint.push_back(donor_geometry->node[iPoint]->GetGlobalIndex());
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const su2double coord = donor_geometry->node[iPoint]->GetCoord(iDim);
+        donorCoord.push_back(coord);
+        donorBox[2*iDim] = min(donorBox[2*iDim], coord);
+        donorBox[2*iDim+1] = max(donorBox[2*iDim+1], coord);
+      }
+    }
+    unsigned long nDonor = donorGlobalPoint.size();
 
-    if(markDonor != -1)
-      nVertexDonor  = donor_geometry->GetnVertex( markDonor );
-    else
-      nVertexDonor  = 0;
-    
-    if(markTarget != -1)
-      nVertexTarget = target_geometry->GetnVertex( markTarget );
-    else
-      nVertexTarget  = 0;
-    
-    Buffer_Send_nVertex_Donor  = new unsigned long [ 1 ];
+    vector<su2double> allDonorBoxes(2*nDim*size);
+    vector<unsigned long> allDonorCounts(size);
+    SU2_MPI::Allgather(donorBox.data(), 2*nDim, MPI_DOUBLE, allDonorBoxes.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(&nDonor, 1, MPI_UNSIGNED_LONG, allDonorCounts.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
 
-    /* Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor */
-    Determine_ArraySize(false, markDonor, markTarget, nVertexDonor, nDim);
+    /*--- Search box of the target points. The distance from a target to the farthest
+     corner of the bounding box of a rank bounds the distance to all donors of that
+     rank, hence the smallest such distance bounds the distance to the nearest donor. ---*/
 
-    Buffer_Send_Coord          = new su2double     [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint    = new long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord       = new su2double     [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new long [ nProcessor * MaxLocalVertex_Donor ];
+    vector<unsigned long> targetVertex;
+    vector<su2double> searchBox(2*nDim);
 
-    /*-- Collect coordinates, global points, and normal vectors ---*/
-    Collect_VertexInfo( false, markDonor, markTarget, nVertexDonor, nDim );
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      searchBox[2*iDim] = big;
+      searchBox[2*iDim+1] = -big;
+    }
+    su2double searchRadius2 = 0.0;
+
+    for (unsigned long iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+
+      targetVertex.push_back(iVertex);
+      const su2double* coord = target_geometry->node[iPoint]->GetCoord();
+
+      su2double bound2 = big;
+      for (int iRank = 0; iRank < size; iRank++) {
+        if (allDonorCounts[iRank] == 0) continue;
+        const su2double* box = &allDonorBoxes[2*nDim*iRank];
+        su2double dist2 = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          dist2 += max(pow(coord[iDim]-box[2*iDim], 2), pow(coord[iDim]-box[2*iDim+1], 2));
+        bound2 = min(bound2, dist2);
+      }
+      searchRadius2 = max(searchRadius2, bound2);
 
-    /*--- Compute the closest point to a Near-Field boundary point ---*/
-    maxdist = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        searchBox[2*iDim] = min(searchBox[2*iDim], coord[iDim]);
+        searchBox[2*iDim+1] = max(searchBox[2*iDim+1], coord[iDim]);
+      }
+    }
 
-    for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+    if (!targetVertex.empty()) {
+      const su2double searchRadius = sqrt(searchRadius2);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        searchBox[2*iDim] -= searchRadius;
+        searchBox[2*iDim+1] += searchRadius;
+      }
+    }
 
-      Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
+    vector<su2double> allSearchBoxes(2*nDim*size);
+    SU2_MPI::Allgather(searchBox.data(), 2*nDim, MPI_DOUBLE, allSearchBoxes.data(), 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
 
-      if ( target_geometry->node[Point_Target]->GetDomain() ) {
+    /*--- Send each donor point to the ranks whose search box contains it. ---*/
 
-        target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
-        target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo(); // Possible meme leak?
+    vector<vector<unsigned long> > sendDonors(size);
 
-        /*--- Coordinates of the boundary point ---*/
-        Coord_i = target_geometry->node[Point_Target]->GetCoord();
+    for (int iRank = 0; iRank < size; iRank++) {
+      const su2double* box = &allSearchBoxes[2*nDim*iRank];
+      for (unsigned long iDonor = 0; iDonor < nDonor; iDonor++) {
+        bool inside = true;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          const su2double coord = donorCoord[iDonor*nDim+iDim];
+          inside = inside && (coord >= box[2*iDim]) && (coord <= box[2*iDim+1]);
+        }
+        if (inside) sendDonors[iRank].push_back(iDonor);
+      }
+    }
 
-        mindist    = 1E6; 
-        pProcessor = 0;
+    vector<int> nSend(size), nRecv(size), sendDispl(size+1,0), recvDispl(size+1,0);
+    for (int iRank = 0; iRank < size; iRank++) nSend[iRank] = sendDonors[iRank].size();
 
-        /*--- Loop over all the boundaries to find the pair ---*/
+    SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
 
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (jVertex = 0; jVertex < MaxLocalVertex_Donor; jVertex++) {
-           
-            Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
-            
-            if (Buffer_Receive_GlobalPoint[Global_Point_Donor] != -1){
-              
-              Coord_j = &Buffer_Receive_Coord[ Global_Point_Donor*nDim];
-              
-              dist = PointsDistance(Coord_i, Coord_j);
-              
-              if (dist < mindist) {
-                mindist = dist; pProcessor = iProcessor; 
-                pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];                
-              }
-              
-              if (dist == 0.0) break;
-            }
-          }
-        }
+    for (int iRank = 0; iRank < size; iRank++) {
+      sendDispl[iRank+1] = sendDispl[iRank] + nSend[iRank];
+      recvDispl[iRank+1] = recvDispl[iRank] + nRecv[iRank];
+    }
+
+    vector<su2double> sendCoord(nDim*sendDispl[size]), recvCoord(nDim*recvDispl[size]);
+    vector<long> sendGlobalPoint(sendDispl[size]), recvGlobalPoint(recvDispl[size]);
 
-        /*--- Store the value of the pair ---*/
-        maxdist = max(maxdist, mindist);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, pGlobalPoint);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, pProcessor);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor, 1.0);
+    for (int iRank = 0; iRank < size; iRank++) {
+      for (unsigned long k = 0; k < sendDonors[iRank].size(); k++) {
+        const auto iDonor = sendDonors[iRank][k];
+        const auto iSend = sendDispl[iRank] + k;
+        sendGlobalPoint[iSend] = donorGlobalPoint[iDonor];
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          sendCoord[iSend*nDim+iDim] = donorCoord[iDonor*nDim+iDim];
       }
     }
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-    
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
+    SU2_MPI::Alltoallv(sendGlobalPoint.data(), nSend.data(), sendDispl.data(), MPI_LONG,
+                       recvGlobalPoint.data(), nRecv.data(), recvDispl.data(), MPI_LONG, MPI_COMM_WORLD);
 
-    delete[] Buffer_Send_nVertex_Donor;
+    for (int iRank = 0; iRank < size; iRank++) {
+      nSend[iRank] *= nDim; sendDispl[iRank] *= nDim;
+      nRecv[iRank] *= nDim; recvDispl[iRank] *= nDim;
+    }
+
+    SU2_MPI::Alltoallv(sendCoord.data(), nSend.data(), sendDispl.data(), MPI_DOUBLE,
+                       recvCoord.data(), nRecv.data(), recvDispl.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+
+    /*--- Rank owning each received donor. ---*/
+
+    const unsigned long nRecvDonor = recvGlobalPoint.size();
+    vector<unsigned long> recvIndex(nRecvDonor);
+    vector<int> recvRank(nRecvDonor);
+
+    for (int iRank = 0; iRank < size; iRank++)
+      for (int k = recvDispl[iRank]/nDim; k < (recvDispl[iRank]+nRecv[iRank])/nDim; k++)
+        recvRank[k] = iRank;
+    iota(recvIndex.begin(), recvIndex.end(), 0ul);
+
+    /*--- Find the nearest donor of each target point. If there are no donors the
+     donor is left as point 0 of rank 0, as the original brute force search did. ---*/
 
+    CADTPointsOnlyClass* donorTree = nullptr;
+    if (nRecvDonor > 0)
+      donorTree = new CADTPointsOnlyClass(nDim, nRecvDonor, recvCoord.data(), recvIndex.data(), false);
+
+    for (auto iVertex : targetVertex) {
+
+      auto vertex = target_geometry->vertex[markTarget][iVertex];
+
+      vertex->SetnDonorPoints(1);
+      vertex->Allocate_DonorInfo();
+
+      long donorPoint = 0;
+      int donorRank = 0;
+
+      if (donorTree != nullptr) {
+        su2double dist;
+        unsigned long index;
+        int treeRank;
+        donorTree->DetermineNearestNode(target_geometry->node[vertex->GetNode()]->GetCoord(), dist, index, treeRank);
+        donorPoint = recvGlobalPoint[index];
+        donorRank = recvRank[index];
+      }
+
+      vertex->SetInterpDonorPoint(0, donorPoint);
+      vertex->SetInterpDonorProcessor(0, donorRank);
+      vertex->SetDonorCoeff(0, 1.0);
+    }
+
+    delete donorTree;
   }
 
-  delete[] Buffer_Receive_nVertex_Donor;
 }
 
 
@@ -1427,44 +1508,40 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
       Buffer_Receive_Coeff[iVertex] = Buffer_Send_Coeff[iVertex];
     }
 #endif
+    /*--- Map each target point to the received entries that refer to it (processor and index),
+     in the order of the processors and faces, to avoid searching all entries for each vertex. ---*/
+    unordered_map<long, vector<pair<int, unsigned long> > > targetEntries;
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
+        faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
+        iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
+        for (iTarget=0; iTarget<iNodes; iTarget++) {
+          targetEntries[Buffer_Receive_GlobalPoint[faceindex+iTarget]].emplace_back(iProcessor, faceindex+iTarget);
+        }
+      }
+    }
+
     /*--- Loop over the vertices on the target Marker ---*/
     for (iVertex = 0; iVertex<nVertexTarget; iVertex++) {
 
       iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
       if (target_geometry->node[iPoint]->GetDomain()) {
         long Global_Point = target_geometry->node[iPoint]->GetGlobalIndex();
-        nNodes = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++) {
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget])
-                nNodes++;
-            }
-          }
-        }
+
+        auto it = targetEntries.find(Global_Point);
+        nNodes = (it != targetEntries.end())? it->second.size() : 0;
 
         target_geometry->vertex[markTarget][iVertex]->SetnDonorPoints(nNodes);
         target_geometry->vertex[markTarget][iVertex]->Allocate_DonorInfo();
 
-        iDonor = 0;
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (iFace = 0; iFace < Buffer_Receive_nFace_Donor[iProcessor]; iFace++) {
-
-            faceindex = Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace]; // first index of this face
-            iNodes = (unsigned int)Buffer_Receive_FaceIndex[iProcessor*MaxFace_Donor+iFace+1]- (unsigned int)faceindex;
-            for (iTarget=0; iTarget<iNodes; iTarget++) {
-              if (Global_Point == Buffer_Receive_GlobalPoint[faceindex+iTarget]) {
-                coeff = Buffer_Receive_Coeff[faceindex+iTarget];
-                pGlobalPoint = Buffer_Receive_FaceNodes[faceindex+iTarget];
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
-                target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
-                target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, iProcessor);
-                iDonor++;
-              }
-            }
-          }
+        for (iDonor = 0; iDonor < nNodes; iDonor++) {
+          const auto& entry = it->second[iDonor];
+          coeff = Buffer_Receive_Coeff[entry.second];
+          pGlobalPoint = Buffer_Receive_FaceNodes[entry.second];
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorPoint(iDonor,pGlobalPoint);
+          target_geometry->vertex[markTarget][iVertex]->SetDonorCoeff(iDonor,coeff);
+          target_geometry->vertex[markTarget][iVertex]->SetInterpDonorProcessor(iDonor, entry.first);
         }
       }
     }
@@ -2723,6 +2800,147 @@ bool CSlidingMesh::CheckPointInsideTriangle(su2double* Point, su2double* T1, su2
 }
 
 /*--- Radial Basis Function Interpolator ---*/
+namespace {
+
+/*!
+ * \brief Uniform grid of buckets (of the size of the search radius) used to find the points within a radius.
+ */
+class CPointBuckets {
+private:
+  unsigned short nDim;
+  passivedouble radius;
+  const passivedouble* coord;
+  passivedouble origin[3] = {0.0};
+  unsigned long nBucket[3] = {1, 1, 1};
+  unordered_map<unsigned long, vector<unsigned long> > buckets;
+
+public:
+  CPointBuckets(unsigned short nDim_, unsigned long nPoint, const passivedouble* coord_, passivedouble radius_) :
+    nDim(nDim_), radius(radius_), coord(coord_) {
+
+    if (nPoint == 0) return;
+
+    passivedouble upper[3] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      origin[iDim] = upper[iDim] = coord[iDim];
+      for (unsigned long iPoint = 1; iPoint < nPoint; iPoint++) {
+        origin[iDim] = min(origin[iDim], coord[iPoint*nDim+iDim]);
+        upper[iDim] = max(upper[iDim], coord[iPoint*nDim+iDim]);
+      }
+      nBucket[iDim] = static_cast<unsigned long>((upper[iDim]-origin[iDim]) / radius) + 1;
+    }
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+      long cell[3] = {0, 0, 0};
+      GetCell(&coord[iPoint*nDim], cell);
+      buckets[GetKey(cell)].push_back(iPoint);
+    }
+  }
+
+  /*!
+   * \brief Bucket that contains "x", may be outside of the grid.
+   */
+  void GetCell(const passivedouble* x, long* cell) const {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      cell[iDim] = static_cast<long>(floor((x[iDim]-origin[iDim]) / radius));
+  }
+
+  /*!
+   * \brief Call "func(iPoint)" for the points in the buckets up to "nLayer" away from "cell".
+   */
+  template<class F>
+  void ForEachPointNear(const long* cell, long nLayer, F func) const {
+
+    long first[3] = {0, 0, 0}, last[3] = {0, 0, 0};
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      first[iDim] = max(cell[iDim]-nLayer, 0l);
+      last[iDim] = min(cell[iDim]+nLayer, long(nBucket[iDim])-1);
+    }
+
+    long idx[3] = {0, 0, 0};
+    for (idx[2] = first[2]; idx[2] <= last[2]; idx[2]++) {
+      for (idx[1] = first[1]; idx[1] <= last[1]; idx[1]++) {
+        for (idx[0] = first[0]; idx[0] <= last[0]; idx[0]++) {
+
+          const auto it = buckets.find(GetKey(idx));
+          if (it == buckets.end()) continue;
+
+          for (auto iPoint : it->second) func(iPoint);
+        }
+      }
+    }
+  }
+
+  /*!
+   * \brief Call "func(iPoint, dist)" for the points closer than the radius to "x".
+   */
+  template<class F>
+  void ForEachPoint(const passivedouble* x, F func) const {
+
+    long cell[3] = {0, 0, 0};
+    GetCell(x, cell);
+
+    ForEachPointNear(cell, 1, [&](unsigned long iPoint) {
+      const passivedouble dist = Distance(x, iPoint);
+      if (dist < radius) func(iPoint, dist);
+    });
+  }
+
+  /*!
+   * \brief Distance between "x" and a point.
+   */
+  passivedouble Distance(const passivedouble* x, unsigned long iPoint) const {
+    passivedouble dist = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      dist += pow(x[iDim]-coord[iPoint*nDim+iDim], 2);
+    return sqrt(dist);
+  }
+
+private:
+  unsigned long GetKey(const long* cell) const {
+    return cell[0] + nBucket[0]*(cell[1] + nBucket[1]*cell[2]);
+  }
+};
+
+/*!
+ * \brief In place Cholesky factorization (lower triangle) of a dense row-major SPD matrix.
+ * \return False if the matrix is not positive definite.
+ */
+bool CholeskyFactorize(unsigned long n, vector<passivedouble>& A) {
+  for (unsigned long j = 0; j < n; j++) {
+    passivedouble* Aj = &A[j*n];
+    for (unsigned long k = 0; k < j; k++) Aj[j] -= Aj[k]*Aj[k];
+    if (Aj[j] <= 0.0) return false;
+    Aj[j] = sqrt(Aj[j]);
+
+    for (unsigned long i = j+1; i < n; i++) {
+      passivedouble* Ai = &A[i*n];
+      passivedouble sum = Ai[j];
+      for (unsigned long k = 0; k < j; k++) sum -= Ai[k]*Aj[k];
+      Ai[j] = sum / Aj[j];
+    }
+  }
+  return true;
+}
+
+/*!
+ * \brief Solve L L^T x = b in place, with L from CholeskyFactorize.
+ */
+void CholeskySolve(unsigned long n, const vector<passivedouble>& L, passivedouble* x) {
+  for (unsigned long i = 0; i < n; i++) {
+    const passivedouble* Li = &L[i*n];
+    for (unsigned long k = 0; k < i; k++) x[i] -= Li[k]*x[k];
+    x[i] /= Li[i];
+  }
+  for (unsigned long i = n; i-- > 0; ) {
+    x[i] /= L[i*n+i];
+    for (unsigned long k = 0; k < i; k++) x[k] -= L[i*n+k]*x[i];
+  }
+}
+
+}
+
 CRadialBasisFunction::CRadialBasisFunction(void):  CInterpolator() { }
 
 CRadialBasisFunction::CRadialBasisFunction(CGeometry ****geometry_container, CConfig **config,  unsigned int iZone, unsigned int jZone) :  CInterpolator(geometry_container, config, iZone, jZone) {
@@ -2736,6 +2954,11 @@ CRadialBasisFunction::~CRadialBasisFunction() {}
 
 void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 
+  if (config[donorZone]->GetRadialBasisFunctionSparse()) {
+    Set_TransferCoeff_Sparse(config);
+    return;
+  }
+
   int iProcessor, nProcessor = size;
   int nPolynomial = 0;
   int mark_donor, mark_target, target_check, donor_check;
@@ -3182,6 +3405,257 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 #endif
 }
 
+void CRadialBasisFunction::Get_SparseInterpolationWeights(unsigned short nDim, unsigned short type, passivedouble radius,
+                                                          unsigned short nLayer, const vector<passivedouble>& centerCoord,
+                                                          const vector<passivedouble>& targetCoord,
+                                                          vector<vector<pair<unsigned long, passivedouble> > >& weights) {
+
+  /*--- The interpolation weights of a target point are H_t = M^-1 phi_t, where phi_t are the values of the
+   basis functions of the centers at the target, and M the (symmetric) interpolation matrix of the centers.
+   M^-1 is dense but its entries decay away from the diagonal, so H_t is computed with the centers near the
+   target only. The targets are grouped by the buckets (of the size of the radius) that contain them, and
+   for each group the matrix of the centers up to 1+nLayer buckets away is factorized (the first layer
+   contains the support of the targets). The cost is linear in the number of targets. ---*/
+
+  const unsigned long nCenter = centerCoord.size() / nDim;
+  const unsigned long nTarget = targetCoord.size() / nDim;
+
+  /*--- Weights smaller than this (relative to the largest weight of the target) are discarded. ---*/
+  const passivedouble pruneTol = 1e-8;
+
+  weights.clear();
+  weights.resize(nTarget);
+
+  if (nCenter == 0) return;
+
+  const CPointBuckets buckets(nDim, nCenter, centerCoord.data(), radius);
+
+  auto basisValue = [&](passivedouble dist) {
+    return SU2_TYPE::GetValue(Get_RadialBasisValue(type, radius, dist));
+  };
+
+  map<array<long,3>, vector<unsigned long> > groups;
+
+  for (unsigned long iTarget = 0; iTarget < nTarget; iTarget++) {
+    array<long,3> cell = {{0, 0, 0}};
+    buckets.GetCell(&targetCoord[iTarget*nDim], cell.data());
+    groups[cell].push_back(iTarget);
+  }
+
+  vector<unsigned long> patch;
+  vector<passivedouble> matrix, phi;
+
+  for (const auto& group : groups) {
+
+    patch.clear();
+    buckets.ForEachPointNear(group.first.data(), 1+nLayer, [&](unsigned long iCenter) { patch.push_back(iCenter); });
+
+    const unsigned long nPatch = patch.size();
+    if (nPatch == 0) continue;
+
+    /*--- Local interpolation matrix. ---*/
+
+    matrix.assign(nPatch*nPatch, 0.0);
+    for (unsigned long i = 0; i < nPatch; i++) {
+      for (unsigned long j = 0; j <= i; j++) {
+        const passivedouble dist = buckets.Distance(&centerCoord[patch[i]*nDim], patch[j]);
+        if (dist < radius) matrix[i*nPatch+j] = matrix[j*nPatch+i] = basisValue(dist);
+      }
+    }
+
+    if (!CholeskyFactorize(nPatch, matrix)) {
+      SU2_MPI::Error("The RBF interpolation matrix is not positive definite, the interface may have duplicate points.",
+                     CURRENT_FUNCTION);
+    }
+
+    /*--- Weights of the targets of the group. ---*/
+
+    phi.resize(nPatch);
+
+    for (auto iTarget : group.second) {
+
+      const passivedouble* coord = &targetCoord[iTarget*nDim];
+      bool support = false;
+      for (unsigned long i = 0; i < nPatch; i++) {
+        const passivedouble dist = buckets.Distance(coord, patch[i]);
+        phi[i] = (dist < radius)? basisValue(dist) : 0.0;
+        support |= (dist < radius);
+      }
+      if (!support) continue;
+
+      CholeskySolve(nPatch, matrix, phi.data());
+
+      passivedouble maxWeight = 0.0;
+      for (unsigned long i = 0; i < nPatch; i++) maxWeight = max(maxWeight, fabs(phi[i]));
+
+      for (unsigned long i = 0; i < nPatch; i++)
+        if (fabs(phi[i]) > pruneTol*maxWeight) weights[iTarget].emplace_back(patch[i], phi[i]);
+    }
+  }
+}
+
+void CRadialBasisFunction::Set_TransferCoeff_Sparse(CConfig **config) {
+
+  const unsigned short nDim = donor_geometry->GetnDim();
+  const unsigned short nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
+
+  const auto kindRBF = config[donorZone]->GetKindRadialBasisFunction();
+  const passivedouble radius = SU2_TYPE::GetValue(config[donorZone]->GetRadialBasisFunctionParameter());
+  const passivedouble reductionTol = SU2_TYPE::GetValue(config[donorZone]->GetRadialBasisFunctionReductionTol());
+  const unsigned short nLayer = config[donorZone]->GetRadialBasisFunctionSparseLayers();
+
+  Buffer_Receive_nVertex_Donor = new unsigned long [size];
+
+  for (unsigned short iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
+
+    /*--- On the donor side: find the tag of the boundary sharing the interface ---*/
+    const int markDonor = Find_InterfaceMarker(config[donorZone], iMarkerInt);
+
+    /*--- On the target side: find the tag of the boundary sharing the interface ---*/
+    const int markTarget = Find_InterfaceMarker(config[targetZone], iMarkerInt);
+
+    /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
+    if( !CheckInterfaceBoundary(markDonor, markTarget) )
+      continue;
+
+    const unsigned long nVertexDonor = (markDonor != -1)? donor_geometry->GetnVertex(markDonor) : 0;
+    const unsigned long nVertexTarget = (markTarget != -1)? target_geometry->GetnVertex(markTarget) : 0;
+
+    /*--- Collect the coordinates and global indices of the donor points of all ranks. ---*/
+
+    Buffer_Send_nVertex_Donor = new unsigned long [1];
+
+    Determine_ArraySize(false, markDonor, markTarget, nVertexDonor, nDim);
+
+    Buffer_Send_Coord          = new su2double [ MaxLocalVertex_Donor * nDim ];
+    Buffer_Send_GlobalPoint    = new long [ MaxLocalVertex_Donor ];
+    Buffer_Receive_Coord       = new su2double [ size * MaxLocalVertex_Donor * nDim ];
+    Buffer_Receive_GlobalPoint = new long [ size * MaxLocalVertex_Donor ];
+
+    Collect_VertexInfo(false, markDonor, markTarget, nVertexDonor, nDim);
+
+    vector<passivedouble> donorCoord;
+    vector<long> donorPoint;
+    vector<int> donorRank;
+
+    for (int iRank = 0; iRank < size; iRank++) {
+      for (unsigned long iVertex = 0; iVertex < Buffer_Receive_nVertex_Donor[iRank]; iVertex++) {
+        const auto iBuffer = iRank*MaxLocalVertex_Donor + iVertex;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          donorCoord.push_back(SU2_TYPE::GetValue(Buffer_Receive_Coord[iBuffer*nDim+iDim]));
+        donorPoint.push_back(Buffer_Receive_GlobalPoint[iBuffer]);
+        donorRank.push_back(iRank);
+      }
+    }
+    const unsigned long nDonor = donorPoint.size();
+
+    delete[] Buffer_Send_Coord;
+    delete[] Buffer_Send_GlobalPoint;
+    delete[] Buffer_Receive_Coord;
+    delete[] Buffer_Receive_GlobalPoint;
+    delete[] Buffer_Send_nVertex_Donor;
+
+    /*--- Centers of the basis functions, all the donors or a subset selected by a greedy algorithm,
+     the next center is the donor farthest from the current ones, until all donors are within
+     RADIAL_BASIS_FUNCTION_REDUCTION_TOL * RADIAL_BASIS_FUNCTION_PARAMETER of a center. ---*/
+
+    vector<unsigned long> centers;
+
+    if ((reductionTol > 0.0) && (nDonor > 0)) {
+      const passivedouble maxDist2 = pow(reductionTol*radius, 2);
+      vector<passivedouble> dist2(nDonor, numeric_limits<passivedouble>::max());
+      unsigned long next = 0;
+
+      while (dist2[next] > maxDist2) {
+        centers.push_back(next);
+        const passivedouble* center = &donorCoord[next*nDim];
+        passivedouble farthest = 0.0;
+
+        for (unsigned long iDonor = 0; iDonor < nDonor; iDonor++) {
+          passivedouble d2 = 0.0;
+          for (unsigned short iDim = 0; iDim < nDim; iDim++)
+            d2 += pow(donorCoord[iDonor*nDim+iDim]-center[iDim], 2);
+          dist2[iDonor] = min(dist2[iDonor], d2);
+          if (dist2[iDonor] > farthest) { farthest = dist2[iDonor]; next = iDonor; }
+        }
+      }
+    }
+    else {
+      centers.resize(nDonor);
+      iota(centers.begin(), centers.end(), 0ul);
+    }
+
+    const unsigned long nCenter = centers.size();
+
+    if (rank == MASTER_NODE && reductionTol > 0.0)
+      cout << "Sparse RBF interpolation, " << nCenter << " of " << nDonor << " donor points are centers." << endl;
+
+    vector<passivedouble> centerCoord(nCenter*nDim);
+    for (unsigned long iCenter = 0; iCenter < nCenter; iCenter++)
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        centerCoord[iCenter*nDim+iDim] = donorCoord[centers[iCenter]*nDim+iDim];
+
+    /*--- Each rank computes the weights of its own target points. ---*/
+
+    vector<unsigned long> targetVertex;
+    vector<passivedouble> targetCoord;
+
+    for (unsigned long iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+
+      targetVertex.push_back(iVertex);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        targetCoord.push_back(SU2_TYPE::GetValue(target_geometry->node[iPoint]->GetCoord(iDim)));
+    }
+    const unsigned long nTarget = targetVertex.size();
+
+    vector<vector<pair<unsigned long, passivedouble> > > weights;
+
+    Get_SparseInterpolationWeights(nDim, kindRBF, radius, nLayer, centerCoord, targetCoord, weights);
+
+    /*--- Targets outside the support of all centers take the value of the nearest center. ---*/
+
+    CADTPointsOnlyClass* centerTree = nullptr;
+
+    for (unsigned long iTarget = 0; iTarget < nTarget; iTarget++) {
+      if (!weights[iTarget].empty() || (nCenter == 0)) continue;
+
+      if (centerTree == nullptr) {
+        vector<su2double> coord(centerCoord.begin(), centerCoord.end());
+        vector<unsigned long> index(nCenter);
+        iota(index.begin(), index.end(), 0ul);
+        centerTree = new CADTPointsOnlyClass(nDim, nCenter, coord.data(), index.data(), false);
+      }
+      const auto iPoint = target_geometry->vertex[markTarget][targetVertex[iTarget]]->GetNode();
+      su2double dist;
+      unsigned long iCenter;
+      int treeRank;
+      centerTree->DetermineNearestNode(target_geometry->node[iPoint]->GetCoord(), dist, iCenter, treeRank);
+      weights[iTarget].emplace_back(iCenter, 1.0);
+    }
+    delete centerTree;
+
+    /*--- Store the donors and coefficients. ---*/
+
+    for (unsigned long iTarget = 0; iTarget < nTarget; iTarget++) {
+      auto vertex = target_geometry->vertex[markTarget][targetVertex[iTarget]];
+
+      vertex->SetnDonorPoints(weights[iTarget].size());
+      vertex->Allocate_DonorInfo();
+
+      for (unsigned long iDonor = 0; iDonor < weights[iTarget].size(); iDonor++) {
+        const auto donor = centers[weights[iTarget][iDonor].first];
+        vertex->SetInterpDonorPoint(iDonor, donorPoint[donor]);
+        vertex->SetInterpDonorProcessor(iDonor, donorRank[donor]);
+        vertex->SetDonorCoeff(iDonor, weights[iTarget][iDonor].second);
+      }
+    }
+  }
+
+  delete[] Buffer_Receive_nVertex_Donor;
+}
+
 void CRadialBasisFunction::Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P)
 {
   /*--- This routine keeps the AD information in P but the calculations are done in passivedouble as their purpose
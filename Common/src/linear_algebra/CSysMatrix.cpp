@@ -33,6 +33,20 @@
 #include "../../include/toolboxes/allocation_toolbox.hpp"
 
 #include <cmath>
+#include <type_traits>
+
+/*--- Call the member function template FUNCTION with the block size of the specialized kernels of the matrix,
+ *    this is done once per call of the public methods, the hot loops are then fully resolved at compilation. ---*/
+#define DISPATCH_BLOCK_SIZE(FUNCTION, ...) switch (kernel_size) {  \
+  case 1: FUNCTION<1>(__VA_ARGS__); break;                          \
+  case 2: FUNCTION<2>(__VA_ARGS__); break;                          \
+  case 3: FUNCTION<3>(__VA_ARGS__); break;                          \
+  case 4: FUNCTION<4>(__VA_ARGS__); break;                          \
+  case 5: FUNCTION<5>(__VA_ARGS__); break;                          \
+  case 6: FUNCTION<6>(__VA_ARGS__); break;                          \
+  case 7: FUNCTION<7>(__VA_ARGS__); break;                          \
+  default: FUNCTION<0>(__VA_ARGS__); break;                         \
+}
 
 template<class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix(void) {
@@ -40,12 +54,13 @@ CSysMatrix<ScalarType>::CSysMatrix(void) {
   size = SU2_MPI::GetSize();
   rank = SU2_MPI::GetRank();
 
-  nPoint = nPointDomain = nVar = nEqn = 0;
+  nPoint = nPointDomain = nVar = nEqn = kernel_size = 0;
   nnz = nnz_ilu = 0;
   ilu_fill_in = 0;
   nLinelet = 0;
 
   omp_partitions    = nullptr;
+  omp_level_sched   = false;
 
   matrix            = nullptr;
   row_ptr           = nullptr;
@@ -113,7 +128,16 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   unsigned short adj_prec = config->GetKind_DiscAdj_Linear_Prec();
   bool adjoint = config->GetDiscrete_Adjoint();
 
-  bool ilu_needed = (sol_prec==ILU) || (def_prec==ILU) || (adjoint && (adj_prec==ILU));
+  /*--- In mixed precision builds the preconditioners of CSysSolve are built from a lower precision copy of
+   *    the matrix, the higher precision matrix does not need storage for them. The mesh deformation
+   *    (CVolumetricMovement) builds its preconditioners directly, hence the exception for def_prec. ---*/
+#ifdef USE_MIXED_PRECISION
+  const bool prec_storage = std::is_same<ScalarType, su2mixedfloat>::value;
+#else
+  const bool prec_storage = true;
+#endif
+
+  bool ilu_needed = (prec_storage && ((sol_prec==ILU) || (adjoint && (adj_prec==ILU)))) || (def_prec==ILU);
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -121,6 +145,13 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   nPoint = npoint;
   nPointDomain = npointdomain;
 
+  /*--- Square blocks of common sizes use the kernels specialized at compilation,
+   *    with MKL its JIT kernels are used instead (see CSysMatrix.inl). ---*/
+#ifndef USE_MKL
+  static_assert(MAXNVAR == 8, "Update DISPATCH_BLOCK_SIZE (CSysMatrix.cpp) when changing MAXNVAR.");
+  if ((nVar == nEqn) && (nVar < MAXNVAR)) kernel_size = nVar;
+#endif
+
   /*--- Get sparse structure pointers from geometry,
    *    the data is managed by CGeometry to allow re-use. ---*/
 
@@ -131,8 +162,14 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   dia_ptr = csr.diagPtr();
   nnz = csr.getNumNonZeros();
 
-  if (type == ConnectivityType::FiniteVolume)
+  if (type == ConnectivityType::FiniteVolume) {
     edge_ptr.ptr = geometry->GetEdgeToSparsePatternMap().data();
+  }
+  else {
+    const auto& elemMap = geometry->GetElemToSparsePatternMap();
+    elem_ptr.outer = elemMap.outerPtr();
+    elem_ptr.inner = elemMap.innerIdx();
+  }
 
   /*--- Get ILU sparse pattern, if fill is 0 no new data is allocated. --*/
 
@@ -146,6 +183,15 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+#ifdef PROFILE
+    /*--- Report the fill of the factorization, it depends on the ordering of the points. ---*/
+    unsigned long nnzLocal[2] = {nnz, nnz_ilu}, nnzGlobal[2] = {0, 0};
+    SU2_MPI::Allreduce(nnzLocal, nnzGlobal, 2, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+    if (SU2_MPI::GetRank() == MASTER_NODE)
+      cout << "ILU(" << ilu_fill_in << ") fill: " << nnzGlobal[1] << " non-zero blocks, "
+           << double(nnzGlobal[1])/nnzGlobal[0] << " times the matrix." << endl;
+#endif
   }
 
   /*--- Allocate data. ---*/
@@ -161,8 +207,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     ALLOC_AND_INIT(ILU_matrix, nnz_ilu*nVar*nEqn)
   }
 
-  if (ilu_needed || (sol_prec==JACOBI) || (sol_prec==LINELET) ||
-      (adjoint && (adj_prec==JACOBI)) || (def_prec==JACOBI))
+  if (ilu_needed || (def_prec==JACOBI) || (prec_storage && ((sol_prec==JACOBI) || (sol_prec==LINELET) ||
+      (adjoint && (adj_prec==JACOBI)))))
   {
     ALLOC_AND_INIT(invM, nPointDomain*nVar*nEqn);
   }
@@ -189,6 +235,23 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     omp_partitions[part] = part * pts_per_part;
   omp_partitions[omp_num_parts] = nPointDomain;
 
+  /*--- With level scheduling the threads only work on rows that do not depend on each other, thus
+   *    LU_SGS and ILU are exactly as with one thread (regardless of the number of threads) but a
+   *    synchronization is needed after each level. The levels depend only on the sparse patterns. ---*/
+
+  omp_level_sched = config->GetLinear_Solver_Prec_Level_Scheduling() && (num_threads > 1);
+
+  if (omp_level_sched) {
+    lower_levels = levelSchedulePattern(csr, nPointDomain, true);
+    upper_levels = levelSchedulePattern(csr, nPointDomain, false);
+
+    if (ilu_needed) {
+      const auto& csr_ilu = geometry->GetSparsePattern(type, ilu_fill_in);
+      ilu_lower_levels = levelSchedulePattern(csr_ilu, nPointDomain, true);
+      ilu_upper_levels = levelSchedulePattern(csr_ilu, nPointDomain, false);
+    }
+  }
+
   /*--- For coarse grid levels setup a structure that allows doing a column sum efficiently,
    * essentially the transpose of the col_ind, this allows populating the matrix by setting
    * the off-diagonal entries and then setting the diagonal ones as the sum of column
@@ -207,6 +270,27 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     }
   }
 
+  /*--- Split the rows into those sent to other ranks (their product must be
+   *    computed before the halo exchange) and the interior rows (computed
+   *    while the exchange is in flight), see MatrixVectorProduct. ---*/
+
+  comm_rows.clear();
+  interior_rows.clear();
+
+  if (geometry->nP2PSend > 0) {
+    vector<bool> isCommRow(nPointDomain, false);
+
+    for (int iSend = 0; iSend < geometry->nPoint_P2PSend[geometry->nP2PSend]; ++iSend) {
+      const auto iPoint = geometry->Local_Point_P2PSend[iSend];
+      if (iPoint < nPointDomain) isCommRow[iPoint] = true;
+    }
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      if (isCommRow[iPoint]) comm_rows.push_back(iPoint);
+      else interior_rows.push_back(iPoint);
+    }
+  }
+
   /*--- Generate MKL Kernels ---*/
 
 #ifdef USE_MKL
@@ -235,8 +319,10 @@ void CSysMatrix<ScalarType>::InitiateComms(const CSysVector<OtherType> & x,
                                            CConfig *config,
                                            unsigned short commType) const {
 
-  /*--- Local variables ---*/
+  /*--- Local variables, the size of the blocks is taken from the vector, this allows
+   *    communicating vectors when the matrix is not allocated (matrix-free products). ---*/
 
+  const unsigned long nVar = x.GetNVar();
   unsigned short iVar;
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE        = 0;
@@ -385,8 +471,9 @@ void CSysMatrix<ScalarType>::CompleteComms(CSysVector<OtherType> & x,
                                            CConfig *config,
                                            unsigned short commType) const {
 
-  /*--- Local variables ---*/
+  /*--- Local variables (see InitiateComms). ---*/
 
+  const unsigned long nVar = x.GetNVar();
   unsigned short iVar;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
@@ -529,83 +616,46 @@ void CSysMatrix<ScalarType>::Gauss_Elimination(ScalarType* matrix, ScalarType* v
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv);
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, 1, matrix, nVar, ipiv, vec, 1 );
 #else
-#define A(I,J) matrix[(I)*nVar+(J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++) {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
-      for (auto kVar = jVar; kVar < nVar; kVar++)
-        A(iVar,kVar) -= weight * A(jVar,kVar);
-      vec[iVar] -= weight * vec[jVar];
-    }
-  }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--; // unsigned type
-    for (auto jVar = iVar+1; jVar < nVar; jVar++)
-      vec[iVar] -= A(iVar,jVar) * vec[jVar];
-    vec[iVar] /= A(iVar,iVar);
+  switch (kernel_size) {
+    case 1: gauss_elim_impl<ScalarType,1>(1, matrix, vec); break;
+    case 2: gauss_elim_impl<ScalarType,2>(2, matrix, vec); break;
+    case 3: gauss_elim_impl<ScalarType,3>(3, matrix, vec); break;
+    case 4: gauss_elim_impl<ScalarType,4>(4, matrix, vec); break;
+    case 5: gauss_elim_impl<ScalarType,5>(5, matrix, vec); break;
+    case 6: gauss_elim_impl<ScalarType,6>(6, matrix, vec); break;
+    case 7: gauss_elim_impl<ScalarType,7>(7, matrix, vec); break;
+    default: gauss_elim_impl<ScalarType>(nVar, matrix, vec); break;
   }
-#undef A
 #endif
 }
 
 template<class ScalarType>
 void CSysMatrix<ScalarType>::MatrixInverse(ScalarType *matrix, ScalarType *inverse) const {
 
-  /*--- This is a generalization of Gaussian elimination for multiple rhs' (the basis vectors).
-   We could call "Gauss_Elimination" multiple times or fully generalize it for multiple rhs,
-   the performance of both routines would suffer in both cases without the use of exotic templating.
-   And so it feels reasonable to have some duplication here. ---*/
-
   assert((matrix != inverse) && "Output cannot be the same as the input.");
 
-#define M(I,J) inverse[(I)*nVar+(J)]
-
+#ifdef USE_MKL_LAPACK
   /*--- Initialize the inverse with the identity. ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     for (auto jVar = 0ul; jVar < nVar; jVar++)
-      M(iVar,jVar) = ScalarType(iVar==jVar);
+      inverse[iVar*nVar+jVar] = ScalarType(iVar==jVar);
 
-  /*--- Inversion ---*/
-#ifdef USE_MKL_LAPACK
   // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
   lapack_int ipiv[MAXNVAR];
   LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, matrix, nVar, ipiv );
   LAPACKE_dgetrs( LAPACK_ROW_MAJOR, 'N', nVar, nVar, matrix, nVar, ipiv, inverse, nVar );
 #else
-#define A(I,J) matrix[(I)*nVar+(J)]
-
-  /*--- Transform system in Upper Matrix ---*/
-  for (auto iVar = 1ul; iVar < nVar; iVar++) {
-    for (auto jVar = 0ul; jVar < iVar; jVar++)
-    {
-      ScalarType weight = A(iVar,jVar) / A(jVar,jVar);
-
-      for (auto kVar = jVar; kVar < nVar; kVar++)
-        A(iVar,kVar) -= weight * A(jVar,kVar);
-
-      /*--- at this stage M is lower triangular so not all cols need updating ---*/
-      for (auto kVar = 0ul; kVar <= jVar; kVar++)
-        M(iVar,kVar) -= weight * M(jVar,kVar);
-    }
+  switch (kernel_size) {
+    case 1: matrix_inverse_impl<ScalarType,1>(1, matrix, inverse); break;
+    case 2: matrix_inverse_impl<ScalarType,2>(2, matrix, inverse); break;
+    case 3: matrix_inverse_impl<ScalarType,3>(3, matrix, inverse); break;
+    case 4: matrix_inverse_impl<ScalarType,4>(4, matrix, inverse); break;
+    case 5: matrix_inverse_impl<ScalarType,5>(5, matrix, inverse); break;
+    case 6: matrix_inverse_impl<ScalarType,6>(6, matrix, inverse); break;
+    case 7: matrix_inverse_impl<ScalarType,7>(7, matrix, inverse); break;
+    default: matrix_inverse_impl<ScalarType>(nVar, matrix, inverse); break;
   }
-
-  /*--- Backwards substitution ---*/
-  for (auto iVar = nVar; iVar > 0ul;) {
-    iVar--; // unsigned type
-    for (auto jVar = iVar+1; jVar < nVar; jVar++)
-      for (auto kVar = 0ul; kVar < nVar; kVar++)
-        M(iVar,kVar) -= A(iVar,jVar) * M(jVar,kVar);
-
-    for (auto kVar = 0ul; kVar < nVar; kVar++)
-      M(iVar,kVar) /= A(iVar,iVar);
-  }
-#undef A
 #endif
-#undef M
 }
 
 template<class ScalarType>
@@ -639,7 +689,8 @@ void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType> & vec,
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                  CGeometry *geometry, CConfig *config) const {
 
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
@@ -660,30 +711,65 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> &
 
   SU2_OMP_BARRIER
 
+  /*--- Profiling (only when compiled with -DPROFILE), timed by the master thread. ---*/
+  double tick = 0.0;
+  SU2_OMP_MASTER
+  config->Tick(&tick);
+
+  if (comm_rows.empty()) {
+
+    DISPATCH_BLOCK_SIZE(MatrixVectorProductImpl, vec, prod, DummyGridColor<>(nPointDomain))
+
+    /*--- MPI Parallelization by master thread. ---*/
+
+    SU2_OMP_MASTER
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  else {
+    /*--- Rows sent to other ranks first, then the master thread posts the
+     *    halo exchange and joins the other threads on the interior rows
+     *    (which do not touch the send buffer nor the halo entries). ---*/
+
+    const GridColor<> commRows(comm_rows.data(), comm_rows.size());
+    const GridColor<> interiorRows(interior_rows.data(), interior_rows.size());
+
+    DISPATCH_BLOCK_SIZE(MatrixVectorProductImpl, vec, prod, commRows)
+
+    SU2_OMP_MASTER
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+
+    DISPATCH_BLOCK_SIZE(MatrixVectorProductImpl, vec, prod, interiorRows)
+  }
+
+  SU2_OMP_MASTER
+  {
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+    config->Tock(tick, "MatrixVectorProduct", 2);
+  }
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+template<size_t N, class OtherType, class RowList>
+void CSysMatrix<ScalarType>::MatrixVectorProductImpl(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
+                                                     const RowList& rows) const {
   SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (auto row_i = 0ul; row_i < nPointDomain; row_i++) {
+  for (auto k = 0ul; k < rows.size; k++) {
+    auto row_i = rows.indices[k];
     auto prod_begin = row_i*nVar; // offset to beginning of block row_i
     for(auto iVar = 0ul; iVar < nVar; iVar++)
       prod[prod_begin+iVar] = 0.0;
     for (auto index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
       auto vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
       auto mat_begin = index*nVar*nVar; // offset to beginning of matrix block[row_i][col_ind[indx]]
-      MatrixVectorProductAdd(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
+      BlockVectorProductAdd<N>(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin]);
     }
   }
-
-  /*--- MPI Parallelization by master thread. ---*/
-
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
-  }
-  SU2_OMP_BARRIER
 }
 
 template<class ScalarType>
-void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+template<class OtherType>
+void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<OtherType> & vec, CSysVector<OtherType> & prod,
                                                            CGeometry *geometry, CConfig *config) const {
 
   unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
@@ -701,7 +787,7 @@ void CSysMatrix<ScalarType>::MatrixVectorProductTransposed(const CSysVector<Scal
 #endif
 
   /// TODO: The transpose product requires a different thread-parallel strategy.
-  prod = ScalarType(0.0); // set all entries of prod to zero
+  prod = OtherType(0.0); // set all entries of prod to zero
   for (row_i = 0; row_i < nPointDomain; row_i++) {
     vec_begin = row_i*nVar; // offset to beginning of block col_ind[index]
     for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
@@ -722,9 +808,17 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner(bool transpose) {
 
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
+  DISPATCH_BLOCK_SIZE(BuildJacobiPreconditionerImpl, transpose)
+
+}
+
+template<class ScalarType>
+template<size_t N>
+void CSysMatrix<ScalarType>::BuildJacobiPreconditionerImpl(bool transpose) {
+
   SU2_OMP(for schedule(dynamic,omp_heavy_size) nowait)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    InverseDiagonalBlock(iPoint, &(invM[iPoint*nVar*nVar]), transpose);
+    InverseDiagonalBlock<N>(iPoint, &(invM[iPoint*nVar*nVar]), transpose);
 
 }
 
@@ -734,9 +828,7 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
-  SU2_OMP_FOR_DYN(omp_heavy_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
-    MatrixVectorProduct(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+  DISPATCH_BLOCK_SIZE(ComputeJacobiPreconditionerImpl, vec, prod)
 
   /*--- MPI Parallelization ---*/
   SU2_OMP_MASTER
@@ -747,6 +839,15 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
   SU2_OMP_BARRIER
 }
 
+template<class ScalarType>
+template<size_t N>
+void CSysMatrix<ScalarType>::ComputeJacobiPreconditionerImpl(const CSysVector<ScalarType> & vec,
+                                                             CSysVector<ScalarType> & prod) const {
+  SU2_OMP_FOR_DYN(omp_heavy_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
+    BlockVectorProduct<N>(&(invM[iPoint*nVar*nVar]), &vec[iPoint*nVar], &prod[iPoint*nVar]);
+}
+
 template<class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
@@ -784,76 +885,45 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner(bool transposed) {
 
   /*--- Transform system in Upper Matrix ---*/
 
-  /*--- OpenMP Parallelization, a loop construct is used to ensure
-   *    the preconditioner is computed correctly even if called
-   *    outside of a parallel section. ---*/
-
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
-
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
-     *    what the MPI-only implementation does. ---*/
-
-    ScalarType weight[MAXNVAR*MAXNVAR], aux_block[MAXNVAR*MAXNVAR];
-
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
-
-      InverseDiagonalBlock_ILUMatrix(iPoint-1, &invM[(iPoint-1)*nVar*nVar]);
-
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
-
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
-
-        auto jPoint = col_ind_ilu[index];
-
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
-
-        if (jPoint < begin) continue;
-
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
-
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint*nVar*nVar], weight);
-
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
-
-        for (auto index_ = dia_ptr_ilu[jPoint]+1; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+  DISPATCH_BLOCK_SIZE(FactorizeILUMatrix)
 
-          /*--- Get the column index (kPoint > jPoint). ---*/
-
-          auto kPoint = col_ind_ilu[index_];
+}
 
-          if (kPoint >= end) break;
+template<class ScalarType>
+template<size_t N>
+void CSysMatrix<ScalarType>::FactorizeILUMatrix() {
 
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+  /*--- OpenMP Parallelization, loop constructs are used to ensure
+   *    the preconditioner is computed correctly even if called
+   *    outside of a parallel section. ---*/
 
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+  if (omp_level_sched) {
+    /*--- The rows of each level only depend on rows of previous levels. ---*/
+    for (auto iLevel = 0ul; iLevel < ilu_lower_levels.getOuterSize(); ++iLevel) {
+      const auto nRow = ilu_lower_levels.getNumNonZeros(iLevel);
+      const auto rows = ilu_lower_levels.innerIdx(iLevel);
 
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_*nVar*nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nRow, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = 0ul; k < nRow; ++k)
+        FactorizeRow_ILUMatrix<N>(rows[k], 0, nPointDomain);
+    }
+  }
+  else {
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
+       *    what the MPI-only implementation does. ---*/
 
-        for (auto iVar = 0ul; iVar < nVar*nVar; ++iVar)
-          Block_ij[iVar] = weight[iVar];
-      }
-    }
-    InverseDiagonalBlock_ILUMatrix(end-1, &invM[(end-1)*nVar*nVar]);
+      for (auto iPoint = begin; iPoint < end; iPoint++)
+        FactorizeRow_ILUMatrix<N>(iPoint, begin, end);
 
-  } // end parallel
+    } // end parallel
+  }
 
 }
 
@@ -863,59 +933,71 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
+  DISPATCH_BLOCK_SIZE(ComputeILUPreconditionerImpl, vec, prod)
 
-    ScalarType aux_vec[MAXNVAR];
+  /*--- MPI Parallelization ---*/
 
-    /*--- Copy vector to then work on prod in place ---*/
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
 
-    for (auto iVar = begin*nVar; iVar < end*nVar; iVar++)
-      prod[iVar] = vec[iVar];
+template<class ScalarType>
+template<size_t N>
+void CSysMatrix<ScalarType>::ComputeILUPreconditionerImpl(const CSysVector<ScalarType> & vec,
+                                                          CSysVector<ScalarType> & prod) const {
+  if (omp_level_sched) {
 
     /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
-
-    for (auto iPoint = begin+1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], &prod[iPoint*nVar]);
-      }
-    }
+     were computed and stored during the ILU preprocessing, one level
+     of independent rows at a time. ---*/
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+    for (auto iLevel = 0ul; iLevel < ilu_lower_levels.getOuterSize(); ++iLevel) {
+      const auto nRow = ilu_lower_levels.getNumNonZeros(iLevel);
+      const auto rows = ilu_lower_levels.innerIdx(iLevel);
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--; // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++)
-        aux_vec[iVar] = prod[iPoint*nVar+iVar];
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nRow, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = 0ul; k < nRow; ++k)
+        ForwardRow_ILUMatrix<N>(vec, prod, rows[k], 0);
+    }
 
-      for (auto index = dia_ptr_ilu[iPoint]+1; index < row_ptr_ilu[iPoint+1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index*nVar*nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint*nVar], aux_vec);
-      }
+    /*--- Backwards substitution. ---*/
 
-      MatrixVectorProduct(&invM[iPoint*nVar*nVar], aux_vec, &prod[iPoint*nVar]);
+    for (auto iLevel = 0ul; iLevel < ilu_upper_levels.getOuterSize(); ++iLevel) {
+      const auto nRow = ilu_upper_levels.getNumNonZeros(iLevel);
+      const auto rows = ilu_upper_levels.innerIdx(iLevel);
+
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nRow, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = 0ul; k < nRow; ++k)
+        BackwardRow_ILUMatrix<N>(prod, rows[k], nPointDomain);
     }
-  } // end parallel
+  }
+  else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
 
-  /*--- MPI Parallelization ---*/
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
 
-  SU2_OMP_MASTER
-  {
-    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
-    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+      for (auto iPoint = begin; iPoint < end; iPoint++)
+        ForwardRow_ILUMatrix<N>(vec, prod, iPoint, begin);
+
+      /*--- Backwards substitution (starts at the last row) ---*/
+
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--; // unsigned type
+        BackwardRow_ILUMatrix<N>(prod, iPoint, end);
+      }
+    } // end parallel
   }
-  SU2_OMP_BARRIER
 }
 
 template<class ScalarType>
@@ -927,27 +1009,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread+1];
-
-    /*--- Each thread will work on the submatrix defined from row/col "begin"
-     *    to row/col "end-1", except the last thread that also considers halos.
-     *    This is NOT exactly equivalent to the MPI implementation on the same
-     *    number of domains, for that we would need to define "thread-halos". ---*/
-
-    ScalarType low_prod[MAXNVAR];
-
-    for (auto iPoint = begin; iPoint < end; ++iPoint) {
-      auto idx = iPoint*nVar;
-      LowerProduct(prod, iPoint, begin, low_prod);        // Compute L.x*
-      VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
-      Gauss_Elimination(iPoint, &prod[idx]);              // Solve D.x* = y
-    }
-  } // end parallel
+  DISPATCH_BLOCK_SIZE(LU_SGSForwardSweep, vec, prod)
 
   /*--- MPI Parallelization ---*/
   SU2_OMP_MASTER
@@ -959,27 +1021,7 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 
   /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
-  {
-    const auto begin = omp_partitions[thread];
-    const auto row_end = omp_partitions[thread+1];
-    /*--- On the last thread partition the upper
-     *    product should consider halo columns. ---*/
-    const auto col_end = (row_end==nPointDomain)? nPoint : row_end;
-
-    ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
-
-    for (auto iPoint = row_end; iPoint > begin;) {
-      iPoint--; // because of unsigned type
-      auto idx = iPoint*nVar;
-      DiagonalProduct(prod, iPoint, dia_prod);          // Compute D.x*
-      UpperProduct(prod, iPoint, col_end, up_prod);     // Compute U.x_(n+1)
-      VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, &prod[idx]);            // Solve D.x* = y
-    }
-  } // end parallel
+  DISPATCH_BLOCK_SIZE(LU_SGSBackwardSweep, prod)
 
   /*--- MPI Parallelization ---*/
   SU2_OMP_MASTER
@@ -990,6 +1032,104 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
   SU2_OMP_BARRIER
 }
 
+template<class ScalarType>
+template<size_t N>
+void CSysMatrix<ScalarType>::LU_SGSForwardSweep(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod) const {
+
+  /*--- (D+L).x* = b ---*/
+
+  if (omp_level_sched) {
+    /*--- OpenMP Parallelization, one level of independent rows at a time. ---*/
+    for (auto iLevel = 0ul; iLevel < lower_levels.getOuterSize(); ++iLevel) {
+      const auto nRow = lower_levels.getNumNonZeros(iLevel);
+      const auto rows = lower_levels.innerIdx(iLevel);
+
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nRow, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = 0ul; k < nRow; ++k) {
+        ScalarType low_prod[MAXNVAR];
+        auto iPoint = rows[k];
+        auto idx = iPoint*nVar;
+        LowerProduct<N>(prod, iPoint, 0, low_prod);         // Compute L.x*
+        VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
+        Gauss_Elimination<N>(iPoint, &prod[idx]);           // Solve D.x* = y
+      }
+    }
+  }
+  else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread+1];
+
+      /*--- Each thread will work on the submatrix defined from row/col "begin"
+       *    to row/col "end-1", except the last thread that also considers halos.
+       *    This is NOT exactly equivalent to the MPI implementation on the same
+       *    number of domains, for that we would need to define "thread-halos". ---*/
+
+      ScalarType low_prod[MAXNVAR];
+
+      for (auto iPoint = begin; iPoint < end; ++iPoint) {
+        auto idx = iPoint*nVar;
+        LowerProduct<N>(prod, iPoint, begin, low_prod);     // Compute L.x*
+        VectorSubtraction(&vec[idx], low_prod, &prod[idx]); // Compute y = b - L.x*
+        Gauss_Elimination<N>(iPoint, &prod[idx]);           // Solve D.x* = y
+      }
+    } // end parallel
+  }
+}
+
+template<class ScalarType>
+template<size_t N>
+void CSysMatrix<ScalarType>::LU_SGSBackwardSweep(CSysVector<ScalarType> & prod) const {
+
+  /*--- (D+U).x_(1) = D.x* ---*/
+
+  if (omp_level_sched) {
+    /*--- OpenMP Parallelization, one level of independent rows at a time, the
+     *    upper product considers halo columns (they are not part of the levels). ---*/
+    for (auto iLevel = 0ul; iLevel < upper_levels.getOuterSize(); ++iLevel) {
+      const auto nRow = upper_levels.getNumNonZeros(iLevel);
+      const auto rows = upper_levels.innerIdx(iLevel);
+
+      SU2_OMP_FOR_STAT(computeStaticChunkSize(nRow, omp_get_num_threads(), OMP_MAX_SIZE_H))
+      for (auto k = 0ul; k < nRow; ++k) {
+        ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+        auto iPoint = rows[k];
+        auto idx = iPoint*nVar;
+        DiagonalProduct<N>(prod, iPoint, dia_prod);       // Compute D.x*
+        UpperProduct<N>(prod, iPoint, nPoint, up_prod);   // Compute U.x_(n+1)
+        VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
+        Gauss_Elimination<N>(iPoint, &prod[idx]);         // Solve D.x* = y
+      }
+    }
+  }
+  else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for(unsigned long thread = 0; thread < omp_num_parts; ++thread)
+    {
+      const auto begin = omp_partitions[thread];
+      const auto row_end = omp_partitions[thread+1];
+      /*--- On the last thread partition the upper
+       *    product should consider halo columns. ---*/
+      const auto col_end = (row_end==nPointDomain)? nPoint : row_end;
+
+      ScalarType up_prod[MAXNVAR], dia_prod[MAXNVAR];
+
+      for (auto iPoint = row_end; iPoint > begin;) {
+        iPoint--; // because of unsigned type
+        auto idx = iPoint*nVar;
+        DiagonalProduct<N>(prod, iPoint, dia_prod);       // Compute D.x*
+        UpperProduct<N>(prod, iPoint, col_end, up_prod);  // Compute U.x_(n+1)
+        VectorSubtraction(dia_prod, up_prod, &prod[idx]); // Compute y = D.x*-U.x_(n+1)
+        Gauss_Elimination<N>(iPoint, &prod[idx]);         // Solve D.x* = y
+      }
+    } // end parallel
+  }
+}
+
 template<class ScalarType>
 unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geometry, CConfig *config) {
 
@@ -1395,6 +1535,38 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+template<class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(bool transposed) {
+
+  if (nVar != nEqn) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("The AMG preconditioner requires square blocks.", CURRENT_FUNCTION);
+  }
+
+  /*--- The setup is sequential, the hierarchy is local to each rank. ---*/
+  SU2_OMP_MASTER
+  amg.Build(nVar, nPointDomain, row_ptr, col_ind, dia_ptr, matrix, transposed);
+  SU2_OMP_BARRIER
+}
+
+template<class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
+                                                      CGeometry *geometry, CConfig *config) const {
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  amg.Apply(&vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+
+  SU2_OMP_MASTER
+  {
+    InitiateComms(prod, geometry, config, SOLUTION_MATRIX);
+    CompleteComms(prod, geometry, config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
+
 #ifdef CODI_REVERSE_TYPE
 template<>
 void CSysMatrix<su2double>::BuildPastixPreconditioner(CGeometry *geometry, CConfig *config,
@@ -1410,8 +1582,25 @@ void CSysMatrix<su2double>::ComputePastixPreconditioner(const CSysVector<su2doub
 }
 #endif
 
+#ifdef USE_MIXED_PRECISION
+template<>
+void CSysMatrix<su2mixedfloat>::BuildPastixPreconditioner(CGeometry *geometry, CConfig *config,
+                                                          unsigned short kind_fact, bool transposed) {
+  SU2_OMP_MASTER
+  SU2_MPI::Error("The PaStiX preconditioner is only available in CSysMatrix<passivedouble>", CURRENT_FUNCTION);
+}
+template<>
+void CSysMatrix<su2mixedfloat>::ComputePastixPreconditioner(const CSysVector<su2mixedfloat> & vec, CSysVector<su2mixedfloat> & prod,
+                                                            CGeometry *geometry, CConfig *config) const {
+  SU2_OMP_MASTER
+  SU2_MPI::Error("The PaStiX preconditioner is only available in CSysMatrix<passivedouble>", CURRENT_FUNCTION);
+}
+#endif
+
 /*--- Explicit instantiations ---*/
 template class CSysMatrix<su2double>;
+template void  CSysMatrix<su2double>::MatrixVectorProduct(const CSysVector<su2double>&, CSysVector<su2double>&, CGeometry*, CConfig*) const;
+template void  CSysMatrix<su2double>::MatrixVectorProductTransposed(const CSysVector<su2double>&, CSysVector<su2double>&, CGeometry*, CConfig*) const;
 template void  CSysMatrix<su2double>::InitiateComms(const CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
 template void  CSysMatrix<su2double>::CompleteComms(CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
 template void  CSysMatrix<su2double>::EnforceSolutionAtNode(unsigned long, const su2double*, CSysVector<su2double>&);
@@ -1419,6 +1608,8 @@ template void  CSysMatrix<su2double>::MatrixMatrixAddition(su2double, const CSys
 
 #ifdef CODI_REVERSE_TYPE
 template class CSysMatrix<passivedouble>;
+template void  CSysMatrix<passivedouble>::MatrixVectorProduct(const CSysVector<passivedouble>&, CSysVector<passivedouble>&, CGeometry*, CConfig*) const;
+template void  CSysMatrix<passivedouble>::MatrixVectorProductTransposed(const CSysVector<passivedouble>&, CSysVector<passivedouble>&, CGeometry*, CConfig*) const;
 template void  CSysMatrix<passivedouble>::InitiateComms(const CSysVector<passivedouble>&, CGeometry*, CConfig*, unsigned short) const;
 template void  CSysMatrix<passivedouble>::InitiateComms(const CSysVector<su2double>&, CGeometry*, CConfig*, unsigned short) const;
 template void  CSysMatrix<passivedouble>::CompleteComms(CSysVector<passivedouble>&, CGeometry*, CConfig*, unsigned short) const;
@@ -1428,3 +1619,10 @@ template void  CSysMatrix<passivedouble>::EnforceSolutionAtNode(unsigned long, c
 template void  CSysMatrix<passivedouble>::MatrixMatrixAddition(passivedouble, const CSysMatrix<passivedouble>&);
 template void  CSysMatrix<passivedouble>::MatrixMatrixAddition(su2double, const CSysMatrix<su2double>&);
 #endif
+
+#ifdef USE_MIXED_PRECISION
+template class CSysMatrix<su2mixedfloat>;
+template void  CSysMatrix<su2mixedfloat>::InitiateComms(const CSysVector<su2mixedfloat>&, CGeometry*, CConfig*, unsigned short) const;
+template void  CSysMatrix<su2mixedfloat>::CompleteComms(CSysVector<su2mixedfloat>&, CGeometry*, CConfig*, unsigned short) const;
+template void  CSysMatrix<su2mixedfloat>::MatrixMatrixAddition(passivedouble, const CSysMatrix<passivedouble>&);
+#endif
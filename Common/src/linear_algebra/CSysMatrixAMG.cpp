@@ -0,0 +1,665 @@
+/*!
+ * \file CSysMatrixAMG.cpp
+ * \brief Implementation of the smoothed aggregation algebraic multigrid.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CSysMatrixAMG.hpp"
+#include "../../include/mpi_structure.hpp"
+#include "../../include/omp_structure.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+/*--- Marker for "not set" indices. ---*/
+constexpr unsigned long NONE = numeric_limits<unsigned long>::max();
+}
+
+template<class ScalarType>
+inline void CSysMatrixAMG<ScalarType>::BlockMatVec(const ScalarType* a, const ScalarType* b, ScalarType* c) const {
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    c[iVar] = 0.0;
+    for (auto jVar = 0ul; jVar < nVar; ++jVar)
+      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
+  }
+}
+
+template<class ScalarType>
+inline void CSysMatrixAMG<ScalarType>::BlockMatVecAdd(const ScalarType* a, const ScalarType* b, ScalarType* c) const {
+  for (auto iVar = 0ul; iVar < nVar; ++iVar)
+    for (auto jVar = 0ul; jVar < nVar; ++jVar)
+      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
+}
+
+template<class ScalarType>
+inline void CSysMatrixAMG<ScalarType>::BlockMatVecSub(const ScalarType* a, const ScalarType* b, ScalarType* c) const {
+  for (auto iVar = 0ul; iVar < nVar; ++iVar)
+    for (auto jVar = 0ul; jVar < nVar; ++jVar)
+      c[iVar] -= a[iVar*nVar+jVar] * b[jVar];
+}
+
+template<class ScalarType>
+inline void CSysMatrixAMG<ScalarType>::BlockMatMatAdd(const ScalarType* a, const ScalarType* b, ScalarType* c) const {
+  for (auto iVar = 0ul; iVar < nVar; ++iVar)
+    for (auto kVar = 0ul; kVar < nVar; ++kVar)
+      for (auto jVar = 0ul; jVar < nVar; ++jVar)
+        c[iVar*nVar+jVar] += a[iVar*nVar+kVar] * b[kVar*nVar+jVar];
+}
+
+template<class ScalarType>
+inline ScalarType CSysMatrixAMG<ScalarType>::BlockNorm(const ScalarType* a) const {
+  ScalarType sum = 0.0;
+  for (auto k = 0ul; k < nVar*nVar; ++k) sum += a[k]*a[k];
+  return sqrt(sum);
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::InvertBlock(const ScalarType* a, ScalarType* inv) const {
+
+  ScalarType aug[MAXNVAR][2*MAXNVAR];
+
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+      aug[iVar][jVar] = a[iVar*nVar+jVar];
+      aug[iVar][nVar+jVar] = (iVar == jVar)? 1.0 : 0.0;
+    }
+  }
+
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    /*--- Partial pivoting. ---*/
+    auto pivot = iVar;
+    for (auto kVar = iVar+1; kVar < nVar; ++kVar)
+      if (fabs(aug[kVar][iVar]) > fabs(aug[pivot][iVar])) pivot = kVar;
+
+    if (pivot != iVar)
+      for (auto jVar = 0ul; jVar < 2*nVar; ++jVar) swap(aug[iVar][jVar], aug[pivot][jVar]);
+
+    if (aug[iVar][iVar] == 0.0)
+      SU2_MPI::Error("Singular diagonal block found while building the AMG hierarchy.", CURRENT_FUNCTION);
+
+    const ScalarType scale = 1.0 / aug[iVar][iVar];
+    for (auto jVar = 0ul; jVar < 2*nVar; ++jVar) aug[iVar][jVar] *= scale;
+
+    for (auto kVar = 0ul; kVar < nVar; ++kVar) {
+      if (kVar == iVar) continue;
+      const ScalarType factor = aug[kVar][iVar];
+      for (auto jVar = 0ul; jVar < 2*nVar; ++jVar) aug[kVar][jVar] -= factor * aug[iVar][jVar];
+    }
+  }
+
+  for (auto iVar = 0ul; iVar < nVar; ++iVar)
+    for (auto jVar = 0ul; jVar < nVar; ++jVar)
+      inv[iVar*nVar+jVar] = aug[iVar][nVar+jVar];
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Transpose(const CBlockCSR& A, CBlockCSR& At) const {
+
+  const auto bs = nVar*nVar;
+
+  At.nRow = A.nCol;
+  At.nCol = A.nRow;
+
+  /*--- Count the entries of each column. ---*/
+
+  At.row_ptr_data.assign(At.nRow+1, 0);
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow)
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k)
+      if (A.col_ind[k] < A.nCol) ++At.row_ptr_data[A.col_ind[k]+1];
+
+  for (auto iRow = 0ul; iRow < At.nRow; ++iRow)
+    At.row_ptr_data[iRow+1] += At.row_ptr_data[iRow];
+
+  /*--- Scatter the transposed blocks, the columns of At are sorted by construction. ---*/
+
+  const auto nnz = At.row_ptr_data[At.nRow];
+  At.col_ind_data.resize(nnz);
+  At.values_data.resize(nnz*bs);
+
+  vector<unsigned long> next(At.row_ptr_data.begin(), At.row_ptr_data.end()-1);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k) {
+      const auto jCol = A.col_ind[k];
+      if (jCol >= A.nCol) continue;
+      const auto pos = next[jCol]++;
+      At.col_ind_data[pos] = iRow;
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          At.values_data[pos*bs + jVar*nVar+iVar] = A.values[k*bs + iVar*nVar+jVar];
+    }
+  }
+
+  At.dia_ptr_data.clear();
+  if (At.nRow == At.nCol) {
+    At.dia_ptr_data.resize(At.nRow);
+    for (auto iRow = 0ul; iRow < At.nRow; ++iRow) {
+      auto k = At.row_ptr_data[iRow];
+      while (k < At.row_ptr_data[iRow+1] && At.col_ind_data[k] != iRow) ++k;
+      if (k == At.row_ptr_data[iRow+1])
+        SU2_MPI::Error("Missing diagonal block in the AMG hierarchy.", CURRENT_FUNCTION);
+      At.dia_ptr_data[iRow] = k;
+    }
+  }
+  At.SetOwned();
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Multiply(const CBlockCSR& A, const CBlockCSR& B, CBlockCSR& C) const {
+
+  const auto bs = nVar*nVar;
+
+  C.nRow = A.nRow;
+  C.nCol = B.nCol;
+  C.row_ptr_data.resize(C.nRow+1);
+  C.row_ptr_data[0] = 0;
+  C.col_ind_data.clear();
+  C.values_data.clear();
+  C.dia_ptr_data.clear();
+
+  /*--- Position of each column in the current row of C. ---*/
+  vector<unsigned long> marker(C.nCol, NONE);
+
+  for (auto iRow = 0ul; iRow < A.nRow; ++iRow) {
+    const auto rowBegin = C.col_ind_data.size();
+
+    for (auto k = A.row_ptr[iRow]; k < A.row_ptr[iRow+1]; ++k) {
+      const auto kRow = A.col_ind[k];
+      if (kRow >= A.nCol) continue;
+
+      for (auto l = B.row_ptr[kRow]; l < B.row_ptr[kRow+1]; ++l) {
+        const auto jCol = B.col_ind[l];
+        if (marker[jCol] == NONE) {
+          marker[jCol] = C.col_ind_data.size();
+          C.col_ind_data.push_back(jCol);
+          C.values_data.resize(C.values_data.size()+bs, ScalarType(0.0));
+        }
+        BlockMatMatAdd(&A.values[k*bs], &B.values[l*bs], &C.values_data[marker[jCol]*bs]);
+      }
+    }
+
+    for (auto k = rowBegin; k < C.col_ind_data.size(); ++k)
+      marker[C.col_ind_data[k]] = NONE;
+    C.row_ptr_data[iRow+1] = C.col_ind_data.size();
+  }
+
+  if (C.nRow == C.nCol) {
+    C.dia_ptr_data.resize(C.nRow);
+    for (auto iRow = 0ul; iRow < C.nRow; ++iRow) {
+      auto k = C.row_ptr_data[iRow];
+      while (k < C.row_ptr_data[iRow+1] && C.col_ind_data[k] != iRow) ++k;
+      if (k == C.row_ptr_data[iRow+1])
+        SU2_MPI::Error("Missing diagonal block in the AMG hierarchy.", CURRENT_FUNCTION);
+      C.dia_ptr_data[iRow] = k;
+    }
+  }
+  C.SetOwned();
+}
+
+template<class ScalarType>
+bool CSysMatrixAMG<ScalarType>::IsSymmetric(const CBlockCSR& A) const {
+
+  const auto bs = nVar*nVar;
+  ScalarType normA = 0.0, normDiff = 0.0;
+
+  for (auto iPoint = 0ul; iPoint < A.nRow; ++iPoint) {
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = A.col_ind[k];
+      if (jPoint >= A.nCol) continue;
+
+      const auto blk_ij = &A.values[k*bs];
+      for (auto l = 0ul; l < bs; ++l) normA += blk_ij[l]*blk_ij[l];
+
+      /*--- Find the transposed block, the column indices are sorted. ---*/
+      const auto begin = A.col_ind + A.row_ptr[jPoint];
+      const auto end = A.col_ind + A.row_ptr[jPoint+1];
+      const auto it = lower_bound(begin, end, iPoint);
+      const ScalarType* blk_ji = (it != end && *it == iPoint)? &A.values[(it-A.col_ind)*bs] : nullptr;
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          ScalarType diff = blk_ij[iVar*nVar+jVar];
+          if (blk_ji) diff -= blk_ji[jVar*nVar+iVar];
+          normDiff += diff*diff;
+        }
+      }
+    }
+  }
+  return normDiff <= SYM_TOL*SYM_TOL * normA;
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::SetupSmoother(CLevel& level) const {
+
+  const auto& A = level.A;
+  const auto n = A.nRow;
+  const auto bs = nVar*nVar;
+
+  level.invD.resize(n*bs);
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint)
+    InvertBlock(&A.values[A.dia_ptr[iPoint]*bs], &level.invD[iPoint*bs]);
+
+  level.r.resize(n*nVar);
+  level.chunk = computeStaticChunkSize(n, omp_get_max_threads(), OMP_MAX_SIZE);
+
+  /*--- Estimate the spectral radius of D^-1 A by power iteration, the starting
+   *    vector is "random" to avoid being orthogonal to the dominant mode. ---*/
+
+  vector<ScalarType> v(n*nVar), w(n*nVar);
+  for (auto i = 0ul; i < n*nVar; ++i) v[i] = ((i*7919ul) % 97ul) / 97.0 - 0.5;
+
+  ScalarType normV = 0.0;
+  for (auto i = 0ul; i < n*nVar; ++i) normV += v[i]*v[i];
+  normV = sqrt(normV);
+
+  ScalarType rho = 0.0;
+  ScalarType tmp[MAXNVAR];
+
+  for (auto iter = 0u; iter < POWER_ITER && normV > 0.0; ++iter) {
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = 0.0;
+      for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k)
+        if (A.col_ind[k] < A.nCol)
+          BlockMatVecAdd(&A.values[k*bs], &v[A.col_ind[k]*nVar], tmp);
+      BlockMatVec(&level.invD[iPoint*bs], tmp, &w[iPoint*nVar]);
+    }
+    ScalarType normW = 0.0;
+    for (auto i = 0ul; i < n*nVar; ++i) normW += w[i]*w[i];
+    normW = sqrt(normW);
+
+    rho = normW / normV;
+    for (auto i = 0ul; i < n*nVar; ++i) v[i] = w[i] / normW;
+    normV = 1.0;
+  }
+
+  level.omega = (rho > 0.0)? ScalarType(4.0 / (3.0 * rho)) : ScalarType(1.0);
+}
+
+template<class ScalarType>
+unsigned long CSysMatrixAMG<ScalarType>::Aggregate(const CBlockCSR& A, vector<unsigned long>& aggregate) const {
+
+  const auto n = A.nRow;
+  const auto bs = nVar*nVar;
+
+  /*--- Strength of connection, ||A_ij||^2 > theta^2 ||A_ii|| ||A_jj||. ---*/
+
+  vector<ScalarType> diagNorm(n);
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint)
+    diagNorm[iPoint] = BlockNorm(&A.values[A.dia_ptr[iPoint]*bs]);
+
+  const auto nnz = A.row_ptr[n] - A.row_ptr[0];
+  vector<bool> strong(nnz, false);
+
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k) {
+      const auto jPoint = A.col_ind[k];
+      if (jPoint >= A.nCol || jPoint == iPoint) continue;
+      const auto norm = BlockNorm(&A.values[k*bs]);
+      strong[k-A.row_ptr[0]] = (norm*norm > THETA*THETA * diagNorm[iPoint] * diagNorm[jPoint]);
+    }
+  }
+
+  auto isStrong = [&](unsigned long k) { return strong[k-A.row_ptr[0]]; };
+
+  aggregate.assign(n, NONE);
+  unsigned long nAgg = 0;
+
+  /*--- Phase 1: Points whose strong neighborhood is free form a new aggregate. ---*/
+
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    if (aggregate[iPoint] != NONE) continue;
+
+    bool free = true;
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1] && free; ++k)
+      if (isStrong(k)) free = (aggregate[A.col_ind[k]] == NONE);
+    if (!free) continue;
+
+    aggregate[iPoint] = nAgg;
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k)
+      if (isStrong(k)) aggregate[A.col_ind[k]] = nAgg;
+    ++nAgg;
+  }
+
+  /*--- Phase 2: Remaining points join a neighboring aggregate of phase 1. ---*/
+
+  const vector<unsigned long> phase1 = aggregate;
+
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    if (aggregate[iPoint] != NONE) continue;
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k) {
+      if (isStrong(k) && phase1[A.col_ind[k]] != NONE) {
+        aggregate[iPoint] = phase1[A.col_ind[k]];
+        break;
+      }
+    }
+  }
+
+  /*--- Phase 3: What is left forms aggregates with its free strong neighbors. ---*/
+
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    if (aggregate[iPoint] != NONE) continue;
+    aggregate[iPoint] = nAgg;
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k)
+      if (isStrong(k) && aggregate[A.col_ind[k]] == NONE) aggregate[A.col_ind[k]] = nAgg;
+    ++nAgg;
+  }
+
+  return nAgg;
+}
+
+template<class ScalarType>
+bool CSysMatrixAMG<ScalarType>::Coarsen(unsigned long iLevel) {
+
+  auto& fine = levels[iLevel];
+  auto& coarse = levels[iLevel+1];
+  const auto& A = fine.A;
+  const auto n = A.nRow;
+  const auto bs = nVar*nVar;
+
+  if (n <= MIN_COARSE_BLOCKS) return false;
+
+  vector<unsigned long> aggregate;
+  const auto nAgg = Aggregate(A, aggregate);
+
+  if (nAgg == 0 || nAgg > MAX_RATIO*n) return false;
+
+  /*--- Smoothed prolongation, P = (I - omega D^-1 A) P_tent, where the tentative
+   *    prolongation has one identity block per row, at the column of the aggregate.
+   *    For non-symmetric matrices the tentative prolongation is used directly. ---*/
+
+  auto& P = fine.P;
+  P.nRow = n;
+  P.nCol = nAgg;
+  P.row_ptr_data.resize(n+1);
+  P.row_ptr_data[0] = 0;
+  P.col_ind_data.clear();
+  P.values_data.clear();
+  P.dia_ptr_data.clear();
+
+  vector<unsigned long> marker(nAgg, NONE);
+  ScalarType DinvA[MAXNVAR*MAXNVAR];
+
+  auto addBlock = [&](unsigned long jCol, const ScalarType* block, ScalarType scale) {
+    if (marker[jCol] == NONE) {
+      marker[jCol] = P.col_ind_data.size();
+      P.col_ind_data.push_back(jCol);
+      P.values_data.resize(P.values_data.size()+bs, ScalarType(0.0));
+    }
+    auto dst = &P.values_data[marker[jCol]*bs];
+    for (auto k = 0ul; k < bs; ++k) dst[k] += scale * block[k];
+  };
+
+  ScalarType identity[MAXNVAR*MAXNVAR] = {0.0};
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) identity[iVar*nVar+iVar] = 1.0;
+
+  for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+    const auto rowBegin = P.col_ind_data.size();
+
+    addBlock(aggregate[iPoint], identity, 1.0);
+
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1] && smoothProlongation; ++k) {
+      const auto jPoint = A.col_ind[k];
+      if (jPoint >= A.nCol) continue;
+      for (auto l = 0ul; l < bs; ++l) DinvA[l] = 0.0;
+      BlockMatMatAdd(&fine.invD[iPoint*bs], &A.values[k*bs], DinvA);
+      addBlock(aggregate[jPoint], DinvA, -fine.omega);
+    }
+
+    for (auto k = rowBegin; k < P.col_ind_data.size(); ++k)
+      marker[P.col_ind_data[k]] = NONE;
+    P.row_ptr_data[iPoint+1] = P.col_ind_data.size();
+  }
+  P.SetOwned();
+
+  /*--- Restriction and Galerkin coarse operator, A_c = R A P. ---*/
+
+  Transpose(P, fine.R);
+
+  CBlockCSR AP;
+  Multiply(A, P, AP);
+  Multiply(fine.R, AP, coarse.A);
+
+  coarse.x.resize(nAgg*nVar);
+  coarse.b.resize(nAgg*nVar);
+
+  return true;
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::FactorizeCoarse() {
+
+  const auto& A = levels[nLevel-1].A;
+  const auto N = A.nRow*nVar;
+  const auto bs = nVar*nVar;
+
+  coarseDirect = (N <= MAX_DENSE_SIZE);
+  if (!coarseDirect) return;
+
+  coarseLU.assign(N*N, ScalarType(0.0));
+  coarsePivot.resize(N);
+
+  for (auto iPoint = 0ul; iPoint < A.nRow; ++iPoint)
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          coarseLU[(iPoint*nVar+iVar)*N + A.col_ind[k]*nVar+jVar] = A.values[k*bs + iVar*nVar+jVar];
+
+  /*--- LU with partial pivoting, L has unit diagonal. ---*/
+
+  for (auto j = 0ul; j < N; ++j) {
+    auto pivot = j;
+    for (auto i = j+1; i < N; ++i)
+      if (fabs(coarseLU[i*N+j]) > fabs(coarseLU[pivot*N+j])) pivot = i;
+    coarsePivot[j] = pivot;
+
+    if (pivot != j)
+      for (auto k = 0ul; k < N; ++k) swap(coarseLU[j*N+k], coarseLU[pivot*N+k]);
+
+    if (coarseLU[j*N+j] == 0.0)
+      SU2_MPI::Error("The coarsest AMG operator is singular.", CURRENT_FUNCTION);
+
+    for (auto i = j+1; i < N; ++i) {
+      coarseLU[i*N+j] /= coarseLU[j*N+j];
+      const auto l_ij = coarseLU[i*N+j];
+      for (auto k = j+1; k < N; ++k) coarseLU[i*N+k] -= l_ij * coarseLU[j*N+k];
+    }
+  }
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Residual(const CLevel& level, const ScalarType* b,
+                                         const ScalarType* x, ScalarType* r) const {
+  const auto& A = level.A;
+  const auto bs = nVar*nVar;
+
+  SU2_OMP_FOR_STAT(level.chunk)
+  for (auto iPoint = 0ul; iPoint < A.nRow; ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      r[iPoint*nVar+iVar] = b[iPoint*nVar+iVar];
+
+    for (auto k = A.row_ptr[iPoint]; k < A.row_ptr[iPoint+1]; ++k)
+      if (A.col_ind[k] < A.nCol)
+        BlockMatVecSub(&A.values[k*bs], &x[A.col_ind[k]*nVar], &r[iPoint*nVar]);
+  }
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Smooth(const CLevel& level, const ScalarType* b, ScalarType* x,
+                                       unsigned short nSweep, bool zeroGuess) const {
+  const auto n = level.A.nRow;
+  const auto bs = nVar*nVar;
+  auto r = level.r.data();
+
+  for (auto iSweep = 0u; iSweep < nSweep; ++iSweep) {
+
+    if (iSweep == 0 && zeroGuess) {
+      SU2_OMP_FOR_STAT(level.chunk)
+      for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+        BlockMatVec(&level.invD[iPoint*bs], &b[iPoint*nVar], &x[iPoint*nVar]);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iPoint*nVar+iVar] *= level.omega;
+      }
+      continue;
+    }
+
+    Residual(level, b, x, r);
+
+    SU2_OMP_FOR_STAT(level.chunk)
+    for (auto iPoint = 0ul; iPoint < n; ++iPoint) {
+      ScalarType dx[MAXNVAR];
+      BlockMatVec(&level.invD[iPoint*bs], &r[iPoint*nVar], dx);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) x[iPoint*nVar+iVar] += level.omega * dx[iVar];
+    }
+  }
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Cycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const {
+
+  const auto& fine = levels[iLevel];
+  const auto bs = nVar*nVar;
+
+  /*--- Coarsest level. ---*/
+
+  if (iLevel == nLevel-1) {
+    if (!coarseDirect) {
+      Smooth(fine, b, x, NU_COARSE, true);
+      return;
+    }
+    SU2_OMP_MASTER
+    {
+      const auto N = fine.A.nRow*nVar;
+      for (auto i = 0ul; i < N; ++i) x[i] = b[i];
+
+      for (auto j = 0ul; j < N; ++j) swap(x[j], x[coarsePivot[j]]);
+
+      for (auto i = 1ul; i < N; ++i)
+        for (auto j = 0ul; j < i; ++j) x[i] -= coarseLU[i*N+j] * x[j];
+
+      for (auto i = N; i > 0;) {
+        --i;
+        for (auto j = i+1; j < N; ++j) x[i] -= coarseLU[i*N+j] * x[j];
+        x[i] /= coarseLU[i*N+i];
+      }
+    }
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  const auto& coarse = levels[iLevel+1];
+  const auto& R = fine.R;
+  const auto& P = fine.P;
+  auto r = fine.r.data();
+  auto bc = coarse.b.data();
+  auto xc = coarse.x.data();
+
+  /*--- Pre smoothing and restriction of the residual. ---*/
+
+  Smooth(fine, b, x, NU_PRE, true);
+
+  Residual(fine, b, x, r);
+
+  SU2_OMP_FOR_STAT(coarse.chunk)
+  for (auto iAgg = 0ul; iAgg < R.nRow; ++iAgg) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) bc[iAgg*nVar+iVar] = 0.0;
+    for (auto k = R.row_ptr[iAgg]; k < R.row_ptr[iAgg+1]; ++k)
+      BlockMatVecAdd(&R.values[k*bs], &r[R.col_ind[k]*nVar], &bc[iAgg*nVar]);
+  }
+
+  /*--- Coarse grid correction. ---*/
+
+  Cycle(iLevel+1, bc, xc);
+
+  SU2_OMP_FOR_STAT(fine.chunk)
+  for (auto iPoint = 0ul; iPoint < P.nRow; ++iPoint)
+    for (auto k = P.row_ptr[iPoint]; k < P.row_ptr[iPoint+1]; ++k)
+      BlockMatVecAdd(&P.values[k*bs], &xc[P.col_ind[k]*nVar], &x[iPoint*nVar]);
+
+  /*--- Post smoothing. ---*/
+
+  Smooth(fine, b, x, NU_POST, false);
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Build(unsigned long val_nVar, unsigned long nPointDomain,
+                                      const unsigned long* row_ptr, const unsigned long* col_ind,
+                                      const unsigned long* dia_ptr, const ScalarType* values,
+                                      bool transposed) {
+  nVar = val_nVar;
+
+  if (nVar > MAXNVAR)
+    SU2_MPI::Error("nVar larger than expected, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  /*--- Fixed size to keep references to the levels valid while coarsening. ---*/
+  levels.resize(MAX_LEVELS);
+
+  /*--- The finest level is a view of the matrix, restricted to the domain points,
+   *    or its transpose (which is explicitly stored). ---*/
+
+  CBlockCSR view;
+  view.nRow = view.nCol = nPointDomain;
+  view.row_ptr = row_ptr;
+  view.col_ind = col_ind;
+  view.dia_ptr = dia_ptr;
+  view.values = values;
+
+  auto& finest = levels[0];
+  if (transposed) {
+    Transpose(view, finest.A);
+  }
+  else {
+    finest.A.row_ptr_data.clear();
+    finest.A.col_ind_data.clear();
+    finest.A.dia_ptr_data.clear();
+    finest.A.values_data.clear();
+    finest.A = view;
+  }
+  SetupSmoother(finest);
+
+  smoothProlongation = IsSymmetric(finest.A);
+
+  nLevel = 1;
+  while (nLevel < MAX_LEVELS && Coarsen(nLevel-1)) {
+    SetupSmoother(levels[nLevel]);
+    ++nLevel;
+  }
+
+  FactorizeCoarse();
+}
+
+template<class ScalarType>
+void CSysMatrixAMG<ScalarType>::Apply(const ScalarType* b, ScalarType* x) const {
+  Cycle(0, b, x);
+}
+
+template class CSysMatrixAMG<su2double>;
+
+#ifdef CODI_REVERSE_TYPE
+template class CSysMatrixAMG<passivedouble>;
+#endif
+
+#ifdef USE_MIXED_PRECISION
+template class CSysMatrixAMG<su2mixedfloat>;
+#endif
@@ -41,7 +41,8 @@ const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief mach
 
 template<class ScalarType>
 CSysSolve<ScalarType>::CSysSolve(const bool mesh_deform_mode) : cg_ready(false), bcg_ready(false),
-                                                                gmres_ready(false), smooth_ready(false) {
+                                                                gmres_ready(false), smooth_ready(false),
+                                                                pgmres_ready(false), pbcg_ready(false) {
   mesh_deform = mesh_deform_mode;
   LinSysRes_ptr = nullptr;
   LinSysSol_ptr = nullptr;
@@ -156,6 +157,60 @@ void CSysSolve<ScalarType>::ModGramSchmidt(int i, vector<vector<ScalarType> > &
 
 }
 
+template<class ScalarType>
+void CSysSolve<ScalarType>::StartReduction(unsigned long n, const ScalarType* local) const {
+
+  /*--- All threads must be done with the result of the previous reduction. ---*/
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  reduceBuf.assign(2*n, ScalarType(0.0));
+  SU2_OMP_BARRIER
+
+  /*--- Sum over threads, the first half of the buffer is sent and the second receives. ---*/
+  for (auto k = 0ul; k < n; ++k) atomicAdd(local[k], reduceBuf[k]);
+
+  SU2_OMP_BARRIER
+
+#ifdef HAVE_MPI
+  /*--- Reduce across all mpi ranks, only master thread communicates. Active types (AD) go
+   *    through their wrapper, which only supports blocking reductions. ---*/
+  SU2_OMP_MASTER
+  {
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double))? MPI_FLOAT : MPI_DOUBLE;
+
+    if (is_same<typename SelectMPIWrapper<ScalarType>::W, CBaseMPIWrapper>::value)
+      CBaseMPIWrapper::Iallreduce(reduceBuf.data(), reduceBuf.data()+n, n, mpi_type,
+                                  MPI_SUM, MPI_COMM_WORLD, &reduceReq);
+    else
+      SelectMPIWrapper<ScalarType>::W::Allreduce(reduceBuf.data(), reduceBuf.data()+n, n, mpi_type,
+                                                 MPI_SUM, MPI_COMM_WORLD);
+  }
+#else
+  SU2_OMP_MASTER
+  for (auto k = 0ul; k < n; ++k) reduceBuf[n+k] = reduceBuf[k];
+#endif
+
+}
+
+template<class ScalarType>
+void CSysSolve<ScalarType>::FinishReduction(unsigned long n, ScalarType* global) const {
+
+#ifdef HAVE_MPI
+  SU2_OMP_MASTER
+  {
+    if (is_same<typename SelectMPIWrapper<ScalarType>::W, CBaseMPIWrapper>::value) {
+      CBaseMPIWrapper::Status status;
+      CBaseMPIWrapper::Wait(&reduceReq, &status);
+    }
+  }
+#endif
+  /*--- Make view of result consistent across threads. ---*/
+  SU2_OMP_BARRIER
+
+  for (auto k = 0ul; k < n; ++k) global[k] = reduceBuf[n+k];
+
+}
+
 template<class ScalarType>
 void CSysSolve<ScalarType>::WriteHeader(string solver, ScalarType restol, ScalarType resinit) const {
 
@@ -203,9 +258,13 @@ unsigned long CSysSolve<ScalarType>::CG_LinSolver(const CSysVector<ScalarType> &
   }
 
   /*--- Allocate if not allocated yet, only one thread can
-   *    do this since the working vectors are shared. ---*/
+   *    do this since the working vectors are shared, and all
+   *    threads must read the flag before the master sets it. ---*/
+
+  const bool allocate = !cg_ready;
+  SU2_OMP_BARRIER
 
-  if (!cg_ready) {
+  if (allocate) {
     SU2_OMP_MASTER
     {
       auto nVar = b.GetNVar();
@@ -347,7 +406,10 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
    Note: elements in w and z are initialized to x to avoid creating
    a temporary CSysVector object for the copy constructor ---*/
 
-  if (!gmres_ready) {
+  const bool allocate = !gmres_ready;
+  SU2_OMP_BARRIER
+
+  if (allocate) {
     SU2_OMP_MASTER
     {
       W.resize(m+1, x);
@@ -476,6 +538,244 @@ unsigned long CSysSolve<ScalarType>::FGMRES_LinSolver(const CSysVector<ScalarTyp
 
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PGMRES_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                       const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                       ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+
+  /*--- Re-orthogonalize if the orthogonal part of the new vector is smaller than
+   sqrt(reorth) of its norm, i.e. if too much cancellation took place. ---*/
+
+  const ScalarType reorth = 0.5;
+
+  /*---  Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  if (m > 5000) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("GMRES subspace is too large.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet, W and Z are shared with FGMRES and the
+   products A * Z are kept to avoid a second matrix-vector product per iteration.
+   All threads need to see the flags before the master thread modifies them. ---*/
+
+  const bool allocate = !gmres_ready || !pgmres_ready;
+  SU2_OMP_BARRIER
+
+  if (allocate) {
+    SU2_OMP_MASTER
+    {
+      W.resize(m+1, x);
+      Z.resize(m+1, x);
+      AZ.resize(m+1, x);
+      gmres_ready = true;
+      pgmres_ready = true;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Define various arrays, see FGMRES_LinSolver. "dots" holds the partial sums
+   of the fused reduction and "prod" its result (projections and squared norm). ---*/
+
+  vector<ScalarType> g(m+1, 0.0);
+  vector<ScalarType> sn(m+1, 0.0);
+  vector<ScalarType> cs(m+1, 0.0);
+  vector<ScalarType> y(m, 0.0);
+  vector<vector<ScalarType> > H(m+1, vector<ScalarType>(m, 0.0));
+  vector<ScalarType> dots(m+2, 0.0);
+  vector<ScalarType> prod(m+2, 0.0);
+
+  /*--- Calculate the norm of the rhs vector. ---*/
+
+  ScalarType norm0 = b.norm();
+
+  /*--- Calculate the initial residual (actually the negative residual) and compute its norm. ---*/
+
+  mat_vec(x, W[0]);
+  W[0] -= b;
+
+  ScalarType beta = W[0].norm();
+
+  if ((beta < tol*norm0) || (beta < eps)) {
+
+    /*--- System is already solved ---*/
+
+    if (master) cout << "CSysSolve::PIPELINED_GMRES(): system solved by initial guess." << endl;
+    residual = beta;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial residual value ---*/
+
+  norm0 = beta;
+
+  /*--- Output header information including initial residual ---*/
+
+  unsigned long i = 0;
+  if ((monitoring) && (master)) {
+    WriteHeader("PIPELINED_GMRES", tol, beta);
+    WriteHistory(i, beta/norm0);
+  }
+
+  /*--- Z and AZ are orthogonalized by recurrences, which amplify round-off errors, i.e. AZ may
+   drift away from A * Z and the residual of the least-squares problem from the true residual.
+   The latter is checked when the former converges, and if needed a new basis is built from it
+   with the remaining iterations. Each pass of this loop builds a basis from W[0]. ---*/
+
+  while (true) {
+
+    /*--- Normalize residual to get w_{0}, and start the pipeline with z_{0} = M w_{0}, A z_{0}. ---*/
+
+    W[0] /= -beta;
+    precond(W[0], Z[0]);
+    mat_vec(Z[0], AZ[0]);
+
+    /*--- Initialize the RHS of the reduced system ---*/
+
+    g.assign(m+1, 0.0);
+    g[0] = beta;
+
+    /*---  Loop over the search directions of this basis ---*/
+
+    unsigned long j = 0;
+    for (j = 0; i < m; j++, i++) {
+
+      /*---  Check if solution has converged ---*/
+
+      if (beta < tol*norm0) break;
+
+      /*--- The new (not yet orthogonal) direction is A M w_{j}, start the reduction of
+       its projections on the basis and of its norm (classical Gram-Schmidt). ---*/
+
+      W[j+1] = AZ[j];
+
+      for (unsigned long k = 0; k <= j; k++) dots[k] = W[j+1].localDot(W[k]);
+      dots[j+1] = W[j+1].localDot(W[j+1]);
+
+      StartReduction(j+2, dots.data());
+
+      /*--- Meanwhile, precondition the new direction and add it to the Krylov subspace. ---*/
+
+      precond(W[j+1], Z[j+1]);
+      mat_vec(Z[j+1], AZ[j+1]);
+
+      FinishReduction(j+2, prod.data());
+
+      ScalarType nrm = prod[j+1];
+
+      if ((nrm <= 0.0) || (nrm != nrm)) {
+        /*--- nrm is the result of a reduction, all ranks take the same path. ---*/
+        SU2_OMP_MASTER
+        SU2_MPI::Error("GMRES orthogonalization failed, linear solver diverged.", CURRENT_FUNCTION);
+      }
+
+      /*--- Orthogonalize, by linearity of the preconditioner and of the matrix the same
+       combination is applied to Z and AZ, keeping AZ[j+1] = A * Z[j+1] = A * M * W[j+1]. ---*/
+
+      const ScalarType thr = nrm*reorth;
+
+      for (unsigned long k = 0; k <= j; k++) {
+        H[k][j] = prod[k];
+        W[j+1].Plus_AX(-prod[k], W[k]);
+        Z[j+1].Plus_AX(-prod[k], Z[k]);
+        AZ[j+1].Plus_AX(-prod[k], AZ[k]);
+        nrm -= prod[k]*prod[k];
+      }
+
+      /*--- Check if re-orthogonalization is necessary, this pass is not overlapped. ---*/
+
+      if (nrm < thr) {
+        for (unsigned long k = 0; k <= j; k++) dots[k] = W[j+1].localDot(W[k]);
+        dots[j+1] = W[j+1].localDot(W[j+1]);
+
+        StartReduction(j+2, dots.data());
+        FinishReduction(j+2, prod.data());
+
+        nrm = prod[j+1];
+        for (unsigned long k = 0; k <= j; k++) {
+          H[k][j] += prod[k];
+          W[j+1].Plus_AX(-prod[k], W[k]);
+          Z[j+1].Plus_AX(-prod[k], Z[k]);
+          AZ[j+1].Plus_AX(-prod[k], AZ[k]);
+          nrm -= prod[k]*prod[k];
+        }
+      }
+
+      /*--- Scale the resulting vectors ---*/
+
+      nrm = sqrt(max(nrm, ScalarType(0.0)));
+      H[j+1][j] = nrm;
+
+      W[j+1] /= nrm;
+      Z[j+1] /= nrm;
+      AZ[j+1] /= nrm;
+
+      /*---  Apply old Givens rotations to new column of the Hessenberg matrix then generate the
+       new Givens rotation matrix and apply it to the last two elements of H[:][j] and g ---*/
+
+      for (unsigned long k = 0; k < j; k++)
+        ApplyGivens(sn[k], cs[k], H[k][j], H[k+1][j]);
+      GenerateGivens(H[j][j], H[j+1][j], sn[j], cs[j]);
+      ApplyGivens(sn[j], cs[j], g[j], g[j+1]);
+
+      /*---  Set L2 norm of residual and check if solution has converged ---*/
+
+      beta = fabs(g[j+1]);
+
+      /*---  Output the relative residual if necessary ---*/
+
+      if ((monitoring) && (master) && ((i+1) % 10 == 0))
+        WriteHistory(i+1, beta/norm0);
+    }
+
+    /*---  Solve the least-squares system and update solution ---*/
+
+    SolveReduced(j, H, g, y);
+    for (unsigned long k = 0; k < j; k++) {
+      x.Plus_AX(y[k], Z[k]);
+    }
+
+    if (i == m) break;
+
+    /*--- Check the true residual. ---*/
+
+    mat_vec(x, W[0]);
+    W[0] -= b;
+    beta = W[0].norm();
+
+    if (beta < tol*norm0) break;
+  }
+
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("PIPELINED_GMRES", i, beta/norm0);
+
+    mat_vec(x, W[0]);
+    W[0] -= b;
+    ScalarType res = W[0].norm();
+
+    if (fabs(res - beta) > tol*10) {
+      if (master) {
+        WriteWarning(beta, res, tol);
+      }
+    }
+
+  }
+
+  residual = beta/norm0;
+  return i;
+
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                        const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -494,7 +794,10 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
 
   /*--- Allocate if not allocated yet ---*/
 
-  if (!bcg_ready) {
+  const bool allocate = !bcg_ready;
+  SU2_OMP_BARRIER
+
+  if (allocate) {
     SU2_OMP_MASTER
     {
       auto nVar = b.GetNVar();
@@ -637,6 +940,213 @@ unsigned long CSysSolve<ScalarType>::BCGSTAB_LinSolver(const CSysVector<ScalarTy
   return i;
 }
 
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::PBCGSTAB_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
+                                                        const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
+                                                        ScalarType tol, unsigned long m, ScalarType & residual, bool monitoring, CConfig *config) const {
+
+  const bool master = (SU2_MPI::GetRank() == MASTER_NODE) && (omp_get_thread_num() == 0);
+  ScalarType norm_r = 0.0, norm0 = 0.0;
+  unsigned long i = 0;
+
+  /*--- Check the subspace size ---*/
+
+  if (m < 1) {
+    SU2_OMP_MASTER
+    SU2_MPI::Error("Number of linear solver iterations must be greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*--- Allocate if not allocated yet ---*/
+
+  enum {R, R0, RH, WW, WH, T, PH, S, SH, ZZ, ZH, V, Q, QH, YY, NVEC};
+
+  /*--- All threads need to see the flag before the master thread modifies it. ---*/
+  const bool allocate = !pbcg_ready;
+  SU2_OMP_BARRIER
+
+  if (allocate) {
+    SU2_OMP_MASTER
+    {
+      P.resize(NVEC, x);
+      pbcg_ready = true;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*--- Notation of the reference, the "hat" vectors are preconditioned, i.e. rh = M r,
+   and the other vectors are their products with the matrix, e.g. w = A rh, t = A wh. ---*/
+
+  auto& r = P[R];   auto& r_0 = P[R0]; auto& rh = P[RH];
+  auto& w = P[WW];  auto& wh = P[WH];  auto& t = P[T];
+  auto& ph = P[PH]; auto& s = P[S];    auto& sh = P[SH];
+  auto& z = P[ZZ];  auto& zh = P[ZH];  auto& v = P[V];
+  auto& q = P[Q];   auto& qh = P[QH];  auto& y = P[YY];
+
+  ScalarType dots[5] = {0.0}, prod[5] = {0.0};
+
+  /*--- Calculate the initial residual, its norm and the norm of the rhs in one reduction
+   overlapped with the first preconditioning and matrix-vector product. ---*/
+
+  mat_vec(x, q);
+  r = b; r -= q;
+
+  dots[0] = r.localDot(r);
+  dots[1] = b.localDot(b);
+  StartReduction(2, dots);
+
+  precond(r, rh);
+  mat_vec(rh, w);
+
+  FinishReduction(2, prod);
+
+  norm_r = sqrt(prod[0]);
+  norm0  = sqrt(prod[1]);
+  if ((norm_r < tol*norm0) || (norm_r < eps)) {
+    if (master) cout << "CSysSolve::PIPELINED_BCGSTAB(): system solved by initial guess." << endl;
+    residual = norm_r;
+    return 0;
+  }
+
+  /*--- Set the norm to the initial initial residual value ---*/
+
+  norm0 = norm_r;
+
+  /*--- Output header information including initial residual ---*/
+
+  if ((monitoring) && (master)) {
+    WriteHeader("PIPELINED_BCGSTAB", tol, norm_r);
+    WriteHistory(i, norm_r/norm0);
+  }
+
+  /*--- Initialization, r_0 = r and alpha = (r_0,r) / (r_0,w). ---*/
+
+  r_0 = r;
+  ph = ScalarType(0.0); s = ScalarType(0.0); sh = ScalarType(0.0);
+  z = ScalarType(0.0); zh = ScalarType(0.0); v = ScalarType(0.0);
+
+  dots[0] = r_0.localDot(w);
+  StartReduction(1, dots);
+
+  precond(w, wh);
+  mat_vec(wh, t);
+
+  FinishReduction(1, prod);
+
+  ScalarType rho = norm_r*norm_r, alpha = rho/prod[0], beta = 0.0, omega = 1.0;
+
+  /*--- Loop over all search directions ---*/
+
+  for (i = 0; i < m; i++) {
+
+    /*--- Update the search directions, p_{i} = r_{i} + beta * (p_{i-1} - omega * s_{i-1})
+     and consequently for s = A ph, sh = M s, and z = A sh. ---*/
+
+    const ScalarType beta_omega = -beta*omega;
+
+    ph.Equals_AX_Plus_BY(beta, ph, beta_omega, sh); ph += rh;
+    sh.Equals_AX_Plus_BY(beta, sh, beta_omega, zh); sh += wh;
+    s.Equals_AX_Plus_BY(beta, s, beta_omega, z);    s += w;
+    z.Equals_AX_Plus_BY(beta, z, beta_omega, v);    z += t;
+
+    /*--- Intermediate residual q = r - alpha * s, qh = M q, and y = A qh. ---*/
+
+    q.Equals_AX_Plus_BY(1.0, r, -alpha, s);
+    qh.Equals_AX_Plus_BY(1.0, rh, -alpha, sh);
+    y.Equals_AX_Plus_BY(1.0, w, -alpha, z);
+
+    /*--- Start the reduction for omega, meanwhile compute zh = M z and v = A zh. ---*/
+
+    dots[0] = q.localDot(y);
+    dots[1] = y.localDot(y);
+    StartReduction(2, dots);
+
+    precond(z, zh);
+    mat_vec(zh, v);
+
+    FinishReduction(2, prod);
+
+    omega = prod[0] / prod[1];
+
+    /*--- Update solution and residuals: ---*/
+
+    /*--- x_{i+1} = x_{i} + alpha * ph + omega * qh ---*/
+    x.Plus_AX(alpha, ph);
+    x.Plus_AX(omega, qh);
+    /*--- r_{i+1} = q - omega * y ---*/
+    r.Equals_AX_Plus_BY(1.0, q, -omega, y);
+    /*--- rh_{i+1} = qh - omega * (wh - alpha * zh) ---*/
+    rh.Equals_AX_Plus_BY(1.0, qh, -omega, wh);
+    rh.Plus_AX(omega*alpha, zh);
+    /*--- w_{i+1} = y - omega * (t - alpha * v) ---*/
+    w.Equals_AX_Plus_BY(1.0, y, -omega, t);
+    w.Plus_AX(omega*alpha, v);
+
+    /*--- Start the reduction for alpha, beta, and the residual norm, meanwhile
+     compute wh = M w and t = A wh. ---*/
+
+    dots[0] = r_0.localDot(r);
+    dots[1] = r_0.localDot(w);
+    dots[2] = r_0.localDot(s);
+    dots[3] = r_0.localDot(z);
+    dots[4] = r.localDot(r);
+    StartReduction(5, dots);
+
+    precond(w, wh);
+    mat_vec(wh, t);
+
+    FinishReduction(5, prod);
+
+    /*--- Compute beta and the step-length alpha for the next iteration. ---*/
+
+    beta = (alpha / omega) * (prod[0] / rho);
+    alpha = prod[0] / (prod[1] + beta*prod[2] - beta*omega*prod[3]);
+    rho = prod[0];
+
+    norm_r = sqrt(prod[4]);
+
+    /*--- The recurrences amplify the round-off errors of the vectors, i.e. the true residual may
+     drift away from r. When r converges replace it, the vectors derived from it, and those of
+     the search direction, by their definitions from x and ph, and continue if needed. ---*/
+
+    if (norm_r < tol*norm0) {
+      mat_vec(x, q);
+      r = b; r -= q;
+      precond(r, rh); mat_vec(rh, w);
+      precond(w, wh); mat_vec(wh, t);
+      mat_vec(ph, s);
+      precond(s, sh); mat_vec(sh, z);
+      precond(z, zh); mat_vec(zh, v);
+      norm_r = r.norm();
+    }
+
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+
+    if (norm_r < tol*norm0) break;
+    if ((monitoring) && (master) && ((i+1) % 10 == 0))
+      WriteHistory(i+1, norm_r/norm0);
+
+  }
+
+  /*--- Recalculate final residual (this should be optional) ---*/
+
+  if ((monitoring) && (config->GetComm_Level() == COMM_FULL)) {
+
+    if (master) WriteFinalResidual("PIPELINED_BCGSTAB", i, norm_r/norm0);
+
+    mat_vec(x, r);
+    r -= b;
+    ScalarType true_res = r.norm();
+
+    if ((fabs(true_res - norm_r) > tol*10.0) && (master)) {
+      WriteWarning(norm_r, true_res, tol);
+    }
+
+  }
+
+  residual = norm_r/norm0;
+  return i;
+}
+
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarType> & b, CSysVector<ScalarType> & x,
                                                         const CMatrixVectorProduct<ScalarType> & mat_vec, const CPreconditioner<ScalarType> & precond,
@@ -657,7 +1167,10 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
   /*--- Allocate vectors for residual (r), solution increment (z), and matrix-vector
    product (A_x), for the latter two this is done only on the first call to the method. ---*/
 
-  if (!smooth_ready) {
+  const bool allocate = !smooth_ready;
+  SU2_OMP_BARRIER
+
+  if (allocate) {
     SU2_OMP_MASTER
     {
       auto nVar = b.GetNVar();
@@ -808,7 +1321,54 @@ void CSysSolve<passivedouble>::HandleTemporariesOut(CSysVector<su2double> & LinS
 #endif
 
 template<class ScalarType>
-unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
+CPreconditioner<ScalarType>* CSysSolve<ScalarType>::CreatePreconditioner(unsigned short kind_prec, MatrixType & Jacobian,
+                                                                         CGeometry *geometry, CConfig *config, bool transposed) {
+  return PrecondType::Create(kind_prec, Jacobian, geometry, config, transposed);
+}
+
+#ifdef USE_MIXED_PRECISION
+template<>
+CPreconditioner<passivedouble>* CSysSolve<passivedouble>::CreatePreconditioner(unsigned short kind_prec, MatrixType & Jacobian,
+                                                                               CGeometry *geometry, CConfig *config, bool transposed) {
+
+  /*--- PaStiX is only available in double precision. ---*/
+
+  switch (kind_prec) {
+    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
+    case PASTIX_LU: case PASTIX_LDLT:
+      return PrecondType::Create(kind_prec, Jacobian, geometry, config, transposed);
+  }
+
+  /*--- The matrix is copied to single precision, the copy shares the sparse pattern and therefore it only needs
+   *    to be allocated once. The temporaries used to interface with the preconditioner are shared by all threads,
+   *    they are sized like the linear system vectors (i.e. this needs to be called after HandleTemporariesIn). ---*/
+
+  SU2_OMP_MASTER
+  {
+    if (!PrecondMatrix_ready) {
+      PrecondMatrix.Initialize(Jacobian, geometry, config);
+      if (kind_prec == LINELET) PrecondMatrix.BuildLineletPreconditioner(geometry, config);
+      PrecondMatrix_ready = true;
+    }
+    const auto nBlk = LinSysRes_ptr->GetNBlk();
+    const auto nBlkDomain = LinSysRes_ptr->GetNBlkDomain();
+    const auto nVar = LinSysRes_ptr->GetNVar();
+    PrecondIn_tmp.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+    PrecondOut_tmp.Initialize(nBlk, nBlkDomain, nVar, nullptr);
+  }
+  SU2_OMP_BARRIER
+
+  PrecondMatrix.SetValZero();
+  PrecondMatrix.MatrixMatrixAddition(1.0, Jacobian);
+
+  auto precond = CPreconditioner<su2mixedfloat>::Create(kind_prec, PrecondMatrix, geometry, config, transposed);
+
+  return new CMixedPrecisionPreconditioner<passivedouble,su2mixedfloat>(precond, PrecondIn_tmp, PrecondOut_tmp);
+}
+#endif
+
+template<class ScalarType>
+unsigned long CSysSolve<ScalarType>::Solve(MatrixType & Jacobian, const CSysVector<su2double> & LinSysRes,
                                            CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config) {
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
@@ -870,29 +1430,14 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   HandleTemporariesIn(LinSysRes, LinSysSol);
 
-  auto mat_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
-  CPreconditioner<ScalarType>* precond = nullptr;
+  auto jac_vec = CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config);
 
-  switch (KindPrecond) {
-    case JACOBI:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, false);
-      break;
-    case ILU:
-      precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config, false);
-      break;
-    case LU_SGS:
-      precond = new CLU_SGSPreconditioner<ScalarType>(Jacobian, geometry, config);
-      break;
-    case LINELET:
-      precond = new CLineletPreconditioner<ScalarType>(Jacobian, geometry, config);
-      break;
-    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
-      precond = new CPastixPreconditioner<ScalarType>(Jacobian, geometry, config, KindPrecond, false);
-      break;
-    default:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, false);
-      break;
-  }
+  /*--- With a matrix-free product the matrix only defines the preconditioner,
+   *    unless that is also external, in which case the matrix is not used. ---*/
+
+  const ProductType& mat_vec = external_mat_vec? *external_mat_vec : jac_vec;
+
+  auto precond = external_precond? external_precond : CreatePreconditioner(KindPrecond, Jacobian, geometry, config, false);
 
   /*--- Build preconditioner. ---*/
 
@@ -913,6 +1458,12 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
+    case PIPELINED_GMRES:
+      IterLinSol = PGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       norm0 = LinSysRes_ptr->norm();
       while (IterLinSol < MaxIter) {
@@ -926,10 +1477,16 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual, ScreenOutput, config);
       break;
     case PASTIX_LDLT : case PASTIX_LU:
-      Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-      Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
+    {
+      if (external_precond)
+        SU2_MPI::Error("Direct linear solvers require an assembled matrix.", CURRENT_FUNCTION);
+      auto direct = CreatePreconditioner(KindSolver, Jacobian, geometry, config, false);
+      direct->Build();
+      (*direct)(*LinSysRes_ptr, *LinSysSol_ptr);
+      delete direct;
       IterLinSol = 1;
       break;
+    }
     default:
       SU2_MPI::Error("Unknown type of linear solver.",CURRENT_FUNCTION);
   }
@@ -939,7 +1496,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 
   HandleTemporariesOut(LinSysSol);
 
-  delete precond;
+  if (!external_precond) delete precond;
 
   if(TapeActive) {
 
@@ -972,6 +1529,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
       case JACOBI:
         Jacobian.BuildJacobiPreconditioner(RequiresTranspose);
         break;
+      case AMG:
+        Jacobian.BuildAMGPreconditioner(RequiresTranspose);
+        break;
       case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
         Jacobian.BuildPastixPreconditioner(geometry, config, KindPrecond, RequiresTranspose);
         break;
@@ -987,7 +1547,7 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
 }
 
 template<class ScalarType>
-unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
+unsigned long CSysSolve<ScalarType>::Solve_b(MatrixType & Jacobian, const CSysVector<su2double> & LinSysRes,
                                              CSysVector<su2double> & LinSysSol, CGeometry *geometry, CConfig *config) {
 #ifdef CODI_REVERSE_TYPE
 
@@ -1022,26 +1582,14 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
 
   /*--- Set up preconditioner and matrix-vector product ---*/
 
-  CPreconditioner<ScalarType>* precond  = nullptr;
+  HandleTemporariesIn(LinSysRes, LinSysSol);
 
-  switch(KindPrecond) {
-    case ILU:
-      precond = new CILUPreconditioner<ScalarType>(Jacobian, geometry, config, RequiresTranspose);
-      break;
-    case JACOBI:
-      precond = new CJacobiPreconditioner<ScalarType>(Jacobian, geometry, config, RequiresTranspose);
-      break;
-    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
-      precond = new CPastixPreconditioner<ScalarType>(Jacobian, geometry, config, KindPrecond, RequiresTranspose);
-      break;
-  }
+  auto precond = CreatePreconditioner(KindPrecond, Jacobian, geometry, config, RequiresTranspose);
 
   auto mat_vec = CSysMatrixVectorProductTransposed<ScalarType>(Jacobian, geometry, config);
 
   /*--- Solve the system ---*/
 
-  HandleTemporariesIn(LinSysRes, LinSysSol);
-
   switch(KindSolver) {
     case FGMRES:
       IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol , MaxIter, Residual, ScreenOutput, config);
@@ -1052,6 +1600,12 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
     case CONJUGATE_GRADIENT:
       IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
       break;
+    case PIPELINED_GMRES:
+      IterLinSol = PGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = PBCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, Residual, ScreenOutput, config);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       Norm0 = LinSysRes_ptr->norm();
@@ -1063,10 +1617,14 @@ unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian,
       }
       break;
     case PASTIX_LDLT : case PASTIX_LU:
-      Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver, RequiresTranspose);
-      Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
+    {
+      auto direct = CreatePreconditioner(KindSolver, Jacobian, geometry, config, RequiresTranspose);
+      direct->Build();
+      (*direct)(*LinSysRes_ptr, *LinSysSol_ptr);
+      delete direct;
       IterLinSol = 1;
       break;
+    }
     default:
       SU2_MPI::Error("The specified linear solver is not yet implemented for the discrete adjoint method.", CURRENT_FUNCTION);
       break;
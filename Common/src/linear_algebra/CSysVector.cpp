@@ -229,7 +229,8 @@ ScalarType CSysVector<ScalarType>::dot(const CSysVector<ScalarType> & u) const {
   SU2_OMP_MASTER
   {
     sum = dotRes;
-    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    const auto mpi_type = (sizeof(ScalarType) < sizeof(double))? MPI_FLOAT : MPI_DOUBLE;
+    SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, mpi_type, MPI_SUM, MPI_COMM_WORLD);
   }
 #endif
   /*--- Make view of result consistent across threads. ---*/
@@ -238,6 +239,18 @@ ScalarType CSysVector<ScalarType>::dot(const CSysVector<ScalarType> & u) const {
   return dotRes;
 }
 
+template<class ScalarType>
+ScalarType CSysVector<ScalarType>::localDot(const CSysVector<ScalarType> & u) const {
+
+  ScalarType sum = 0.0;
+
+  PARALLEL_FOR
+  for(auto i=0ul; i<nElmDomain; ++i)
+    sum += vec_val[i]*u.vec_val[i];
+
+  return sum;
+}
+
 /*--- Explicit instantiations ---*/
 template class CSysVector<su2double>;
 template void CSysVector<su2double>::PassiveCopy(const CSysVector<su2double>&);
@@ -247,3 +260,13 @@ template class CSysVector<passivedouble>;
 template void CSysVector<su2double>::PassiveCopy(const CSysVector<passivedouble>&);
 template void CSysVector<passivedouble>::PassiveCopy(const CSysVector<su2double>&);
 #endif
+
+#ifdef USE_MIXED_PRECISION
+template class CSysVector<su2mixedfloat>;
+template void CSysVector<su2mixedfloat>::PassiveCopy(const CSysVector<passivedouble>&);
+template void CSysVector<passivedouble>::PassiveCopy(const CSysVector<su2mixedfloat>&);
+#ifdef CODI_REVERSE_TYPE
+template void CSysVector<su2mixedfloat>::PassiveCopy(const CSysVector<su2double>&);
+template void CSysVector<su2double>::PassiveCopy(const CSysVector<su2mixedfloat>&);
+#endif
+#endif
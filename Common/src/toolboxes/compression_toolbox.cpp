@@ -0,0 +1,224 @@
+/*!
+ * \file compression_toolbox.cpp
+ * \brief Implementation of the byte shuffle and of the LZ4 block compression.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/compression_toolbox.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace CompressionToolbox {
+
+namespace {
+
+/*--- Constants of the LZ4 block format. ---*/
+constexpr size_t MIN_MATCH = 4;       /*!< \brief Shortest match that can be encoded. */
+constexpr size_t LAST_LITERALS = 5;   /*!< \brief The last 5 bytes of a block are always literals. */
+constexpr size_t MF_LIMIT = 12;       /*!< \brief The last match must start 12 bytes before the end. */
+constexpr size_t MAX_OFFSET = 65535;  /*!< \brief Largest distance of a match. */
+constexpr int HASH_LOG = 16;          /*!< \brief Log2 of the size of the match finder table. */
+
+inline uint32_t Read32(const uint8_t* p) {
+  uint32_t val;
+  memcpy(&val, p, sizeof(uint32_t));
+  return val;
+}
+
+inline uint64_t Read64(const uint8_t* p) {
+  uint64_t val;
+  memcpy(&val, p, sizeof(uint64_t));
+  return val;
+}
+
+inline uint32_t Hash(uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32 - HASH_LOG);
+}
+
+/*--- Continuation bytes of a literal or match length (the first 15 are in the token). ---*/
+inline uint8_t* PutLength(uint8_t* op, size_t length) {
+  for (; length >= 255; length -= 255) *op++ = 255;
+  *op++ = uint8_t(length);
+  return op;
+}
+
+/*--- Copy in chunks of 8 bytes, may write up to 7 bytes past dst+length. If src and dst overlap,
+ they must be at least 8 bytes apart (dst after src). ---*/
+inline void WildCopy8(uint8_t* dst, const uint8_t* src, size_t length) {
+  uint8_t* const end = dst + length;
+  do {
+    memcpy(dst, src, 8);
+    dst += 8;
+    src += 8;
+  } while (dst < end);
+}
+
+inline bool GetLength(const uint8_t* src, size_t srcSize, size_t& ip, size_t& length) {
+  uint8_t byte;
+  do {
+    if (ip >= srcSize) return false;
+    byte = src[ip++];
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+}
+
+void ByteShuffle(const uint8_t* src, size_t nElem, size_t elemSize, uint8_t* dst) {
+  for (size_t iElem = 0; iElem < nElem; ++iElem)
+    for (size_t iByte = 0; iByte < elemSize; ++iByte)
+      dst[iByte*nElem + iElem] = src[iElem*elemSize + iByte];
+}
+
+void ByteUnshuffle(const uint8_t* src, size_t nElem, size_t elemSize, uint8_t* dst) {
+  for (size_t iElem = 0; iElem < nElem; ++iElem)
+    for (size_t iByte = 0; iByte < elemSize; ++iByte)
+      dst[iElem*elemSize + iByte] = src[iByte*nElem + iElem];
+}
+
+size_t LZ4Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+
+  uint8_t* op = dst;
+  const uint8_t* const oend = dst + dstCapacity;
+  size_t anchor = 0;
+
+  /*--- Append a sequence, i.e. the literals since the anchor followed by a match (none for the last one). ---*/
+
+  auto appendSequence = [&](size_t literalEnd, size_t matchLength, size_t offset) {
+
+    const size_t literalLength = literalEnd - anchor;
+    size_t sequenceSize = 1 + literalLength + ((literalLength >= 15)? (literalLength - 15)/255 + 1 : 0);
+    if (matchLength) sequenceSize += 2 + ((matchLength >= MIN_MATCH + 15)? (matchLength - MIN_MATCH - 15)/255 + 1 : 0);
+    if (size_t(oend - op) < sequenceSize) return false;
+
+    uint8_t* token = op++;
+    *token = uint8_t(((literalLength < 15)? literalLength : 15) << 4);
+    if (literalLength >= 15) op = PutLength(op, literalLength - 15);
+    if ((op + literalLength + 8 <= oend) && (anchor + literalLength + 8 <= srcSize)) {
+      WildCopy8(op, src + anchor, literalLength);
+    } else if (literalLength) {
+      memcpy(op, src + anchor, literalLength);
+    }
+    op += literalLength;
+
+    if (matchLength) {
+      *op++ = uint8_t(offset);
+      *op++ = uint8_t(offset >> 8);
+      const size_t length = matchLength - MIN_MATCH;
+      *token |= uint8_t((length < 15)? length : 15);
+      if (length >= 15) op = PutLength(op, length - 15);
+    }
+    return true;
+  };
+
+  if (srcSize > MF_LIMIT) {
+
+    /*--- Last position of each hashed 4 byte sequence. ---*/
+    std::vector<uint32_t> table(size_t(1) << HASH_LOG, 0);
+
+    const size_t matchStartLimit = srcSize - MF_LIMIT;
+    const size_t matchEndLimit = srcSize - LAST_LITERALS;
+
+    size_t ip = 0, misses = 0;
+
+    while (ip <= matchStartLimit) {
+
+      const uint32_t sequence = Read32(src + ip);
+      const uint32_t hash = Hash(sequence);
+      const size_t ref = table[hash];
+      table[hash] = uint32_t(ip);
+
+      if ((ref < ip) && (ip - ref <= MAX_OFFSET) && (Read32(src + ref) == sequence)) {
+
+        /*--- Extend the match 8 bytes at a time, then byte by byte. ---*/
+        size_t length = MIN_MATCH;
+        while ((ip + length + 8 <= matchEndLimit) && (Read64(src + ref + length) == Read64(src + ip + length))) length += 8;
+        while ((ip + length < matchEndLimit) && (src[ref + length] == src[ip + length])) ++length;
+
+        if (!appendSequence(ip, length, ip - ref)) return 0;
+        ip += length;
+        anchor = ip;
+        misses = 0;
+      }
+      else {
+        /*--- Skip faster through data that does not compress (the step grows every 64 misses). ---*/
+        ip += 1 + (misses++ >> 6);
+      }
+    }
+  }
+
+  if (!appendSequence(srcSize, 0, 0)) return 0;
+
+  return size_t(op - dst);
+}
+
+bool LZ4Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+
+  size_t ip = 0, op = 0;
+
+  while (ip < srcSize) {
+
+    const uint8_t token = src[ip++];
+
+    size_t literalLength = token >> 4;
+    if ((literalLength == 15) && !GetLength(src, srcSize, ip, literalLength)) return false;
+    if ((literalLength > srcSize - ip) || (literalLength > dstSize - op)) return false;
+
+    if ((op + literalLength + 8 <= dstSize) && (ip + literalLength + 8 <= srcSize)) {
+      WildCopy8(dst + op, src + ip, literalLength);
+    } else {
+      memcpy(dst + op, src + ip, literalLength);
+    }
+    ip += literalLength;
+    op += literalLength;
+
+    /*--- The last sequence has no match. ---*/
+    if (ip == srcSize) break;
+
+    if (srcSize - ip < 2) return false;
+    const size_t offset = src[ip] | (size_t(src[ip+1]) << 8);
+    ip += 2;
+    if ((offset == 0) || (offset > op)) return false;
+
+    size_t matchLength = token & 15;
+    if ((matchLength == 15) && !GetLength(src, srcSize, ip, matchLength)) return false;
+    matchLength += MIN_MATCH;
+    if (matchLength > dstSize - op) return false;
+
+    /*--- The match may overlap the bytes it produces (repeated patterns). ---*/
+    const uint8_t* match = dst + op - offset;
+    if ((offset >= 8) && (op + matchLength + 8 <= dstSize)) {
+      WildCopy8(dst + op, match, matchLength);
+    } else {
+      for (size_t i = 0; i < matchLength; ++i) dst[op + i] = match[i];
+    }
+    op += matchLength;
+  }
+
+  return op == dstSize;
+}
+
+}
@@ -62,6 +62,10 @@ void computeGradientsGreenGauss(CSolver* solver,
   size_t nPointDomain = geometry.GetnPointDomain();
   size_t nDim = geometry.GetnDim();
 
+  /*--- Contiguous copy of the dual grid, avoids indirection through CPoint/CEdge. ---*/
+
+  const auto& dualGrid = geometry.GetDualGridSoA();
+
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
@@ -74,11 +78,10 @@ void computeGradientsGreenGauss(CSolver* solver,
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
   {
-    auto node = geometry.node[iPoint];
+    const su2double volume = dualGrid.GetVolume(iPoint);
 
     AD::StartPreacc();
-    AD::SetPreaccIn(node->GetVolume());
-    AD::SetPreaccIn(node->GetPeriodicVolume());
+    AD::SetPreaccIn(volume);
 
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
       AD::SetPreaccIn(field(iPoint,iVar));
@@ -91,22 +94,25 @@ void computeGradientsGreenGauss(CSolver* solver,
 
     /*--- Handle averaging and division by volume in one constant. ---*/
 
-    su2double halfOnVol = 0.5 / (node->GetVolume()+node->GetPeriodicVolume());
+    su2double halfOnVol = 0.5 / volume;
 
     /*--- Add a contribution due to each neighbor. ---*/
 
-    for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+    const auto neighbors = dualGrid.GetNeighbors(iPoint);
+    const auto edges = dualGrid.GetNeighborEdges(iPoint);
+
+    for (size_t iNeigh = 0; iNeigh < dualGrid.GetnNeighbor(iPoint); ++iNeigh)
     {
-      size_t iEdge = node->GetEdge(iNeigh);
-      size_t jPoint = node->GetPoint(iNeigh);
+      size_t iEdge = edges[iNeigh];
+      size_t jPoint = neighbors[iNeigh];
 
       /*--- Determine if edge points inwards or outwards of iPoint.
        *    If inwards we need to flip the area vector. ---*/
 
-      su2double dir = (iPoint == geometry.edge[iEdge]->GetNode(0))? 1.0 : -1.0;
+      su2double dir = (iPoint == dualGrid.GetNode(iEdge,0))? 1.0 : -1.0;
       su2double weight = dir * halfOnVol;
 
-      const su2double* area = geometry.edge[iEdge]->GetNormal();
+      const su2double* area = dualGrid.GetNormal(iEdge);
       AD::SetPreaccIn(area, nDim);
 
       for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
@@ -142,13 +148,12 @@ void computeGradientsGreenGauss(CSolver* solver,
       for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
       {
         size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
-        auto node = geometry.node[iPoint];
 
         /*--- Halo points do not need to be considered. ---*/
 
-        if (!node->GetDomain()) continue;
+        if (!geometry.node[iPoint]->GetDomain()) continue;
 
-        su2double volume = node->GetVolume() + node->GetPeriodicVolume();
+        su2double volume = dualGrid.GetVolume(iPoint);
 
         const su2double* area = geometry.vertex[iMarker][iVertex]->GetNormal();
 
@@ -26,13 +26,217 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/omp_structure.hpp"
 
 
+namespace LeastSquaresHelpers {
+
+/*!
+ * \brief Compute S := inv(R)*transpose(inv(R)) from the sums accumulated in the upper triangular
+ *        entries of the least-squares matrix (R is computed here by Cholesky decomposition).
+ * \note Singular matrices yield S = 0, i.e. a zero gradient.
+ * \param[in] nDim - Number of dimensions.
+ * \param[in] r11, r12, r22, r13, r23_a, r23_b, r33 - Accumulated entries (see computeGradientsLeastSquares).
+ * \param[out] Smatrix - The S matrix.
+ */
+inline void computeSmatrix(size_t nDim, su2double r11, su2double r12, su2double r22, su2double r13,
+                           su2double r23_a, su2double r23_b, su2double r33, su2double Smatrix[][3])
+{
+  su2double r23 = 0.0;
+
+  if (r11 >= 0.0) r11 = sqrt(r11);
+  if (r11 >= 0.0) r12 /= r11; else r12 = 0.0;
+  su2double tmp = r22-r12*r12;
+  if (tmp >= 0.0) r22 = sqrt(tmp); else r22 = 0.0;
+
+  if (nDim == 3) {
+    if (r11 >= 0.0) r13 /= r11; else r13 = 0.0;
+
+    if ((r22 >= 0.0) && (r11*r22 >= 0.0)) {
+      r23 = r23_a/r22 - r23_b*r12/(r11*r22);
+    } else {
+      r23 = 0.0;
+    }
+
+    tmp = r33 - r23*r23 - r13*r13;
+    if (tmp >= 0.0) r33 = sqrt(tmp); else r33 = 0.0;
+  }
+
+  /*--- Compute determinant ---*/
+
+  su2double detR2 = (r11*r22)*(r11*r22);
+  if (nDim == 3) detR2 *= r33*r33;
+
+  /*--- Detect singular matrices ---*/
+
+  bool singular = false;
+
+  if (detR2 <= EPS) {
+    detR2 = 1.0;
+    singular = true;
+  }
+
+  /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+
+  if (singular) {
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Smatrix[iDim][jDim] = 0.0;
+  }
+  else {
+    if (nDim == 2) {
+      Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+      Smatrix[0][1] = -r11*r12/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = r11*r11/detR2;
+    }
+    else {
+      su2double z11 = r22*r33;
+      su2double z12 =-r12*r33;
+      su2double z13 = r12*r23-r13*r22;
+      su2double z22 = r11*r33;
+      su2double z23 =-r11*r23;
+      su2double z33 = r11*r22;
+
+      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+      Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+      Smatrix[0][2] = (z13*z33)/detR2;
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+      Smatrix[1][2] = (z23*z33)/detR2;
+      Smatrix[2][0] = Smatrix[0][2];
+      Smatrix[2][1] = Smatrix[1][2];
+      Smatrix[2][2] = (z33*z33)/detR2;
+    }
+  }
+}
+
+/*!
+ * \brief Compute and cache the least-squares weights of the domain points of a grid, i.e. the
+ *        vectors a_ij = S_i * w_ij * (x_j - x_i), such that grad(u)_i = sum_j a_ij (u_j - u_i).
+ * \note Must be called by all threads (of the parallel region, if any).
+ * \param[in,out] geometry - Geometric grid properties, the weights are stored in its dual grid.
+ * \param[in] weighted - Use inverse-distance weights.
+ */
+inline void computeWeights(CGeometry& geometry, bool weighted)
+{
+  constexpr size_t MAXNDIM = 3;
+
+  size_t nPointDomain = geometry.GetnPointDomain();
+  size_t nDim = geometry.GetnDim();
+
+  auto& dualGrid = geometry.GetDualGridSoA();
+
+  SU2_OMP_MASTER
+  dualGrid.AllocateLeastSquaresWeights(weighted);
+  SU2_OMP_BARRIER
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const su2double* coord_i = dualGrid.GetCoord(iPoint);
+    const auto neighbors = dualGrid.GetNeighbors(iPoint);
+    const size_t nNeigh = dualGrid.GetnNeighbor(iPoint);
+
+    /*--- Same sums as computeGradientsLeastSquares, the weighted distances
+     *    are kept in the cache while the R matrix is accumulated. ---*/
+
+    su2double r11 = 0.0, r12 = 0.0, r22 = 0.0, r13 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+
+    for (size_t iNeigh = 0; iNeigh < nNeigh; ++iNeigh)
+    {
+      const su2double* coord_j = dualGrid.GetCoord(neighbors[iNeigh]);
+      su2double* weights = dualGrid.GetLeastSquaresWeights(weighted, iPoint, iNeigh);
+
+      su2double dist_ij[MAXNDIM] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+
+      su2double weight = 1.0;
+
+      if (weighted)
+      {
+        weight = 0.0;
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          weight += dist_ij[iDim] * dist_ij[iDim];
+      }
+
+      /*--- Coincident points do not contribute. ---*/
+
+      if (weight > 0.0)
+      {
+        weight = 1.0 / weight;
+
+        r11 += dist_ij[0]*dist_ij[0]*weight;
+        r12 += dist_ij[0]*dist_ij[1]*weight;
+        r22 += dist_ij[1]*dist_ij[1]*weight;
+
+        if (nDim == 3)
+        {
+          r13   += dist_ij[0]*dist_ij[2]*weight;
+          r23_a += dist_ij[1]*dist_ij[2]*weight;
+          r23_b += dist_ij[0]*dist_ij[2]*weight;
+          r33   += dist_ij[2]*dist_ij[2]*weight;
+        }
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          weights[iDim] = dist_ij[iDim] * weight;
+      }
+      else
+      {
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          weights[iDim] = 0.0;
+      }
+    }
+
+    su2double Smatrix[MAXNDIM][MAXNDIM];
+
+    computeSmatrix(nDim, r11, r12, r22, r13, r23_a, r23_b, r33, Smatrix);
+
+    /*--- Fold S into the weighted distances. ---*/
+
+    for (size_t iNeigh = 0; iNeigh < nNeigh; ++iNeigh)
+    {
+      su2double* weights = dualGrid.GetLeastSquaresWeights(weighted, iPoint, iNeigh);
+
+      su2double dist_ij[MAXNDIM] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = weights[iDim];
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+      {
+        weights[iDim] = 0.0;
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          weights[iDim] += Smatrix[iDim][jDim] * dist_ij[jDim];
+      }
+    }
+  }
+
+  SU2_OMP_MASTER
+  dualGrid.SetLeastSquaresWeightsValid(weighted);
+}
+
+} // namespace LeastSquaresHelpers
+
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
- * \note See notes from computeGradientsGreenGauss.hpp.
+ * \note See notes from computeGradientsGreenGauss.hpp. If the geometric weights are cached
+ *       (LEAST_SQUARES_CACHE) the gradient is computed in one sweep over the neighbors, and
+ *       Rmatrix is not used. The cache is built here, the first time it is needed after the
+ *       dual grid is (re)computed.
  * \param[in] solver - Optional, solver associated with the field (used only for MPI).
  * \param[in] kindMpiComm - Type of MPI communication required.
  * \param[in] kindPeriodicComm - Type of periodic communication required.
@@ -63,6 +267,8 @@ void computeGradientsLeastSquares(CSolver* solver,
   size_t nPointDomain = geometry.GetnPointDomain();
   size_t nDim = geometry.GetnDim();
 
+  const auto& dualGrid = geometry.GetDualGridSoA();
+
 #ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
@@ -70,13 +276,65 @@ void computeGradientsLeastSquares(CSolver* solver,
                      omp_get_max_threads(), OMP_MAX_CHUNK);
 #endif
 
+  double tick = 0.0;
+  SU2_OMP_MASTER
+  config.Tick(&tick);
+
+  if (config.GetLeastSquares_Cache())
+  {
+    /*--- All threads must see the same state of the cache before it is (re)built. ---*/
+
+    const bool buildCache = !dualGrid.HasLeastSquaresWeights(weighted);
+    SU2_OMP_BARRIER
+
+    if (buildCache)
+      LeastSquaresHelpers::computeWeights(geometry, weighted);
+
+    /*--- Single sweep, grad(u)_i = sum_j a_ij (u_j - u_i). ---*/
+
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint, iVar, iDim) = 0.0;
+
+      const auto neighbors = dualGrid.GetNeighbors(iPoint);
+
+      for (size_t iNeigh = 0; iNeigh < dualGrid.GetnNeighbor(iPoint); ++iNeigh)
+      {
+        size_t jPoint = neighbors[iNeigh];
+        const su2double* weights = dualGrid.GetLeastSquaresWeights(weighted, iPoint, iNeigh);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += weights[iDim] * delta_ij;
+        }
+      }
+    }
+
+    SU2_OMP_MASTER
+    if (solver != nullptr)
+    {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
+    SU2_OMP_BARRIER
+
+    SU2_OMP_MASTER
+    config.Tock(tick, "computeGradientsLeastSquares", 2);
+    return;
+  }
+
   /*--- First loop over non-halo points of the grid. ---*/
 
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
   {
-    auto node = geometry.node[iPoint];
-    const su2double* coord_i = node->GetCoord();
+    const su2double* coord_i = dualGrid.GetCoord(iPoint);
 
     AD::StartPreacc();
     AD::SetPreaccIn(coord_i, nDim);
@@ -95,11 +353,13 @@ void computeGradientsLeastSquares(CSolver* solver,
         Rmatrix(iPoint, iDim, jDim) = 0.0;
 
 
-    for (size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+    const auto neighbors = dualGrid.GetNeighbors(iPoint);
+
+    for (size_t iNeigh = 0; iNeigh < dualGrid.GetnNeighbor(iPoint); ++iNeigh)
     {
-      size_t jPoint = node->GetPoint(iNeigh);
+      size_t jPoint = neighbors[iNeigh];
 
-      const su2double* coord_j = geometry.node[jPoint]->GetCoord();
+      const su2double* coord_j = dualGrid.GetCoord(jPoint);
       AD::SetPreaccIn(coord_j, nDim);
 
       /*--- Distance vector from iPoint to jPoint ---*/
@@ -186,18 +446,13 @@ void computeGradientsLeastSquares(CSolver* solver,
     su2double r11 = Rmatrix(iPoint,0,0);
     su2double r12 = Rmatrix(iPoint,0,1);
     su2double r22 = Rmatrix(iPoint,1,1);
-    su2double r13 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+    su2double r13 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
 
     AD::StartPreacc();
     AD::SetPreaccIn(r11);
     AD::SetPreaccIn(r12);
     AD::SetPreaccIn(r22);
 
-    if (r11 >= 0.0) r11 = sqrt(r11);
-    if (r11 >= 0.0) r12 /= r11; else r12 = 0.0;
-    su2double tmp = r22-r12*r12;
-    if (tmp >= 0.0) r22 = sqrt(tmp); else r22 = 0.0;
-
     if (nDim == 3) {
       r13   = Rmatrix(iPoint,0,2);
       r23_a = Rmatrix(iPoint,1,2);
@@ -208,68 +463,11 @@ void computeGradientsLeastSquares(CSolver* solver,
       AD::SetPreaccIn(r23_a);
       AD::SetPreaccIn(r23_b);
       AD::SetPreaccIn(r33);
-
-      if (r11 >= 0.0) r13 /= r11; else r13 = 0.0;
-
-      if ((r22 >= 0.0) && (r11*r22 >= 0.0)) {
-        r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-      } else {
-        r23 = 0.0;
-      }
-
-      tmp = r33 - r23*r23 - r13*r13;
-      if (tmp >= 0.0) r33 = sqrt(tmp); else r33 = 0.0;
-    }
-
-    /*--- Compute determinant ---*/
-
-    su2double detR2 = (r11*r22)*(r11*r22);
-    if (nDim == 3) detR2 *= r33*r33;
-
-    /*--- Detect singular matrices ---*/
-
-    bool singular = false;
-
-    if (detR2 <= EPS) {
-      detR2 = 1.0;
-      singular = true;
     }
 
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-
     su2double Smatrix[MAXNDIM][MAXNDIM];
 
-    if (singular) {
-      for (size_t iDim = 0; iDim < nDim; ++iDim)
-        for (size_t jDim = 0; jDim < nDim; ++jDim)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        su2double z11 = r22*r33;
-        su2double z12 =-r12*r33;
-        su2double z13 = r12*r23-r13*r22;
-        su2double z22 = r11*r33;
-        su2double z23 =-r11*r23;
-        su2double z33 = r11*r22;
-
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
-    }
+    LeastSquaresHelpers::computeSmatrix(nDim, r11, r12, r22, r13, r23_a, r23_b, r33, Smatrix);
 
     for (size_t iDim = 0; iDim < nDim; ++iDim)
       for (size_t jDim = 0; jDim < nDim; ++jDim)
@@ -307,4 +505,7 @@ void computeGradientsLeastSquares(CSolver* solver,
   }
   SU2_OMP_BARRIER
 
+  SU2_OMP_MASTER
+  config.Tock(tick, "computeGradientsLeastSquares", 2);
+
 }
@@ -25,6 +25,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "CIntegration.hpp"
 
 /*!
@@ -32,7 +34,7 @@
  * \brief Class for time integration using a multigrid method.
  * \author F. Palacios
  */
-class CMultiGridIntegration final : public CIntegration {
+class CMultiGridIntegration : public CIntegration {
 public:
   /*!
    * \brief Constructor of the class.
@@ -53,7 +55,7 @@ public:
                            CNumerics ******numerics_container, CConfig **config,
                            unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
 
-private:
+protected:
   /*!
    * \brief Perform a Full-Approximation Storage (FAS) Multigrid.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -0,0 +1,110 @@
+/*!
+ * \file CNewtonIntegration.hpp
+ * \brief Declaration of class for matrix-free Newton-Krylov integration of the flow equations.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMultiGridIntegration.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+
+/*!
+ * \class CNewtonIntegration
+ * \brief Jacobian-free Newton-Krylov (JFNK) integration of the steady flow equations.
+ * \note The products of the Krylov solver with the Jacobian of the pseudo-time system are approximated
+ *       by forward differences of the residual, J*v ~ (R(U+eps*v)-R(U))/eps + Vol/dt*v, the Jacobian
+ *       assembled by the flow solver (approximate, with first order accuracy) is only used to build the
+ *       preconditioner. The first NEWTON_KRYLOV_STARTUP_ITER iterations are normal implicit iterations.
+ * \author SU2 Contributors
+ */
+class CNewtonIntegration final : public CMultiGridIntegration {
+private:
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for light point loops. */
+
+  /*--- Type of the flow linear solver, see CSolver::System. ---*/
+#ifndef CODI_FORWARD_TYPE
+  using ScalarType = passivedouble;
+#else
+  using ScalarType = su2double;
+#endif
+
+  /*!
+   * \class CMatrixFreeProduct
+   * \brief Matrix-vector product passed to the linear solver, evaluated by CNewtonIntegration.
+   */
+  class CMatrixFreeProduct final : public CMatrixVectorProduct<ScalarType> {
+  private:
+    CNewtonIntegration* integration;  /*!< \brief Integration that owns the product. */
+
+  public:
+    CMatrixFreeProduct(CNewtonIntegration* owner) : integration(owner) {}
+
+    inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+      integration->MatrixFreeProduct(u, v);
+    }
+  };
+
+  CMatrixFreeProduct product;  /*!< \brief The matrix-free product. */
+
+  /*--- Problem being solved by the current iteration (finest grid). ---*/
+  CGeometry* geometry_fine = nullptr;
+  CSolver** solvers_fine = nullptr;
+  CNumerics** numerics_fine = nullptr;
+  CConfig* config_zone = nullptr;
+
+  CSysVector<su2double> Residual_0;  /*!< \brief Residual at the linearization point, R(U). */
+  CSysVector<su2double> LinSysRhs;   /*!< \brief Right hand side of the linear system (LinSysRes is overwritten by the products). */
+  su2double FD_Scale = 0.0;          /*!< \brief Finite difference step for a unit perturbation, FD_Step*(1+mean(|U|)). */
+
+  /*!
+   * \brief Approximate the product of the Jacobian with a vector by finite differences of the residual.
+   * \note Must be called by all threads, the solution of the solver is perturbed (see MultiGrid_Iteration).
+   * \param[in] u - Vector being multiplied.
+   * \param[out] v - Result of the product.
+   */
+  void MatrixFreeProduct(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v);
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNewtonIntegration(CConfig *config);
+
+  /*!
+   * \brief Do one Newton-Krylov iteration of the flow equations.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method (the way in which the equations are solved).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] iZone - Current zone.
+   * \param[in] iInst - Current instance.
+   */
+  void MultiGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container,
+                           CNumerics ******numerics_container, CConfig **config,
+                           unsigned short RunTime_EqSystem, unsigned short iZone, unsigned short iInst) override;
+
+};
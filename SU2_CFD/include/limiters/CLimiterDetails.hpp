@@ -26,6 +26,8 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 
 /*!
  * \brief A traits class for limiters, see notes for "computeLimiters_impl()".
@@ -82,6 +84,23 @@ namespace LimiterHelpers
 }
 
 
+/*!
+ * \brief No limiter specialization (a limiter of 1), used by the fused computation of
+ *        gradients, limiters, and reconstructed states (see computeGradientsAndLimiters.hpp).
+ */
+template<>
+struct CLimiterDetails<NO_LIMITER>
+{
+  template<class... Ts>
+  inline void preprocess(Ts&...) {}
+
+  template<class... Ts>
+  inline su2double geometricFactor(Ts&...) const {return 1.0;}
+
+  inline su2double limiterFunction(size_t, su2double, su2double) const {return 1.0;}
+};
+
+
 /*!
  * \brief Barth-Jespersen specialization.
  */
@@ -0,0 +1,472 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Fused computation of gradients, limiters, and MUSCL reconstructed states.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CLimiterDetails.hpp"
+#include "../gradients/computeGradientsLeastSquares.hpp"
+
+
+/*!
+ * \brief Compute the gradients of a field, its limiters, and the MUSCL reconstructed states,
+ *        with one sweep over the neighbors of each point instead of three or four separate passes.
+ * \note The neighbor values are read once to accumulate the gradient (Green-Gauss or least-squares)
+ *       and the min/max over the neighbors. With least-squares the gradient of a point is complete
+ *       after its neighbors, and the limiter and states are finalized in the same sweep. Green-Gauss
+ *       needs the boundary fluxes first, so the finalization is a second (cheaper) point loop that
+ *       only reads coordinates. The results are the same as computeGradientsGreenGauss or
+ *       computeGradientsLeastSquares followed by computeLimiters_impl, and the reconstruction of
+ *       CEulerSolver::MUSCLReconstruction. There is no AD pre-accumulation and no periodic support,
+ *       the caller must use the separate functions in those cases (see CEulerSolver::FusedReconstruction).
+ *
+ * Arguments:
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindGradientComm - Type of MPI communication for the gradients.
+ * \param[in] kindLimiterComm - Type of MPI communication for the limiters.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] varBegin - First variable index for which to compute gradients and limiters.
+ * \param[in] varEnd - End of computation range (nVar = end-begin).
+ * \param[in] field - Variable field.
+ * \param[out] gradient - Gradient of the field.
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMax - As above but maximum values.
+ * \param[out] limiter - Reconstruction limiter for the field (not set for NO_LIMITER).
+ * \param[out] states - Reconstructed states at the mid-point of the edges, for each pair (point, neighbor)
+ *             of the domain points (generic object with operator[] returning a pointer per pair).
+ * \param[in] limiterComm - If false the limiters at halo points are not exchanged (see computeLimiters_impl).
+ *
+ * Template parameters:
+ * \param FieldType - Generic object with operator (iPoint,iVar)
+ * \param GradientType - Generic object with operator (iPoint,iVar,iDim)
+ * \param StatesType - Generic object with operator [] (iPair)
+ * \param LimiterKind - Used to instantiate the right details class.
+ */
+template<class FieldType, class GradientType, class StatesType, ENUM_LIMITER LimiterKind>
+void computeGradientsAndLimiters_impl(CSolver* solver,
+                                      MPI_QUANTITIES kindGradientComm,
+                                      MPI_QUANTITIES kindLimiterComm,
+                                      CGeometry& geometry,
+                                      CConfig& config,
+                                      unsigned short kindGradient,
+                                      size_t varBegin,
+                                      size_t varEnd,
+                                      const FieldType& field,
+                                      GradientType& gradient,
+                                      FieldType& fieldMin,
+                                      FieldType& fieldMax,
+                                      FieldType& limiter,
+                                      StatesType& states,
+                                      bool limiterComm)
+{
+  constexpr size_t MAXNDIM = 3;
+  constexpr size_t MAXNVAR = 8;
+  constexpr bool limit = (LimiterKind != NO_LIMITER);
+
+  if (varEnd > MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  size_t nPointDomain = geometry.GetnPointDomain();
+  size_t nDim = geometry.GetnDim();
+
+  const bool greenGauss = (kindGradient == GREEN_GAUSS);
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+  const bool cachedWeights = !greenGauss && config.GetLeastSquares_Cache();
+
+  const auto& dualGrid = geometry.GetDualGridSoA();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                     omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  double tick = 0.0;
+  SU2_OMP_MASTER
+  config.Tick(&tick);
+
+  if (cachedWeights) {
+    /*--- See computeGradientsLeastSquares. ---*/
+    const bool buildCache = !dualGrid.HasLeastSquaresWeights(weighted);
+    SU2_OMP_BARRIER
+
+    if (buildCache)
+      LeastSquaresHelpers::computeWeights(geometry, weighted);
+  }
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  /*--- Limiter and reconstructed states of a point whose gradient is complete. ---*/
+
+  auto finalizePoint = [&](size_t iPoint)
+  {
+    const su2double* coord_i = dualGrid.GetCoord(iPoint);
+    const auto neighbors = dualGrid.GetNeighbors(iPoint);
+    const size_t nNeigh = dualGrid.GetnNeighbor(iPoint);
+    const size_t firstPair = dualGrid.GetNeighborPattern().outerPtr()[iPoint];
+
+    su2double lim[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      lim[iVar] = 1.0;
+
+    if (limit)
+    {
+      /*--- Max/min projection of the gradient out of iPoint. ---*/
+
+      su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        projMax[iVar] = projMin[iVar] = 0.0;
+
+      for (size_t iNeigh = 0; iNeigh < nNeigh; ++iNeigh)
+      {
+        const su2double* coord_j = dualGrid.GetCoord(neighbors[iNeigh]);
+
+        su2double dist_ij[MAXNDIM] = {0.0};
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          su2double proj = 0.0;
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+          projMax[iVar] = max(projMax[iVar], proj);
+          projMin[iVar] = min(projMin[iVar], proj);
+        }
+      }
+
+      su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                           fieldMax(iPoint,iVar) - field(iPoint,iVar));
+
+        su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                           fieldMin(iPoint,iVar) - field(iPoint,iVar));
+
+        lim[iVar] = limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+      }
+    }
+
+    /*--- Reconstructed states at the mid-point of each edge. ---*/
+
+    for (size_t iNeigh = 0; iNeigh < nNeigh; ++iNeigh)
+    {
+      const su2double* coord_j = dualGrid.GetCoord(neighbors[iNeigh]);
+      auto state = states[firstPair+iNeigh];
+
+      su2double dist_ij[MAXNDIM] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double proj = 0.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+        if (limit) state[iVar] = field(iPoint,iVar) + lim[iVar]*proj;
+        else state[iVar] = field(iPoint,iVar) + proj;
+      }
+    }
+  };
+
+  /*--- Main sweep, gradient (complete for least-squares) and min/max over the neighbors. ---*/
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const su2double* coord_i = dualGrid.GetCoord(iPoint);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      if (limit) fieldMax(iPoint,iVar) = fieldMin(iPoint,iVar) = field(iPoint,iVar);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint,iVar,iDim) = 0.0;
+    }
+
+    su2double halfOnVol = 0.0;
+    if (greenGauss) halfOnVol = 0.5 / dualGrid.GetVolume(iPoint);
+
+    su2double r11 = 0.0, r12 = 0.0, r22 = 0.0, r13 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+
+    const auto neighbors = dualGrid.GetNeighbors(iPoint);
+    const auto edges = dualGrid.GetNeighborEdges(iPoint);
+
+    for (size_t iNeigh = 0; iNeigh < dualGrid.GetnNeighbor(iPoint); ++iNeigh)
+    {
+      size_t jPoint = neighbors[iNeigh];
+
+      if (limit)
+      {
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
+          fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+        }
+      }
+
+      if (greenGauss)
+      {
+        /*--- See computeGradientsGreenGauss. ---*/
+
+        size_t iEdge = edges[iNeigh];
+        su2double dir = (iPoint == dualGrid.GetNode(iEdge,0))? 1.0 : -1.0;
+        su2double weight = dir * halfOnVol;
+
+        const su2double* area = dualGrid.GetNormal(iEdge);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint,iVar,iDim) += flux * area[iDim];
+        }
+      }
+      else if (cachedWeights)
+      {
+        const su2double* weights = dualGrid.GetLeastSquaresWeights(weighted, iPoint, iNeigh);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          su2double delta_ij = field(jPoint,iVar) - field(iPoint,iVar);
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint,iVar,iDim) += weights[iDim] * delta_ij;
+        }
+      }
+      else
+      {
+        /*--- See computeGradientsLeastSquares, the R matrix is not stored. ---*/
+
+        const su2double* coord_j = dualGrid.GetCoord(jPoint);
+
+        su2double dist_ij[MAXNDIM] = {0.0};
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = coord_j[iDim] - coord_i[iDim];
+
+        su2double weight = 1.0;
+
+        if (weighted)
+        {
+          weight = 0.0;
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            weight += dist_ij[iDim] * dist_ij[iDim];
+        }
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
+
+          r11 += dist_ij[0]*dist_ij[0]*weight;
+          r12 += dist_ij[0]*dist_ij[1]*weight;
+          r22 += dist_ij[1]*dist_ij[1]*weight;
+
+          if (nDim == 3)
+          {
+            r13   += dist_ij[0]*dist_ij[2]*weight;
+            r23_a += dist_ij[1]*dist_ij[2]*weight;
+            r23_b += dist_ij[0]*dist_ij[2]*weight;
+            r33   += dist_ij[2]*dist_ij[2]*weight;
+          }
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint,iVar,iDim) += dist_ij[iDim] * delta_ij;
+          }
+        }
+      }
+    }
+
+    if (greenGauss) continue;
+
+    if (!cachedWeights)
+    {
+      su2double Smatrix[MAXNDIM][MAXNDIM];
+
+      LeastSquaresHelpers::computeSmatrix(nDim, r11, r12, r22, r13, r23_a, r23_b, r33, Smatrix);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double Cvector[MAXNDIM];
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+        {
+          Cvector[iDim] = 0.0;
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            Cvector[iDim] += Smatrix[iDim][jDim] * gradient(iPoint,iVar,jDim);
+        }
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          gradient(iPoint,iVar,iDim) = Cvector[iDim];
+      }
+    }
+
+    finalizePoint(iPoint);
+  }
+
+  if (greenGauss)
+  {
+    /*--- Boundary fluxes, see computeGradientsGreenGauss. ---*/
+
+    for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+    {
+      if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+          (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))
+      {
+        SU2_OMP_FOR_STAT(32)
+        for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
+        {
+          size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
+
+          if (!geometry.node[iPoint]->GetDomain()) continue;
+
+          su2double volume = dualGrid.GetVolume(iPoint);
+
+          const su2double* area = geometry.vertex[iMarker][iVertex]->GetNormal();
+
+          for (size_t iVar = varBegin; iVar < varEnd; iVar++)
+          {
+            su2double flux = field(iPoint,iVar) / volume;
+
+            for (size_t iDim = 0; iDim < nDim; iDim++)
+              gradient(iPoint,iVar,iDim) -= flux * area[iDim];
+          }
+        }
+      }
+    }
+
+    SU2_OMP_FOR_DYN(chunkSize)
+    for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+      finalizePoint(iPoint);
+  }
+
+  /*--- If no solver was provided we do not communicate. ---*/
+
+  SU2_OMP_MASTER
+  if (solver != nullptr)
+  {
+    solver->InitiateComms(&geometry, &config, kindGradientComm);
+    solver->CompleteComms(&geometry, &config, kindGradientComm);
+
+    if (limit && limiterComm) {
+      solver->InitiateComms(&geometry, &config, kindLimiterComm);
+      solver->CompleteComms(&geometry, &config, kindLimiterComm);
+    }
+  }
+  SU2_OMP_BARRIER
+
+  SU2_OMP_MASTER
+  config.Tock(tick, "computeGradientsAndLimiters", 2);
+
+}
+
+
+/*!
+ * \brief A wrapper function that calls the specialized implementations depending on "LimiterKind",
+ *        see computeLimiters and computeGradientsAndLimiters_impl.
+ */
+template<class FieldType, class GradientType, class StatesType>
+void computeGradientsAndLimiters(ENUM_LIMITER LimiterKind,
+                                 CSolver* solver,
+                                 MPI_QUANTITIES kindGradientComm,
+                                 MPI_QUANTITIES kindLimiterComm,
+                                 CGeometry& geometry,
+                                 CConfig& config,
+                                 unsigned short kindGradient,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 FieldType& fieldMin,
+                                 FieldType& fieldMax,
+                                 FieldType& limiter,
+                                 StatesType& states,
+                                 bool limiterComm = true)
+{
+#define INSTANTIATE(KIND) \
+computeGradientsAndLimiters_impl<FieldType, GradientType, StatesType, KIND>(solver, \
+  kindGradientComm, kindLimiterComm, geometry, config, kindGradient, varBegin, varEnd, \
+  field, gradient, fieldMin, fieldMax, limiter, states, limiterComm)
+
+  switch (LimiterKind) {
+    case NO_LIMITER:
+    {
+      INSTANTIATE(NO_LIMITER);
+      break;
+    }
+    case BARTH_JESPERSEN:
+    {
+      INSTANTIATE(BARTH_JESPERSEN);
+      break;
+    }
+    case VENKATAKRISHNAN:
+    {
+      INSTANTIATE(VENKATAKRISHNAN);
+      break;
+    }
+    case VENKATAKRISHNAN_WANG:
+    {
+      INSTANTIATE(VENKATAKRISHNAN_WANG);
+      break;
+    }
+    case WALL_DISTANCE:
+    {
+      INSTANTIATE(WALL_DISTANCE);
+      break;
+    }
+    case SHARP_EDGES:
+    {
+      INSTANTIATE(SHARP_EDGES);
+      break;
+    }
+    default:
+    {
+      SU2_MPI::Error("Unknown limiter type.", CURRENT_FUNCTION);
+      break;
+    }
+  }
+#undef INSTANTIATE
+}
@@ -48,12 +48,13 @@ void computeLimiters(ENUM_LIMITER LimiterKind,
                      const GradientType& gradient,
                      FieldType& fieldMin,
                      FieldType& fieldMax,
-                     FieldType& limiter)
+                     FieldType& limiter,
+                     bool mpiComm = true)
 {
 #define INSTANTIATE(KIND) \
 computeLimiters_impl<FieldType, GradientType, KIND>(solver, kindMpiComm, \
   kindPeriodicComm1, kindPeriodicComm2, geometry, config, varBegin, \
-  varEnd, field, gradient, fieldMin, fieldMax, limiter)
+  varEnd, field, gradient, fieldMin, fieldMax, limiter, mpiComm)
 
   switch (LimiterKind) {
     case NO_LIMITER:
@@ -53,6 +53,8 @@
  * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
+ * \param[in] mpiComm - If false the limiters at halo points are not exchanged, the caller
+ *            is responsible for it (e.g. to overlap the exchange with computation).
  *
  * Template parameters:
  * \param FieldType - Generic object with operator (iPoint,iVar)
@@ -72,7 +74,8 @@ void computeLimiters_impl(CSolver* solver,
                           const GradientType& gradient,
                           FieldType& fieldMin,
                           FieldType& fieldMax,
-                          FieldType& limiter)
+                          FieldType& limiter,
+                          bool mpiComm)
 {
   constexpr size_t MAXNDIM = 3;
   constexpr size_t MAXNVAR = 8;
@@ -84,6 +87,8 @@ void computeLimiters_impl(CSolver* solver,
   size_t nPoint = geometry.GetnPoint();
   size_t nDim = geometry.GetnDim();
 
+  const auto& dualGrid = geometry.GetDualGridSoA();
+
   /*--- If we do not have periodicity we can use a
    *    more efficient access pattern to memory. ---*/
 
@@ -138,8 +143,7 @@ void computeLimiters_impl(CSolver* solver,
   SU2_OMP_FOR_DYN(chunkSize)
   for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
   {
-    auto node = geometry.node[iPoint];
-    const su2double* coord_i = node->GetCoord();
+    const su2double* coord_i = dualGrid.GetCoord(iPoint);
 
     AD::StartPreacc();
     AD::SetPreaccIn(coord_i, nDim);
@@ -172,11 +176,13 @@ void computeLimiters_impl(CSolver* solver,
 
     /*--- Compute max/min projection and values over direct neighbors. ---*/
 
-    for(size_t iNeigh = 0; iNeigh < node->GetnPoint(); ++iNeigh)
+    const auto neighbors = dualGrid.GetNeighbors(iPoint);
+
+    for(size_t iNeigh = 0; iNeigh < dualGrid.GetnNeighbor(iPoint); ++iNeigh)
     {
-      size_t jPoint = node->GetPoint(iNeigh);
+      size_t jPoint = neighbors[iNeigh];
 
-      const su2double* coord_j = geometry.node[jPoint]->GetCoord();
+      const su2double* coord_j = dualGrid.GetCoord(jPoint);
       AD::SetPreaccIn(coord_j, nDim);
 
       /*--- Distance vector from iPoint to face (middle of the edge). ---*/
@@ -243,8 +249,10 @@ void computeLimiters_impl(CSolver* solver,
 
     /*--- Obtain the limiters at halo points from the MPI ranks that own them. ---*/
 
-    solver->InitiateComms(&geometry, &config, kindMpiComm);
-    solver->CompleteComms(&geometry, &config, kindMpiComm);
+    if (mpiComm) {
+      solver->InitiateComms(&geometry, &config, kindMpiComm);
+      solver->CompleteComms(&geometry, &config, kindMpiComm);
+    }
   }
   SU2_OMP_BARRIER
 
@@ -0,0 +1,127 @@
+/*!
+ * \file CEdgeBatch.hpp
+ * \brief Structure-of-arrays container used to compute the convective
+ *        fluxes of several edges with one call to the numerics classes.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/datatype_structure.hpp"
+#include "../../../Common/include/omp_structure.hpp"
+
+/*!
+ * \brief Number of edges in a batch, can be set at compile time (e.g. -DSU2_EDGE_BATCH_WIDTH=4)
+ *        to match the vector length of the target architecture (4 for AVX2, 8 for AVX-512).
+ */
+#ifndef SU2_EDGE_BATCH_WIDTH
+#define SU2_EDGE_BATCH_WIDTH 8
+#endif
+
+/*!
+ * \class CEdgeBatch
+ * \brief Inputs and outputs of the convective flux computation for a group of edges.
+ * \note Each quantity is stored "lane-last", i.e. Normal[iDim][iLane], such that the
+ *       batched kernels loop over lanes in the innermost (vectorizable) loop.
+ *       Only the quantities needed by the compressible ideal-gas upwind schemes are
+ *       stored, the primitives are T, velocity, p, rho, h (nDim+4 values).
+ *       Lanes beyond nLane are padded with a copy of the first lane such that the
+ *       kernels can always operate on the full WIDTH without producing NaNs.
+ */
+struct CEdgeBatch {
+  enum : size_t {WIDTH = SU2_EDGE_BATCH_WIDTH}; /*!< \brief Number of lanes (edges) of the batch. */
+  enum : size_t {MAXNDIM = 3};                  /*!< \brief Max number of space dimensions. */
+  enum : size_t {MAXNPRIM = MAXNDIM+4};         /*!< \brief Max number of primitive variables. */
+  enum : size_t {MAXNVAR = MAXNDIM+2};          /*!< \brief Max number of conservative variables. */
+
+  static_assert(WIDTH > 0, "The edge batch width must be positive.");
+
+  using Scalar = su2double[WIDTH];             /*!< \brief One value per lane. */
+  using Vector = Scalar[MAXNDIM];              /*!< \brief Spatial vector per lane. */
+  using Matrix = Scalar[MAXNVAR][MAXNVAR];     /*!< \brief Flux Jacobian per lane. */
+
+  unsigned short nLane = 0;       /*!< \brief Number of valid lanes. */
+  unsigned long iEdge[WIDTH];     /*!< \brief Edge of each lane. */
+  unsigned long iPoint[WIDTH];    /*!< \brief First point of each edge. */
+  unsigned long jPoint[WIDTH];    /*!< \brief Second point of each edge. */
+
+  Vector Normal;          /*!< \brief Dual face normals. */
+  Scalar V_i[MAXNPRIM];   /*!< \brief (Reconstructed) primitives at point i. */
+  Scalar V_j[MAXNPRIM];   /*!< \brief (Reconstructed) primitives at point j. */
+
+  Scalar Flux[MAXNVAR];   /*!< \brief Fluxes across the faces. */
+  Matrix Jacobian_i;      /*!< \brief Flux Jacobians w.r.t. the conservatives at i. */
+  Matrix Jacobian_j;      /*!< \brief Flux Jacobians w.r.t. the conservatives at j. */
+
+  /*!
+   * \brief Copy the inputs of the first lane to the unused lanes.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] nPrim - Number of primitive variables.
+   */
+  inline void PadLanes(unsigned short nDim, unsigned short nPrim) {
+    for (auto iLane = nLane; iLane < WIDTH; ++iLane) {
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+        Normal[iDim][iLane] = Normal[iDim][0];
+      for (unsigned short iVar = 0; iVar < nPrim; ++iVar) {
+        V_i[iVar][iLane] = V_i[iVar][0];
+        V_j[iVar][iLane] = V_j[iVar][0];
+      }
+    }
+  }
+
+  /*!
+   * \brief Set the flux and Jacobians of one lane to zero.
+   * \param[in] iLane - Lane index.
+   * \param[in] nVar - Number of variables.
+   */
+  inline void ClearLane(unsigned short iLane, unsigned short nVar) {
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      Flux[iVar][iLane] = 0.0;
+      for (unsigned short jVar = 0; jVar < nVar; ++jVar) {
+        Jacobian_i[iVar][jVar][iLane] = 0.0;
+        Jacobian_j[iVar][jVar][iLane] = 0.0;
+      }
+    }
+  }
+
+  /*!
+   * \brief Copy the flux and Jacobians of one lane into (array of structures) arrays.
+   * \param[in] iLane - Lane index.
+   * \param[in] nVar - Number of variables.
+   * \param[out] flux - Flux vector.
+   * \param[out] jac_i - Jacobian w.r.t. i, not accessed if null.
+   * \param[out] jac_j - Jacobian w.r.t. j, not accessed if null.
+   */
+  inline void GetLane(unsigned short iLane, unsigned short nVar, su2double* flux,
+                      su2double** jac_i, su2double** jac_j) const {
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      flux[iVar] = Flux[iVar][iLane];
+      if (jac_i == nullptr) continue;
+      for (unsigned short jVar = 0; jVar < nVar; ++jVar) {
+        jac_i[iVar][jVar] = Jacobian_i[iVar][jVar][iLane];
+        jac_j[iVar][jVar] = Jacobian_j[iVar][jVar][iLane];
+      }
+    }
+  }
+};
@@ -34,6 +34,7 @@
 #include <cstdlib>
 
 #include "../../../Common/include/CConfig.hpp"
+#include "CEdgeBatch.hpp"
 
 using namespace std;
 
@@ -179,14 +180,15 @@ protected:
   *AuxVar_Grad_i,    /*!< \brief Gradient of an auxiliary variable at point i. */
   *AuxVar_Grad_j;    /*!< \brief Gradient of an auxiliary variable at point i. */
   const su2double *RadVar_Source;  /*!< \brief Source term from the radiative heat transfer equation. */
-  su2double
+  const su2double
   *Coord_i,      /*!< \brief Cartesians coordinates of point i. */
   *Coord_j;      /*!< \brief Cartesians coordinates of point j. */
   unsigned short
   Neighbor_i,  /*!< \brief Number of neighbors of the point i. */
   Neighbor_j;  /*!< \brief Number of neighbors of the point j. */
+  const su2double
+  *Normal;       /*!< \brief Normal vector, its norm is the area of the face. */
   su2double
-  *Normal,       /*!< \brief Normal vector, its norm is the area of the face. */
   *UnitNormal,   /*!< \brief Unitary normal vector. */
   *UnitNormald;  /*!< \brief Derivative of unitary normal vector. */
   su2double
@@ -561,7 +563,7 @@ public:
    * \param[in] val_coord_i - Coordinates of the point i.
    * \param[in] val_coord_j - Coordinates of the point j.
    */
-  inline void SetCoord(su2double *val_coord_i, su2double *val_coord_j) {
+  inline void SetCoord(const su2double *val_coord_i, const su2double *val_coord_j) {
     Coord_i = val_coord_i;
     Coord_j = val_coord_j;
   }
@@ -700,7 +702,7 @@ public:
    * \brief Set the value of the normal vector to the face between two points.
    * \param[in] val_normal - Normal vector, the norm of the vector is the area of the face.
    */
-  inline void SetNormal(su2double *val_normal) { Normal = val_normal; }
+  inline void SetNormal(const su2double *val_normal) { Normal = val_normal; }
 
   /*!
    * \brief Set the value of the volume of the control volume.
@@ -743,7 +745,7 @@ public:
    */
   void GetInviscidProjFlux(su2double *val_density, su2double *val_velocity,
                            su2double *val_pressure, su2double *val_enthalpy,
-                           su2double *val_normal, su2double *val_Proj_Flux);
+                           const su2double *val_normal, su2double *val_Proj_Flux);
 
   /*!
    * \brief Compute the projected inviscid flux vector for incompresible simulations
@@ -757,7 +759,7 @@ public:
   void GetInviscidIncProjFlux(su2double *val_density, su2double *val_velocity,
                                   su2double *val_pressure, su2double *val_betainc2,
                                   su2double *val_enthalpy,
-                                  su2double *val_normal, su2double *val_Proj_Flux);
+                                  const su2double *val_normal, su2double *val_Proj_Flux);
 
   /*!
    * \brief Compute the projection of the inviscid Jacobian matrices.
@@ -768,9 +770,71 @@ public:
    * \param[out] val_Proj_Jac_tensor - Pointer to the projected inviscid Jacobian.
    */
   void GetInviscidProjJac(su2double *val_velocity, su2double *val_energy,
-                          su2double *val_normal, su2double val_scale,
+                          const su2double *val_normal, su2double val_scale,
                           su2double **val_Proj_Jac_tensor);
 
+  /*!
+   * \brief Compute the projected inviscid flux for all the lanes of an edge batch.
+   * \param[in] density - Density.
+   * \param[in] velocity - Velocity.
+   * \param[in] pressure - Pressure.
+   * \param[in] enthalpy - Total enthalpy.
+   * \param[in] normal - Normal vector, the norm of the vector is the area of the face.
+   * \param[in] scale - Scale of the projection.
+   * \param[out] flux - Projected flux (the scaled flux is added to it).
+   */
+  void GetInviscidProjFluxBatch(const CEdgeBatch::Scalar& density, const CEdgeBatch::Vector& velocity,
+                                const CEdgeBatch::Scalar& pressure, const CEdgeBatch::Scalar& enthalpy,
+                                const CEdgeBatch::Vector& normal, su2double scale,
+                                CEdgeBatch::Scalar* flux) const;
+
+  /*!
+   * \brief Compute the projected inviscid Jacobian for all the lanes of an edge batch.
+   * \param[in] velocity - Velocity.
+   * \param[in] energy - Total energy.
+   * \param[in] normal - Normal vector, the norm of the vector is the area of the face.
+   * \param[in] scale - Scale of the projection.
+   * \param[out] jacobian - Projected Jacobian.
+   */
+  void GetInviscidProjJacBatch(const CEdgeBatch::Vector& velocity, const CEdgeBatch::Scalar& energy,
+                               const CEdgeBatch::Vector& normal, su2double scale,
+                               CEdgeBatch::Matrix& jacobian) const;
+
+  /*!
+   * \brief Apply the Roe dissipation matrix, |A| = P x |Lambda| x inverse P, to an increment of the
+   *        conservative variables, for all the lanes of an edge batch.
+   * \note The eigen-decomposition is applied in closed form (wave strengths), which avoids forming P and
+   *       its inverse. The convective eigenvalue is the same for the nDim "entropy/shear" waves.
+   * \param[in] density - Roe-averaged density.
+   * \param[in] velocity - Roe-averaged velocity.
+   * \param[in] enthalpy - Roe-averaged total enthalpy.
+   * \param[in] soundSpeed - Roe-averaged speed of sound.
+   * \param[in] unitNormal - Unit normal vector.
+   * \param[in] lambda - Absolute value of the convective, u+c, and u-c eigenvalues.
+   * \param[in] delta - Increment of the conservative variables.
+   * \param[out] result - |A| x delta.
+   */
+  void GetRoeDissipationBatch(const CEdgeBatch::Scalar& density, const CEdgeBatch::Vector& velocity,
+                              const CEdgeBatch::Scalar& enthalpy, const CEdgeBatch::Scalar& soundSpeed,
+                              const CEdgeBatch::Vector& unitNormal, const CEdgeBatch::Scalar* lambda,
+                              const CEdgeBatch::Scalar* delta, CEdgeBatch::Scalar* result) const;
+
+  /*!
+   * \brief Add scale x |A| (see GetRoeDissipationBatch) to Jacobian i and subtract it from Jacobian j.
+   * \param[in] density - Roe-averaged density.
+   * \param[in] velocity - Roe-averaged velocity.
+   * \param[in] enthalpy - Roe-averaged total enthalpy.
+   * \param[in] soundSpeed - Roe-averaged speed of sound.
+   * \param[in] unitNormal - Unit normal vector.
+   * \param[in] lambda - Absolute value of the convective, u+c, and u-c eigenvalues.
+   * \param[in] scale - Scale of the dissipation matrix (e.g. area).
+   * \param[in,out] batch - Edge batch whose Jacobians are updated.
+   */
+  void AddRoeDissipationJacBatch(const CEdgeBatch::Scalar& density, const CEdgeBatch::Vector& velocity,
+                                 const CEdgeBatch::Scalar& enthalpy, const CEdgeBatch::Scalar& soundSpeed,
+                                 const CEdgeBatch::Vector& unitNormal, const CEdgeBatch::Scalar* lambda,
+                                 const CEdgeBatch::Scalar& scale, CEdgeBatch& batch) const;
+
   /*!
    * \brief Compute the projection of the inviscid Jacobian matrices (incompressible).
    * \param[in] val_density - Value of the density.
@@ -781,7 +845,7 @@ public:
    * \param[out] val_Proj_Jac_tensor - Pointer to the projected inviscid Jacobian.
    */
   void GetInviscidIncProjJac(su2double *val_density, su2double *val_velocity,
-                             su2double *val_betainc2, su2double *val_normal,
+                             su2double *val_betainc2, const su2double *val_normal,
                              su2double val_scale,
                              su2double **val_Proj_Jac_tensor);
 
@@ -803,7 +867,7 @@ public:
                              su2double *val_cp,
                              su2double *val_temperature,
                              su2double *val_dRhodT,
-                             su2double *val_normal,
+                             const su2double *val_normal,
                              su2double val_scale,
                              su2double **val_Proj_Jac_Tensor);
 
@@ -836,7 +900,7 @@ public:
   void GetPreconditionedProjJac(su2double *val_density,
                                 su2double *val_velocity,
                                 su2double *val_betainc2,
-                                su2double *val_normal,
+                                const su2double *val_normal,
                                 su2double **val_Proj_Jac_Tensor);
 
   /*!
@@ -849,7 +913,7 @@ public:
    */
   void GetInviscidProjJac(su2double *val_velocity, su2double *val_enthalphy,
                           su2double *val_chi, su2double *val_kappa,
-                          su2double *val_normal, su2double val_scale,
+                          const su2double *val_normal, su2double val_scale,
                           su2double **val_Proj_Jac_tensor);
 
   /*!
@@ -877,7 +941,7 @@ public:
   void GetPMatrix(su2double *val_density, su2double *val_velocity,
                   su2double *val_soundspeed, su2double *val_enthalpy,
                   su2double *val_chi, su2double *val_kappa,
-                  su2double *val_normal, su2double **val_p_tensor);
+                  const su2double *val_normal, su2double **val_p_tensor);
 
   /*!
    * \brief Computation of the matrix P, this matrix diagonalize the conservative Jacobians in
@@ -889,7 +953,7 @@ public:
    * \param[out] val_p_tensor - Pointer to the P matrix.
    */
   void GetPMatrix(su2double *val_density, su2double *val_velocity,
-                  su2double *val_soundspeed, su2double *val_normal,
+                  su2double *val_soundspeed, const su2double *val_normal,
                   su2double **val_p_tensor);
 
   /*!
@@ -978,7 +1042,7 @@ public:
    * \param[out] val_absPeJac - Pointer to the Preconditioned Jacobian matrix.
    */
   void GetPrecondJacobian(su2double Beta2, su2double r_hat, su2double s_hat, su2double t_hat,
-                          su2double rB2a2, su2double* val_Lambda, su2double* val_normal, su2double** val_absPeJac);
+                          su2double rB2a2, su2double* val_Lambda, const su2double* val_normal, su2double** val_absPeJac);
 
   /*!
    * \brief Computation of the matrix P^{-1}, this matrix diagonalize the conservative Jacobians
@@ -992,7 +1056,7 @@ public:
   void GetPMatrix_inv(su2double **val_invp_tensor, su2double *val_density,
                       su2double *val_velocity, su2double *val_soundspeed,
                       su2double *val_chi, su2double *val_kappa,
-                      su2double *val_normal);
+                      const su2double *val_normal);
 
   /*!
    * \brief Computation of the matrix P^{-1}, this matrix diagonalize the conservative Jacobians
@@ -1004,7 +1068,7 @@ public:
    * \param[out] val_invp_tensor - Pointer to inverse of the P matrix.
    */
   void GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
-                      su2double *val_soundspeed, su2double *val_normal,
+                      su2double *val_soundspeed, const su2double *val_normal,
                       su2double **val_invp_tensor);
 
   /*!
@@ -1014,7 +1078,7 @@ public:
                              su2double ViscDens_i, su2double ViscDens_j, su2double *Velocity_i, su2double *Velocity_j,
                              su2double sq_vel_i, su2double sq_vel_j,
                              su2double XiDens_i, su2double XiDens_j, su2double **Mean_GradPhi, su2double *Mean_GradPsiE,
-                             su2double dPhiE_dn, su2double *Normal, su2double *Edge_Vector, su2double dist_ij_2, su2double *val_residual_i,
+                             su2double dPhiE_dn, const su2double *Normal, su2double *Edge_Vector, su2double dist_ij_2, su2double *val_residual_i,
                              su2double *val_residual_j,
                              su2double **val_Jacobian_ii, su2double **val_Jacobian_ij, su2double **val_Jacobian_ji,
                              su2double **val_Jacobian_jj, bool implicit);
@@ -1027,7 +1091,7 @@ public:
    * \param[in] val_Lambda_Vector - Pointer to Lambda matrix.
    */
   void GetJacInviscidLambda_fabs(su2double *val_velocity, su2double val_soundspeed,
-                                 su2double *val_normal, su2double *val_Lambda_Vector);
+                                 const su2double *val_normal, su2double *val_Lambda_Vector);
 
   /*!
    * \brief Compute the numerical residual.
@@ -1053,6 +1117,18 @@ public:
    */
   inline virtual ResidualType<> ComputeResidual(const CConfig* config) { return ResidualType<>(nullptr,nullptr,nullptr); }
 
+  /*!
+   * \brief Compute the fluxes and Jacobians of all the edges of a batch.
+   * \note The default implementation calls the scalar ComputeResidual for each lane, classes
+   *       that implement a vectorized kernel override this method. The inputs (normals and
+   *       primitives) are read from the batch, the secondaries are those of the ideal gas, any
+   *       other input must be set beforehand. The normal, primitive, and secondary pointers
+   *       are the same on exit as on entry.
+   * \param[in,out] batch - Inputs and outputs of the edges.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config);
+
   /*!
    * \overload
    * \param[out] val_residual_i - Pointer to the total residual at point i.
@@ -1168,6 +1244,15 @@ public:
    */
   inline virtual void Compute_NodalStress_Term(CElement *element_container, const CConfig* config) { }
 
+  /*!
+   * \brief A virtual member to compute the product of the stiffness matrix of an element by a vector
+   *        in linear structural problems, without forming the matrix (matrix-free methods).
+   * \param[in,out] element_container - Definition of the particular element integrated, the result is its nodal stress term.
+   * \param[in] nodalVector - Vector at the nodes of the element (nNode x nDim, row major).
+   */
+  inline virtual void Compute_Stiffness_Product(CElement *element_container, const su2double *nodalVector,
+                                                const CConfig* config) { }
+
   /*!
    * \brief Set the element-based local Young's modulus in mesh problems
    * \param[in] iElem - Element index.
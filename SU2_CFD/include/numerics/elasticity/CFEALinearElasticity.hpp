@@ -67,6 +67,16 @@ public:
    */
   void Compute_Tangent_Matrix(CElement *element_container, const CConfig *config) final;
 
+  /*!
+   * \brief Compute the product of the stiffness matrix of an element by a vector, as the integral
+   *        of B^T*D*B*v over the element, i.e. the nNode^2 blocks of the matrix are not formed.
+   * \param[in,out] element_container - The finite element, the product is stored as the nodal stress term.
+   * \param[in] nodalVector - Vector at the nodes of the element (nNode x nDim, row major).
+   * \param[in] config - Definition of the problem.
+   */
+  void Compute_Stiffness_Product(CElement *element_container, const su2double *nodalVector,
+                                 const CConfig *config) final;
+
   /*!
    * \brief Compute averaged nodal stresses (for post processing).
    * \param[in,out] element_container - The finite element.
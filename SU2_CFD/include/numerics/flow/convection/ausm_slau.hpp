@@ -259,4 +259,11 @@ public:
    */
   ResidualType<> ComputeResidual(const CConfig* config) override;
 
+  /*!
+   * \brief Compute the AUSM fluxes (and Jacobians) of a batch of edges with vectorized code.
+   * \param[in,out] batch - Inputs and outputs of the edges.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) override;
+
 };
@@ -79,6 +79,15 @@ public:
    */
   ResidualType<> ComputeResidual(const CConfig* config) override;
 
+  /*!
+   * \brief Compute the HLLC fluxes of a batch of edges with vectorized code.
+   * \note Only the explicit flux is vectorized, the exact Jacobians (implicit) and
+   *       dynamic grids fall back to the scalar implementation.
+   * \param[in,out] batch - Inputs and outputs of the edges.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) override;
+
 };
 
 /*!
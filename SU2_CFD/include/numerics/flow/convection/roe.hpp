@@ -112,6 +112,14 @@ public:
    */
   CUpwRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config, bool val_low_dissipation);
 
+  /*!
+   * \brief Compute the Roe fluxes (and Jacobians) of a batch of edges with vectorized code.
+   * \note Falls back to the scalar implementation for low dissipation and dynamic grids.
+   * \param[in,out] batch - Inputs and outputs of the edges.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) override;
+
 };
 
 /*!
@@ -89,6 +89,14 @@ public:
    */
   void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint) override;
 
+  /*!
+   * \brief Register the volume output fields copied directly from the solvers (solution and residuals).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   */
+  void SetVolumeOutputColumns(CConfig *config, CGeometry *geometry, CSolver **solver) override;
+
   /*!
    * \brief Set the available history output fields
    * \param[in] config - Definition of the particular problem.
@@ -35,6 +35,7 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <initializer_list>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
@@ -44,6 +45,7 @@ class CGeometry;
 class CSolver;
 class CFileWriter;
 class CParallelDataSorter;
+class CAsyncFileWriter;
 class CConfig;
 
 using namespace std;
@@ -56,6 +58,8 @@ using namespace std;
 class COutput {
 protected:
 
+  enum : size_t {OMP_MAX_SIZE = 512};  /*!< \brief Max chunk size for the point loops. */
+
   /*----------------------------- General ----------------------------*/
 
   int rank,     /*!< \brief MPI Rank. */
@@ -161,8 +165,15 @@ protected:
    CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
    CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+   bool asyncOutput;                         //!< Write the volume files in the background (ASYNC_OUTPUT)
+   CParallelDataSorter* asyncDataSorter;     //!< Copy of the sorted volume data that is written in the background
+   CAsyncFileWriter* asyncFileWriter;        //!< Background thread writing the volume files
+   bool asyncBatchOpen;                      //!< Files of the current output were queued for the background thread
+   bool asyncConnectivity;                   //!< The connectivity was copied to asyncDataSorter for the current output
+
    vector<string> volumeFieldNames;     //!< Vector containing the volume field names
    unsigned short nVolumeFields;        /*!< \brief Number of fields in the volume output */
+   vector<bool> restartSinglePrecision; //!< Volume fields (by offset) stored in single precision in binary restart files
 
    string volumeFilename,               //!< Volume output filename
    surfaceFilename,                     //!< Surface output filename
@@ -194,16 +205,44 @@ protected:
   /*! \brief Vector that contains the keys of the ::volumeOutput_Map in the order of their insertion. */
   std::vector<string>                           volumeOutput_List;
 
-  /*! \brief Vector to cache the positions of the field in the data array */
-  std::vector<short>                            fieldIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                cachePosition;
-  /*! \brief Boolean to store whether the field index cache should be build. */
-  bool                                          buildFieldIndexCache;
-  /*! \brief Vector to cache the positions of the field in the data array */
-  std::vector<short>                            fieldGetIndexCache;
-  /*! \brief Current value of the cache index */
-  unsigned short                                curGetFieldIndex;
+  /*!
+   * \brief Columns of the data sorter accessed by one of the per-point loaders, in the order of the
+   *        Set/Get calls. The sequence of calls only depends on the configuration, therefore the field
+   *        names are resolved once, on the first point that is loaded, and all other points (of this
+   *        and of all later outputs) only replay the offsets, without any string handling.
+   */
+  struct OutputColumnTable {
+    std::vector<short> set;   /*!< \brief Offsets of the fields that are set, -1 if the field is not written. */
+    std::vector<short> get;   /*!< \brief Offsets of the fields that are read back. */
+#ifndef NDEBUG
+    std::vector<string> setNames;  /*!< \brief Names of the fields that are set, replays are checked against them. */
+    std::vector<string> getNames;  /*!< \brief Names of the fields that are read back. */
+#endif
+    bool resolved = false;    /*!< \brief Whether the names were already resolved. */
+  };
+  /*! \brief Per-thread position in the active column table (padded to avoid false sharing). */
+  struct OutputColumnCursor {
+    unsigned short set = 0, get = 0;
+    char pad[60];
+  };
+
+  OutputColumnTable volumeColumns;                 /*!< \brief Columns of LoadVolumeData(FEM). */
+  OutputColumnTable surfaceColumns;                /*!< \brief Columns of LoadSurfaceData. */
+  OutputColumnTable* activeColumns = nullptr;      /*!< \brief Table used by the Set/Get routines. */
+  bool resolveColumns = false;                     /*!< \brief True while the field names are being resolved. */
+  std::vector<OutputColumnCursor> columnCursor;    /*!< \brief One cursor per thread. */
+
+  /*!
+   * \brief Volume output field copied by LoadDataIntoSorter for all points at once, directly from a
+   *        point-major container (e.g. a column of the solution), instead of through LoadVolumeData.
+   */
+  struct VolumeOutputColumn {
+    short offset;             /*!< \brief Offset of the field in the data sorter. */
+    const su2double* data;    /*!< \brief Start of the container. */
+    unsigned long stride;     /*!< \brief Distance between the values of consecutive points. */
+    unsigned long index;      /*!< \brief Position of the value within the data of a point. */
+  };
+  std::vector<VolumeOutputColumn> volumeBulkColumns;  /*!< \brief Fields registered by SetVolumeOutputColumns. */
 
   /*! \brief Requested volume field names in the config file. */
   std::vector<string> requestedVolumeFields;
@@ -584,25 +623,37 @@ protected:
 
 
   /*!
-   * \brief Set the value of a volume output field
+   * \brief Get the value of a volume output field.
+   * \note Only valid inside the per-point loaders, see ::LoadDataIntoSorter.
    * \param[in] name - Name of the field.
-   * \param[in] value - The new value of this field.
+   * \param[in] iPoint - Index of the point.
+   * \return The current value of this field.
    */
-  su2double GetVolumeOutputValue(string name, unsigned long iPoint);
+  su2double GetVolumeOutputValue(const char* name, unsigned long iPoint);
+  inline su2double GetVolumeOutputValue(const string& name, unsigned long iPoint) {
+    return GetVolumeOutputValue(name.c_str(), iPoint);
+  }
 
   /*!
-   * \brief Set the value of a volume output field
+   * \brief Set the value of a volume output field.
+   * \note Only valid inside the per-point loaders, see ::LoadDataIntoSorter.
    * \param[in] name - Name of the field.
+   * \param[in] iPoint - Index of the point.
    * \param[in] value - The new value of this field.
    */
-  void SetVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetVolumeOutputValue(const char* name, unsigned long iPoint, su2double value);
+  inline void SetVolumeOutputValue(const string& name, unsigned long iPoint, su2double value) {
+    SetVolumeOutputValue(name.c_str(), iPoint, value);
+  }
 
   /*!
-   * \brief Set the value of a volume output field
+   * \brief Update the running time average of a volume output field.
+   * \note Only valid inside the per-point loaders, see ::LoadDataIntoSorter.
    * \param[in] name - Name of the field.
-   * \param[in] value - The new value of this field.
+   * \param[in] iPoint - Index of the point.
+   * \param[in] value - The new (instantaneous) value of this field.
    */
-  void SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value);
+  void SetAvgVolumeOutputValue(const char* name, unsigned long iPoint, su2double value);
 
   /*!
    * \brief CheckHistoryOutput
@@ -617,12 +668,59 @@ protected:
 
   /*!
    * \brief Load up the values of the requested volume fields into ::Local_Data array.
+   * \note The FVM points are loaded in parallel, LoadVolumeData must therefore be thread-safe.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - The container holding all solution data.
    */
   void LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver);
 
+  /*!
+   * \brief Map a volume output field name to its offset in the data sorter (-1 if not written).
+   * \param[in] name - Name of the field.
+   * \return Offset of the field.
+   */
+  short GetVolumeOutputOffset(const char* name) const;
+
+  /*!
+   * \brief Offset of the next field set by a per-point loader (resolved from the name on the first point).
+   * \param[in] name - Name of the field.
+   * \return Offset of the field.
+   */
+  short NextSetColumn(const char* name);
+
+  /*!
+   * \brief Offset of the next field read back by a per-point loader (resolved from the name on the first point).
+   * \param[in] name - Name of the field.
+   * \return Offset of the field.
+   */
+  short NextGetColumn(const char* name);
+
+  /*!
+   * \brief Check that a point replayed the complete column sequence of the active table.
+   * \param[in] cursor - Cursor of the thread that loaded the point.
+   */
+  void CheckColumnSequence(const OutputColumnCursor& cursor) const;
+
+  /*!
+   * \brief Register volume output fields that are consecutive columns of a point-major container,
+   *        LoadDataIntoSorter copies them for all points (see SetVolumeOutputColumns).
+   * \param[in] names - Names of the fields, in the order of the columns.
+   * \param[in] data - Start of the container.
+   * \param[in] stride - Distance between the values of consecutive points.
+   */
+  void AddVolumeOutputColumns(std::initializer_list<const char*> names, const su2double* data, unsigned long stride);
+
+  /*!
+   * \brief Register volume output fields that are the columns of a matrix (one row per point).
+   * \param[in] names - Names of the fields, in the order of the columns.
+   * \param[in] matrix - The matrix.
+   */
+  template<class MatrixType>
+  inline void AddVolumeOutputColumns(std::initializer_list<const char*> names, const MatrixType& matrix) {
+    AddVolumeOutputColumns(names, matrix.data(), matrix.cols());
+  }
+
   /*!
    * \brief Postprocess_HistoryData
    * \param[in] config - Definition of the particular problem.
@@ -667,6 +765,15 @@ protected:
    */
   void AllocateDataSorters(CConfig *config, CGeometry *geometry);
 
+  /*!
+   * \brief Get the volume data sorter from which a file is written. With asynchronous output, for the formats
+   *        written in the background, this is a copy of the sorted data (and connectivity) of volumeDataSorter.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] format - The output format.
+   * \return The data sorter to give to the file writer.
+   */
+  CParallelDataSorter* GetWritingDataSorter(CConfig *config, unsigned short format);
+
   /*--------------------------------- Virtual functions ---------------------------------------- */
 public:
 
@@ -675,6 +782,13 @@ public:
    */
   virtual ~COutput(void);
 
+  /*!
+   * \brief Wait for the files that are written in the background, if any, and add their
+   *        bandwidth to the aggregated restart bandwidth of the config.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void WaitForAsyncFiles(CConfig *config);
+
 protected:
 
   /*!
@@ -712,6 +826,16 @@ protected:
    */
   inline virtual void LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){}
 
+  /*!
+   * \brief Register the volume output fields that are copied directly from the containers of the solvers
+   *        (see AddVolumeOutputColumns), for all points at once, these are not set by LoadVolumeData.
+   * \note Called before every output of the FVM solvers, the containers must hold one row per point.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - The container holding all solution data.
+   */
+  inline virtual void SetVolumeOutputColumns(CConfig *config, CGeometry *geometry, CSolver **solver){}
+
   /*!
    * \brief Set the values of the volume output fields for a point.
    * \param[in] config - Definition of the particular problem.
@@ -0,0 +1,93 @@
+/*!
+ * \file CAsyncFileWriter.hpp
+ * \brief Headers of the class that writes files in a background thread.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+#include <thread>
+#include <memory>
+
+/*!
+ * \class CAsyncFileWriter
+ * \brief Writes batches of files in a background thread while the solver continues.
+ * \note The writers are collective, the thread uses its own duplicate of MPI_COMM_WORLD, which
+ *       requires MPI_THREAD_MULTIPLE (see IsSupported). The data given to the writers (the data
+ *       sorters) must not be modified until Wait returns.
+ * \author SU2 Contributors
+ */
+class CAsyncFileWriter {
+private:
+
+  SU2_Comm comm;                               /*!< \brief Communicator of the background thread. */
+  thread worker;                               /*!< \brief The thread writing the current batch. */
+  vector<unique_ptr<CFileWriter> > writers;    /*!< \brief Files of the current batch. */
+  vector<bool> restartFile;                    /*!< \brief Whether each file is a restart (for the bandwidth). */
+
+public:
+
+  /*!
+   * \brief Constructor of the class, must be called by all ranks.
+   */
+  CAsyncFileWriter();
+
+  /*!
+   * \brief Destructor of the class, waits for the files that are still being written.
+   */
+  ~CAsyncFileWriter();
+
+  CAsyncFileWriter(const CAsyncFileWriter&) = delete;
+  CAsyncFileWriter& operator=(const CAsyncFileWriter&) = delete;
+
+  /*!
+   * \brief Check if files can be written in the background with the current MPI thread support.
+   * \return <TRUE> if MPI was initialized with MPI_THREAD_MULTIPLE (or without MPI).
+   */
+  static bool IsSupported();
+
+  /*!
+   * \brief Add a file to the next batch, the writing starts with Start.
+   * \param[in] writer - The file writer, the object takes ownership.
+   * \param[in] restart - Whether the file is a restart file.
+   */
+  void AddFile(CFileWriter* writer, bool restart);
+
+  /*!
+   * \brief Start writing the files of the batch in the background.
+   */
+  void Start();
+
+  /*!
+   * \brief Wait until the files of the last batch are written, and release their writers.
+   * \return The sum of the bandwidths of the restart files of the batch.
+   */
+  su2double Wait();
+
+  /*!
+   * \brief Check if files are being written.
+   */
+  bool Busy() const { return worker.joinable(); }
+
+};
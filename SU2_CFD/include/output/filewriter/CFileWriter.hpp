@@ -83,6 +83,16 @@ protected:
    * \brief The parallel data sorter
    */
   CParallelDataSorter* dataSorter;
+
+  /*!
+   * \brief The communicator used to write the file (see SetCommunicator).
+   */
+  SU2_Comm comm;
+
+  /*!
+   * \brief Whether the file is written in a background thread (see SetBackground).
+   */
+  bool background = false;
   
 #ifdef HAVE_MPI
   /*!
@@ -128,6 +138,19 @@ public:
    */
   virtual void Write_Data(){}
 
+  /*!
+   * \brief Set the communicator used to write the file, by default MPI_COMM_WORLD. A file written in a
+   *        background thread needs its own communicator, as the solver keeps communicating on MPI_COMM_WORLD.
+   * \param[in] valComm - The communicator, all ranks in it must write the file.
+   */
+  void SetCommunicator(SU2_Comm valComm) {comm = valComm;}
+
+  /*!
+   * \brief Mark the file as written in a background thread, the writer must then work serially
+   *        (an OpenMP team started there would compete with the threads of the solver).
+   */
+  void SetBackground() {background = true;}
+
   /*!
    * \brief Get the bandwith used for the last writing
    */
@@ -342,4 +342,17 @@ public:
    */
   void SetTotalElements();
 
+  /*!
+   * \brief Copy the sorted output data of another sorter, e.g. to write it while the other sorter is refilled.
+   * \note Both sorters must have been constructed for the same geometry and output fields. No communication.
+   * \param[in] other - The sorter with the sorted data (SortOutputData must have been called).
+   */
+  void CopySortedData(const CParallelDataSorter& other);
+
+  /*!
+   * \brief Copy the sorted connectivity of another sorter (see ::CopySortedData).
+   * \param[in] other - The sorter with the sorted connectivity (SortConnectivity must have been called).
+   */
+  void CopyConnectivity(const CParallelDataSorter& other);
+
 };
@@ -0,0 +1,78 @@
+/*!
+ * \file CSU2CompressedFileWriter.hpp
+ * \brief Headers for the SU2 block-compressed binary file writer class.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CFileWriter.hpp"
+
+/*!
+ * \class CSU2CompressedFileWriter
+ * \brief Writes the SU2 binary restart format in blocks of points, selected fields can be stored in single precision
+ *        and the blocks can be compressed. Layout of the file:
+ *        - int header[5] = {SU2_COMPRESSED_RESTART_MAGIC, nFields, nPointGlobal, nBlock, compressed};
+ *        - nFields names of CGNS_STRING_SIZE chars (as in the plain format);
+ *        - nFields ints with the size in bytes of the values of each field (8 or 4);
+ *        - (nBlock+1) x 2 unsigned longs {first point, start of the block relative to the first block}, the last
+ *          entry marks the end of the data;
+ *        - the blocks, each stores the fields of its points one after the other (field-major). When compressed, the
+ *          bytes of each field are shuffled (see CompressionToolbox::ByteShuffle) and the block is stored in LZ4 block
+ *          format, unless that does not reduce its size, in which case the shuffled bytes are stored as they are.
+ *        Each rank writes the blocks of its own points, they are encoded independently and therefore in parallel
+ *        (by the OpenMP threads, unless the file is written in the background).
+ */
+class CSU2CompressedFileWriter final: public CFileWriter{
+
+  const vector<bool> singlePrecision;  /*!< \brief Fields written as float. */
+  const bool compress;                 /*!< \brief Whether the blocks are compressed. */
+
+public:
+
+  /*!
+   * \brief File extension
+   */
+  const static string fileExt;
+
+  /*!
+   * \brief Number of points per block.
+   */
+  static constexpr unsigned long blockSize = 4096;
+
+  /*!
+   * \brief Construct a file writer using field names and the data sorter.
+   * \param[in] valFileName - The name of the file
+   * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valSinglePrecision - For each field, whether it is written in single precision.
+   * \param[in] valCompress - Whether to compress the blocks.
+   */
+  CSU2CompressedFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
+                           vector<bool> valSinglePrecision, bool valCompress);
+
+  /*!
+   * \brief Write sorted data to file in the block SU2 binary file format
+   */
+  void Write_Data() override;
+
+};
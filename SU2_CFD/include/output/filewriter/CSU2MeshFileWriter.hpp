@@ -32,6 +32,19 @@ class CSU2MeshFileWriter final: public CFileWriter{
 private:
   unsigned short iZone, //!< Index of the current zone
   nZone;                //!< Number of zones
+  bool binary;          //!< Write the binary format (MESH_OUT_FORMAT= SU2_BINARY)
+
+  /*!
+   * \brief Read the markers of the zone from the boundary file written by the geometry (master only).
+   * \param[out] markerNames - The names of the markers.
+   * \param[out] markerConn - The surface elements of each marker, [0 vtkType n0 ...] in chunks of SU2_CONN_SIZE.
+   */
+  void ReadBoundaryFile(vector<string>& markerNames, vector<vector<unsigned long> >& markerConn) const;
+
+  /*!
+   * \brief Write sorted data to file in SU2 binary mesh file format (see CSU2BinaryMeshReaderFVM).
+   */
+  void Write_Data_Binary();
 
 public:
 
@@ -40,15 +53,21 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief File extension of the binary format
+   */
+  const static string fileExtBinary;
+
   /*!
    * \brief Construct a file writer using field names, dimension.
    * \param[in] valFileName - The name of the file
    * \param[in] valDataSorter - The parallel sorted data to write
    * \param[in] valiZone - The index of the current zone
    * \param[in] valnZone - The total number of zones
+   * \param[in] valBinary - Write the binary format
    */
   CSU2MeshFileWriter(string valFileName, CParallelDataSorter* valDataSorter,
-                     unsigned short valiZone, unsigned short valnZone);
+                     unsigned short valiZone, unsigned short valnZone, bool valBinary = false);
 
   /*!
    * \brief Destructor
@@ -277,6 +277,13 @@ protected:
 
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  /*--- MUSCL reconstructed states of the domain points at the mid-point of each of their edges,
+   * computed with the gradients and limiters (see SetPrimitive_Gradient_Limiter) and used by
+   * the edge loops of Upwind_Residual instead of reading gradients and limiters again. ---*/
+
+  su2activematrix ReconstructedStates;   /*!< \brief Reconstructed primitives per point-neighbor pair (CSR layout of the dual grid). */
+  bool ReconstructedStatesSet = false;   /*!< \brief Whether the states are consistent with the current primitives. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -515,6 +522,87 @@ public:
                        CConfig *config,
                        unsigned short iMesh) final;
 
+  /*!
+   * \brief Vectorized version of Upwind_Residual, edges are gathered in batches (see CEdgeBatch) whose
+   *        fluxes are computed by one call to the numerics. Used for the ideal gas Roe, HLLC, and AUSM schemes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics_container - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in,out] counter_local - Number of non-physical reconstructions.
+   */
+  void Upwind_Residual_Batch(CGeometry *geometry, CSolver **solver_container,
+                             CNumerics **numerics_container, CConfig *config,
+                             unsigned short iMesh, unsigned long& counter_local);
+
+  /*!
+   * \brief Whether the MPI exchange of the limiters overlaps the edge loop of Upwind_Residual.
+   * \note In that case SetPrimitive_Limiter does not communicate, Upwind_Residual posts the exchange,
+   *       computes the edges between domain points, and then the edges with halo points.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline bool LimiterCommOverlap(const CConfig *config, unsigned short iMesh) const {
+    return (size > 1) && (iMesh == MESH_0) && config->GetMUSCL_Flow() &&
+           (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+           (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+           (config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE) &&
+           (config->GetInnerIter() <= config->GetLimiterIter()) &&
+           !config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint();
+  }
+
+  /*!
+   * \brief Whether the gradients, limiters, and reconstructed states are computed in one pass
+   *        (FUSED_RECONSTRUCTION= YES) for MUSCL with point limiters on the finest grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  inline bool FusedReconstruction(const CConfig *config, unsigned short iMesh) const {
+    return config->GetFused_Reconstruction() && (iMesh == MESH_0) && config->GetMUSCL_Flow() &&
+           (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND) &&
+           (config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE);
+  }
+
+  /*!
+   * \brief Compute the reconstruction gradient of the primitive variables, their limiters, and the
+   *        reconstructed states of the domain points, in one pass (see computeGradientsAndLimiters).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - Use the method and storage of the reconstruction gradient,
+   *            otherwise the primitive gradient (when the same gradient is used for both).
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config, bool reconstruction);
+
+  /*!
+   * \brief MUSCL reconstruction of the primitive variables at the mid-point of an edge.
+   * \note For Van Albada the limiters of the points are updated. The states of the domain
+   *       points are copied from ReconstructedStates when these are up to date.
+   * \param[in] dualGrid - Edge and point data of the grid.
+   * \param[in] iEdge - Edge index.
+   * \param[in] limiter - Whether to use the slope limiters.
+   * \param[in] van_albada - Whether the limiter is Van Albada (edge based).
+   * \param[out] Primitive_i - Reconstructed primitives on the iPoint side.
+   * \param[out] Primitive_j - Reconstructed primitives on the jPoint side.
+   */
+  void MUSCLReconstruction(const CDualGridSoA& dualGrid, unsigned long iEdge,
+                           bool limiter, bool van_albada,
+                           su2double* Primitive_i, su2double* Primitive_j);
+
+  /*!
+   * \brief Check the reconstructed states for negative pressure, density, or speed of sound,
+   *        and update the non-physical flags of the points accordingly.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   * \param[in] Primitive_i - Reconstructed primitives on the iPoint side.
+   * \param[in] Primitive_j - Reconstructed primitives on the jPoint side.
+   * \param[out] bad_i - True if the cell-average values of iPoint should be used.
+   * \param[out] bad_j - True if the cell-average values of jPoint should be used.
+   */
+  void CheckNonPhysicalReconstruction(unsigned long iPoint, unsigned long jPoint,
+                                      const su2double* Primitive_i, const su2double* Primitive_j,
+                                      bool& bad_i, bool& bad_j);
+
   /*!
    * \brief Compute the viscous contribution for a particular edge.
    * \note The convective residual methods include a call to this for each edge,
@@ -1081,6 +1169,27 @@ public:
                                CSolver **solver_container,
                                CConfig *config) final;
 
+  /*!
+   * \brief Assemble the linear system of the implicit iteration, i.e. add the pseudo time term
+   *        to the Jacobian, set the right hand side (-Residual) and compute the residual norms.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PrepareImplicitIteration(CGeometry *geometry,
+                                CSolver **solver_container,
+                                CConfig *config) final;
+
+  /*!
+   * \brief Update the solution with the solution of the linear system of the implicit iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void CompleteImplicitIteration(CGeometry *geometry,
+                                 CSolver **solver_container,
+                                 CConfig *config) final;
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over a nonlinear iteration for stability.
    * \param[in] solver - Container vector with all the solutions.
@@ -29,6 +29,8 @@
 
 #include "CSolver.hpp"
 #include "../../../Common/include/omp_structure.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 
 /*!
  * \class CFEASolver
@@ -87,6 +89,63 @@ protected:
 
   unsigned long nElement;           /*!< \brief Number of elements. */
 
+  /*--- Type of the linear solver, see CSolver::System. ---*/
+#ifndef CODI_FORWARD_TYPE
+  using ScalarType = passivedouble;
+#else
+  using ScalarType = su2double;
+#endif
+
+  /*!
+   * \class CMatrixFreeProduct
+   * \brief Product of the (constrained) stiffness matrix with a vector, evaluated element by element.
+   */
+  class CMatrixFreeProduct final : public CMatrixVectorProduct<ScalarType> {
+  private:
+    CFEASolver* solver;  /*!< \brief Solver that owns the product. */
+
+  public:
+    CMatrixFreeProduct(CFEASolver* owner) : solver(owner) {}
+
+    inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+      solver->MatrixFreeProduct(u, v);
+    }
+  };
+
+  /*!
+   * \class CMatrixFreePreconditioner
+   * \brief Block Jacobi or Chebyshev preconditioner of the matrix-free stiffness operator.
+   */
+  class CMatrixFreePreconditioner final : public CPreconditioner<ScalarType> {
+  private:
+    CFEASolver* solver;  /*!< \brief Solver that owns the preconditioner. */
+
+  public:
+    CMatrixFreePreconditioner(CFEASolver* owner) : solver(owner) {}
+
+    inline void Build() override { solver->BuildMatrixFreePreconditioner(); }
+
+    inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+      solver->MatrixFreePreconditioner(u, v);
+    }
+  };
+
+  bool matrix_free = false;                         /*!< \brief The stiffness matrix is not assembled (MATRIX_FREE_ELASTICITY). */
+  CMatrixFreeProduct MatrixFree_Product{this};      /*!< \brief Matrix-free product passed to the linear solver. */
+  CMatrixFreePreconditioner MatrixFree_Prec{this};  /*!< \brief Matrix-free preconditioner passed to the linear solver. */
+
+  /*--- Problem of the matrix-free operations, set by the routines that use them
+   *    as the linear solver only passes vectors to the product. ---*/
+  CGeometry* MatrixFree_Geometry = nullptr;
+  CNumerics** MatrixFree_Numerics = nullptr;
+  CConfig* MatrixFree_Config = nullptr;
+
+  vector<bool> EnforcedNode;                  /*!< \brief Nodes with Dirichlet conditions (rows/columns of the identity). */
+  vector<ScalarType> BlockDiag;               /*!< \brief Diagonal blocks of the stiffness matrix. */
+  vector<ScalarType> BlockDiagInv;            /*!< \brief Inverse of the diagonal blocks, with the conditions applied. */
+  ScalarType LambdaMax = 0.0;                 /*!< \brief Estimate of the largest eigenvalue of the Jacobi preconditioned operator. */
+  CSysVector<ScalarType> MatrixFree_Work[3];  /*!< \brief Work vectors of the matrix-free operations. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use,
    * CVariable is the common denominator between the FEA and Mesh deformation variables.
@@ -143,6 +202,51 @@ protected:
    */
   void Compute_IntegrationConstants(CConfig *config);
 
+  /*!
+   * \brief Allocate the structures of the matrix-free mode, which replace the Jacobian.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void InitializeMatrixFree(CGeometry *geometry);
+
+  /*!
+   * \brief Enforce the solution of the linear system at a node (Dirichlet condition), i.e. the row and
+   *        column of the node become those of the identity and the right hand side is updated accordingly.
+   * \note In matrix-free mode the node is only marked, the conditions are applied by Solve_System.
+   * \param[in] iPoint - Index of the node.
+   * \param[in] x_i - Value of the solution at the node.
+   */
+  void EnforceSolutionAtNode(unsigned long iPoint, const su2double *x_i);
+
+  /*!
+   * \brief Compute the product of the stiffness matrix with a vector, element by element.
+   * \note Must be called by all threads, the coloring of the elements avoids conflicts between threads.
+   * \param[in] u - Vector being multiplied.
+   * \param[out] v - Result of the product.
+   * \param[in] constrained - If false the Dirichlet conditions are not applied (product by the full matrix).
+   */
+  void MatrixFreeProduct(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v, bool constrained = true);
+
+  /*!
+   * \brief Apply the inverse of the diagonal blocks to a vector, scaled by a constant.
+   * \param[in] u - Input vector.
+   * \param[out] v - Output vector.
+   * \param[in] scale - Scaling factor.
+   */
+  void ApplyBlockDiagInv(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v, ScalarType scale);
+
+  /*!
+   * \brief Invert the diagonal blocks and, for Chebyshev preconditioning, estimate the largest eigenvalue.
+   * \note Called by the linear solver before the solution of each system.
+   */
+  void BuildMatrixFreePreconditioner();
+
+  /*!
+   * \brief Apply the block Jacobi or Chebyshev (MATRIX_FREE_CHEBYSHEV_DEGREE > 0) preconditioner.
+   * \param[in] u - Input vector.
+   * \param[out] v - Output vector.
+   */
+  void MatrixFreePreconditioner(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v);
+
   /*!
    * \brief Write the forward mode gradient to file.
    * \param[in] config - Definition of the particular problem.
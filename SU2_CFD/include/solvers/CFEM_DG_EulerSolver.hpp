@@ -29,6 +29,7 @@
 #pragma once
 
 #include "CSolver.hpp"
+#include "../task_scheduler.hpp"
 
 /*!
  * \class CFEM_DG_EulerSolver
@@ -43,7 +44,7 @@ protected:
   su2double Gamma;           /*!< \brief Fluid's Gamma constant (ratio of specific heats). */
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
-  CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModel; /*!< \brief Fluid model used in the solver, one per OpenMP thread. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -266,6 +267,7 @@ private:
 
   vector<CTaskDefinition> tasksList; /*!< \brief List of tasks to be carried out in the computationally
                                                  intensive part of the solver. */
+  CTaskScheduler taskScheduler;      /*!< \brief Object that carries out the tasks of tasksList with OpenMP threads. */
 
   CVariable* GetBaseClassPointerToNodes() final {return nullptr;}
 
@@ -324,7 +326,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CFluidModel* GetFluidModel(void) const final { return FluidModel;}
+  inline CFluidModel* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()];}
 
   /*!
    * \brief Compute the density at the infinity.
@@ -443,7 +445,8 @@ public:
 
   /*!
    * \brief Function, which processes the list of tasks to be executed by
-            the DG solver.
+            the DG solver. The tasks are distributed over the OpenMP threads,
+            honouring the dependencies between them, see CTaskScheduler.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] numerics - Description of the numerical method.
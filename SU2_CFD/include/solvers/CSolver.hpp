@@ -131,6 +131,7 @@ protected:
 
   bool rotate_periodic;    /*!< \brief Flag that controls whether the periodic solution needs to be rotated for the solver. */
   bool implicit_periodic;  /*!< \brief Flag that controls whether the implicit system should be treated by the periodic BC comms. */
+  bool residual_only = false;  /*!< \brief Flag that disables the assembly of the Jacobian by the residual routines. */
 
   bool dynamic_grid;       /*!< \brief Flag that determines whether the grid is dynamic (moving or deforming + grid velocities). */
 
@@ -1503,6 +1504,26 @@ public:
                                               CSolver **solver_container,
                                               CConfig *config) { }
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void PrepareImplicitIteration(CGeometry *geometry,
+                                               CSolver **solver_container,
+                                               CConfig *config) { }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void CompleteImplicitIteration(CGeometry *geometry,
+                                                CSolver **solver_container,
+                                                CConfig *config) { }
+
   /*!
    * \brief A virtual member.
    * \param[in] solver - Container vector with all the solutions.
@@ -3670,6 +3691,16 @@ public:
                                CConfig *config,
                                string val_filename);
 
+  /*!
+   * \brief Read a native SU2 restart file written in blocks (see CSU2CompressedFileWriter), called by
+   *        Read_SU2_Restart_Binary. Each rank only reads the blocks that contain its points, the blocks
+   *        are decompressed in parallel and single precision fields are converted back to double.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] fname - Name of the restart file (with extension).
+   */
+  void Read_SU2_Restart_Blocks(CGeometry *geometry,
+                               const string& fname);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4599,6 +4630,13 @@ public:
    */
   inline void SetRotatePeriodic(bool val_rotate_periodic) { rotate_periodic = val_rotate_periodic; }
 
+  /*!
+   * \brief Routine that sets the flag that disables the assembly of the Jacobian, e.g. when the
+   *        residual routines are used to compute matrix-free products (see CNewtonIntegration).
+   * \param[in] val_residual_only - Flag disabling the updates of the Jacobian.
+   */
+  inline void SetResidualOnly(bool val_residual_only) { residual_only = val_residual_only; }
+
   /*!
    * \brief Retrieve the solver name for output purposes.
    * \param[out] val_solvername - Name of the solver.
@@ -0,0 +1,257 @@
+/*!
+ * \file task_scheduler.hpp
+ * \brief Header of the class that executes a list of tasks with OpenMP threads.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "task_definition.hpp"
+#include "../../Common/include/omp_structure.hpp"
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <functional>
+
+/*!
+ * \class CTaskScheduler
+ * \brief Class to carry out a list of CTaskDefinition with all the threads of a parallel region,
+ *        honouring the dependencies between the tasks.
+ * \note Every thread has a queue of ready tasks, ordered by their index in the list (which is the
+ *       order of the serial execution), and idle threads steal tasks from the queues of the others.
+ *       The MPI tasks have a separate queue processed only by the master thread (MPI is initialized
+ *       with MPI_THREAD_FUNNELED). A communication that cannot be completed yet is retried between
+ *       other tasks and only waited for when there is no other work left on the rank.
+ * \author SU2 Contributors
+ */
+class CTaskScheduler {
+private:
+  /*!
+   * \brief Queue of ready tasks (a min-heap of task indices) protected by a spin lock.
+   */
+  struct CReadyQueue {
+    atomic<bool> locked;           /*!< \brief Lock of the queue. */
+    atomic<unsigned long> nTasks;  /*!< \brief Number of tasks in the queue, can be read without the lock. */
+    vector<unsigned long> tasks;   /*!< \brief Indices of the ready tasks. */
+
+    CReadyQueue() : locked(false), nTasks(0) {}
+
+    inline void Lock() { while (locked.exchange(true, memory_order_acquire)) {} }
+
+    inline void Unlock() { locked.store(false, memory_order_release); }
+  };
+
+  unsigned long nTasks = 0;               /*!< \brief Number of tasks in the list. */
+  vector<unsigned long> nDependencies;    /*!< \brief Number of tasks each task depends on. */
+  vector<unsigned long> dependentsStart;  /*!< \brief Start of the dependents of each task in dependents. */
+  vector<unsigned long> dependents;       /*!< \brief Tasks that depend on each task (cumulative storage). */
+  vector<bool> mpiTask;                   /*!< \brief Whether the task is an MPI communication. */
+
+  unique_ptr<atomic<unsigned long>[]> nDependenciesLeft;  /*!< \brief Dependencies not yet completed. */
+  unique_ptr<CReadyQueue[]> queues;  /*!< \brief Queue of the MPI tasks, followed by the queue of each thread. */
+  int nQueues = 0;                   /*!< \brief Number of queues allocated. */
+
+  atomic<unsigned long> nCompleted;  /*!< \brief Number of completed tasks. */
+  atomic<unsigned long> nActive;     /*!< \brief Number of tasks in the queues or being carried out. */
+
+  /*!
+   * \brief Add a ready task to a queue.
+   */
+  inline void Push(const int iQueue, const unsigned long iTask) {
+    ++nActive;
+    auto& queue = queues[iQueue];
+    queue.Lock();
+    queue.tasks.push_back(iTask);
+    push_heap(queue.tasks.begin(), queue.tasks.end(), greater<unsigned long>());
+    queue.nTasks = queue.tasks.size();
+    queue.Unlock();
+  }
+
+  /*!
+   * \brief Take the ready task with the lowest index from a queue, if any.
+   */
+  inline bool Pop(const int iQueue, unsigned long &iTask) {
+    auto& queue = queues[iQueue];
+    if (queue.nTasks == 0) return false;
+
+    queue.Lock();
+    const bool found = !queue.tasks.empty();
+    if (found) {
+      pop_heap(queue.tasks.begin(), queue.tasks.end(), greater<unsigned long>());
+      iTask = queue.tasks.back();
+      queue.tasks.pop_back();
+      queue.nTasks = queue.tasks.size();
+    }
+    queue.Unlock();
+    return found;
+  }
+
+  /*!
+   * \brief Mark a task as completed and release the tasks that depend on it.
+   * \note The released tasks go to the queue of the calling thread, as their data is likely in its cache.
+   *       They are counted as active before the completed task stops being active (see Execute).
+   */
+  inline void Complete(const unsigned long iTask, const int thread) {
+    for (auto i = dependentsStart[iTask]; i < dependentsStart[iTask+1]; ++i) {
+      const auto jTask = dependents[i];
+      if (nDependenciesLeft[jTask].fetch_sub(1) == 1)
+        Push(mpiTask[jTask]? 0 : thread+1, jTask);
+    }
+    ++nCompleted;
+  }
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   */
+  CTaskScheduler(void) : nCompleted(0), nActive(0) {}
+
+  /*!
+   * \brief Set the task graph, i.e. the inverse of the dependencies stored in the tasks.
+   * \param[in] tasksList - List of tasks, the dependencies must refer to tasks with a lower index.
+   */
+  void SetTasks(const vector<CTaskDefinition> &tasksList) {
+
+    nTasks = tasksList.size();
+    nDependencies.assign(nTasks, 0);
+    dependentsStart.assign(nTasks+1, 0);
+    mpiTask.assign(nTasks, false);
+
+    for (unsigned long i = 0; i < nTasks; ++i) {
+      const auto& task = tasksList[i];
+      nDependencies[i] = task.nIndMustBeCompleted;
+      for (unsigned short j = 0; j < task.nIndMustBeCompleted; ++j)
+        ++dependentsStart[task.indMustBeCompleted[j]+1];
+
+      mpiTask[i] = (task.task == CTaskDefinition::INITIATE_MPI_COMMUNICATION) ||
+                   (task.task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION) ||
+                   (task.task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION) ||
+                   (task.task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION);
+    }
+
+    for (unsigned long i = 0; i < nTasks; ++i)
+      dependentsStart[i+1] += dependentsStart[i];
+
+    dependents.resize(dependentsStart[nTasks]);
+    vector<unsigned long> counter(dependentsStart.begin(), dependentsStart.end()-1);
+
+    for (unsigned long i = 0; i < nTasks; ++i)
+      for (unsigned short j = 0; j < tasksList[i].nIndMustBeCompleted; ++j)
+        dependents[counter[tasksList[i].indMustBeCompleted[j]]++] = i;
+
+    nDependenciesLeft.reset(new atomic<unsigned long>[nTasks]);
+  }
+
+  /*!
+   * \brief Carry out all the tasks, must be called by all the threads of a parallel region.
+   * \param[in] runTask - Functor with signature bool(unsigned long iTask, bool mustBeCompleted), which carries
+   *            out the task. Only the completion of communications may return false, when it is called with
+   *            mustBeCompleted = false and the communication is not finished yet.
+   */
+  template<class TaskFunctor>
+  void Execute(TaskFunctor &runTask) {
+
+    const int thread = omp_get_thread_num();
+    const int nThreads = omp_get_num_threads();
+
+    /*--- The master resets the dependency counters and distributes the tasks without
+          dependencies round-robin over the queues of the threads. ---*/
+    SU2_OMP_MASTER
+    {
+      if (nQueues < nThreads+1) {
+        nQueues = nThreads+1;
+        queues.reset(new CReadyQueue[nQueues]);
+      }
+
+      nCompleted = 0;
+      nActive = 0;
+
+      int iQueue = 0;
+      for (unsigned long i = 0; i < nTasks; ++i) {
+        nDependenciesLeft[i] = nDependencies[i];
+        if (nDependencies[i] == 0) {
+          if (mpiTask[i]) Push(0, i);
+          else { Push(iQueue+1, i); iQueue = (iQueue+1) % nThreads; }
+        }
+      }
+    }
+    SU2_OMP_BARRIER
+
+    /*--- Communications that were started but could not be completed (master only). ---*/
+    vector<unsigned long> pendingComms;
+
+    while (nCompleted < nTasks) {
+
+      unsigned long iTask = 0;
+
+      if (thread == 0) {
+
+        /*--- Retry the pending communications without blocking. ---*/
+        for (auto it = pendingComms.begin(); it != pendingComms.end(); ) {
+          if (runTask(*it, false)) {
+            Complete(*it, thread);
+            it = pendingComms.erase(it);
+          }
+          else ++it;
+        }
+
+        /*--- The MPI tasks have priority, to start the communications as early as possible. ---*/
+        if (Pop(0, iTask)) {
+          if (runTask(iTask, false)) Complete(iTask, thread);
+          else pendingComms.push_back(iTask);
+          --nActive;
+          continue;
+        }
+      }
+
+      /*--- Take a task from the own queue, otherwise try to steal one from the others. ---*/
+      bool found = false;
+      for (int i = 0; i < nThreads && !found; ++i)
+        found = Pop((thread+i) % nThreads + 1, iTask);
+
+      if (found) {
+        runTask(iTask, true);
+        Complete(iTask, thread);
+        --nActive;
+        continue;
+      }
+
+      /*--- Nothing to do. When no task is queued or running, only a pending communication can release
+            more work and the master waits for it (as the serial execution of the list would do). ---*/
+      if ((thread == 0) && !pendingComms.empty() && (nActive == 0)) {
+        runTask(pendingComms.front(), true);
+        Complete(pendingComms.front(), thread);
+        pendingComms.erase(pendingComms.begin());
+        continue;
+      }
+
+      this_thread::yield();
+    }
+    SU2_OMP_BARRIER
+  }
+
+};
@@ -90,6 +90,7 @@
 
 #include "../../include/integration/CSingleGridIntegration.hpp"
 #include "../../include/integration/CMultiGridIntegration.hpp"
+#include "../../include/integration/CNewtonIntegration.hpp"
 #include "../../include/integration/CStructuralIntegration.hpp"
 #include "../../include/integration/CFEM_DG_Integration.hpp"
 
@@ -395,6 +396,17 @@ void CDriver::Postprocessing() {
   bool isBinary = config_container[ZONE_0]->GetWrt_Binary_Restart();
   bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
 
+  /*--- Finish writing the files of the last output, if written in the background,
+   *    to account for their bandwidth in the performance summary. ---*/
+
+  if (output_container != NULL) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      if (output_container[iZone] != NULL)
+        output_container[iZone]->WaitForAsyncFiles(config_container[iZone]);
+    }
+    BandwidthSum = config_container[ZONE_0]->GetRestart_Bandwidth_Agg();
+  }
+
     /*--- Output some information to the console. ---*/
 
   if (rank == MASTER_NODE) {
@@ -840,10 +852,17 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points using Reverse Cuthill McKee ordering or a space filling curve ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (config->GetKind_Point_Ordering() == RCM_ORDERING) {
+    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+    geometry[MESH_0]->SetRCM_Ordering(config);
+  }
+  else {
+    if (rank == MASTER_NODE) cout << "Renumbering points (" <<
+      ((config->GetKind_Point_Ordering() == HILBERT_ORDERING)? "Hilbert" : "Morton") << " Ordering)." << endl;
+    geometry[MESH_0]->SetSFC_Ordering(config);
+  }
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -868,6 +887,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
+  geometry[MESH_0]->SetEdgeOrdering(config);
   geometry[MESH_0]->SetVertex(config);
 
   /*--- Compute cell center of gravity ---*/
@@ -934,6 +954,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     /*--- Create the edge structure ---*/
 
     geometry[iMGlevel]->SetEdges();
+    geometry[iMGlevel]->SetEdgeOrdering(config);
     geometry[iMGlevel]->SetVertex(geometry[iMGlevel-1], config);
 
     /*--- Create the control volume structures ---*/
@@ -1846,8 +1867,10 @@ void CDriver::Integration_Preprocessing(CConfig *config, CIntegration **&integra
   if (template_solver) integration[TEMPLATE_SOL] = new CSingleGridIntegration(config);
 
   /*--- Allocate solution for direct problem ---*/
-  if (euler) integration[FLOW_SOL] = new CMultiGridIntegration(config);
-  if (ns) integration[FLOW_SOL] = new CMultiGridIntegration(config);
+  if (euler || ns) {
+    if (config->GetNewtonKrylov() && !disc_adj) integration[FLOW_SOL] = new CNewtonIntegration(config);
+    else integration[FLOW_SOL] = new CMultiGridIntegration(config);
+  }
   if (turbulent) integration[TURB_SOL] = new CSingleGridIntegration(config);
   if (transition) integration[TRANS_SOL] = new CSingleGridIntegration(config);
   if (heat) integration[HEAT_SOL] = new CSingleGridIntegration(config);
@@ -0,0 +1,251 @@
+/*!
+ * \file CNewtonIntegration.cpp
+ * \brief Matrix-free Newton-Krylov integration of the flow equations.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/integration/CNewtonIntegration.hpp"
+#include "../../../Common/include/omp_structure.hpp"
+
+
+CNewtonIntegration::CNewtonIntegration(CConfig *config) : CMultiGridIntegration(config), product(this) {
+
+  const auto kindSolver = config->GetKind_Solver();
+
+  if ((kindSolver != EULER) && (kindSolver != NAVIER_STOKES) && (kindSolver != RANS))
+    SU2_MPI::Error("NEWTON_KRYLOV is only available for the compressible flow solvers.", CURRENT_FUNCTION);
+
+  if (config->GetTime_Marching() != STEADY)
+    SU2_MPI::Error("NEWTON_KRYLOV is only available for steady problems.", CURRENT_FUNCTION);
+
+  if (config->GetKind_TimeIntScheme_Flow() != EULER_IMPLICIT)
+    SU2_MPI::Error("NEWTON_KRYLOV requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+
+  if (config->GetnMGLevels() != 0)
+    SU2_MPI::Error("NEWTON_KRYLOV cannot be combined with multigrid (MGLEVEL= 0).", CURRENT_FUNCTION);
+
+  if (config->Low_Mach_Preconditioning() || (config->GetKind_Upwind_Flow() == TURKEL))
+    SU2_MPI::Error("NEWTON_KRYLOV cannot be combined with low Mach preconditioning.", CURRENT_FUNCTION);
+
+  const auto kindLinSol = config->GetKind_Linear_Solver();
+
+  if ((kindLinSol == PASTIX_LDLT) || (kindLinSol == PASTIX_LU))
+    SU2_MPI::Error("NEWTON_KRYLOV requires an iterative linear solver.", CURRENT_FUNCTION);
+}
+
+void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry,
+                                             CSolver *****solver_container,
+                                             CNumerics ******numerics_container,
+                                             CConfig **config,
+                                             unsigned short RunTime_EqSystem,
+                                             unsigned short iZone,
+                                             unsigned short iInst) {
+
+  /*--- Far from the solution the Newton linearization is not useful, start with normal implicit iterations. ---*/
+
+  if (config[iZone]->GetInnerIter() < config[iZone]->GetNewtonKrylov_Startup_Iter()) {
+    CMultiGridIntegration::MultiGrid_Iteration(geometry, solver_container, numerics_container, config,
+                                               RunTime_EqSystem, iZone, iInst);
+    return;
+  }
+
+  config_zone = config[iZone];
+  geometry_fine = geometry[iZone][iInst][MESH_0];
+  solvers_fine = solver_container[iZone][iInst][MESH_0];
+  numerics_fine = numerics_container[iZone][iInst][MESH_0][FLOW_SOL];
+
+  CSolver* solver = solvers_fine[FLOW_SOL];
+
+  if (LinSysRhs.GetLocSize() == 0) {
+    const auto& res = solver->LinSysRes;
+    Residual_0.Initialize(res.GetNBlk(), res.GetNBlkDomain(), res.GetNVar(), 0.0);
+    LinSysRhs.Initialize(res.GetNBlk(), res.GetNBlkDomain(), res.GetNVar(), 0.0);
+  }
+
+  /*--- Start an OpenMP parallel region covering the entire iteration, if the solver supports it. ---*/
+
+  SU2_OMP_PARALLEL_(if(solver->GetHasHybridParallel()))
+  {
+
+  /*--- Same steps as an implicit iteration up to the assembly of the linear system. ---*/
+
+  solver->Preprocessing(geometry_fine, solvers_fine, config_zone, MESH_0, NO_RK_ITER, RunTime_EqSystem, false);
+
+  /*--- The old solution is the linearization point of the matrix-free products. ---*/
+
+  solver->Set_OldSolution(geometry_fine);
+
+  solver->SetTime_Step(geometry_fine, solvers_fine, config_zone, MESH_0, config_zone->GetTimeIter());
+
+  Space_Integration(geometry_fine, solvers_fine, numerics_fine, config_zone, MESH_0, NO_RK_ITER, RunTime_EqSystem);
+
+  Residual_0 = solver->LinSysRes;
+  SU2_OMP_BARRIER
+
+  solver->PrepareImplicitIteration(geometry_fine, solvers_fine, config_zone);
+
+  LinSysRhs = solver->LinSysRes;
+
+  /*--- Scale of the finite difference step, based on the average magnitude of the solution. ---*/
+
+  SU2_OMP_MASTER
+  {
+    const auto nVar = solver->GetnVar();
+    const auto nPointDomain = geometry_fine->GetnPointDomain();
+
+    su2double local[2] = {0.0, su2double(nPointDomain*nVar)}, global[2] = {0.0, 0.0};
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        local[0] += fabs(solver->GetNodes()->GetSolution(iPoint,iVar));
+
+    SU2_MPI::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    FD_Scale = config_zone->GetNewtonKrylov_FD_Step() * (1.0 + global[0] / max(global[1], su2double(1.0)));
+
+    /*--- The residual evaluations of the products must not update the Jacobian (the preconditioner). ---*/
+
+    solver->SetResidualOnly(true);
+
+    solver->System.SetMatrixFreeProduct(&product);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Solve the linear system, the Jacobian is only used to build the preconditioner. ---*/
+
+  auto iter = solver->System.Solve(solver->Jacobian, LinSysRhs, solver->LinSysSol, geometry_fine, config_zone);
+
+  SU2_OMP_MASTER
+  {
+    solver->SetIterLinSolver(iter);
+    solver->SetResLinSolver(solver->System.GetResidual());
+
+    solver->System.SetMatrixFreeProduct(nullptr);
+
+    solver->SetResidualOnly(false);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Restore the state at the linearization point (including halos) and update the solution. ---*/
+
+  solver->GetNodes()->Set_Solution();
+
+  solver->LinSysRes = LinSysRhs;
+  SU2_OMP_BARRIER
+
+  solver->CompleteImplicitIteration(geometry_fine, solvers_fine, config_zone);
+
+  solver->Postprocessing(geometry_fine, solvers_fine, config_zone, MESH_0);
+
+  /*--- Computes primitive variables and gradients for the next solver (turbulence) and output. ---*/
+
+  solver->Preprocessing(geometry_fine, solvers_fine, config_zone, MESH_0, NO_RK_ITER, RunTime_EqSystem, true);
+
+  /*--- Compute non-dimensional parameters and the convergence monitor. ---*/
+
+  su2double monitor = 1.0;
+
+  NonDimensional_Parameters(geometry[iZone][iInst], solver_container[iZone][iInst],
+                            numerics_container[iZone][iInst], config_zone,
+                            MESH_0, RunTime_EqSystem, &monitor);
+
+  } // end SU2_OMP_PARALLEL
+
+}
+
+void CNewtonIntegration::MatrixFreeProduct(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) {
+
+  CSolver* solver = solvers_fine[FLOW_SOL];
+  CVariable* nodes = solver->GetNodes();
+
+  const auto nVar = solver->GetnVar();
+  const auto nPointDomain = geometry_fine->GetnPointDomain();
+#ifdef HAVE_OMP
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_num_threads(), OMP_MAX_SIZE);
+#endif
+
+  /*--- Step of the finite differences (the norm is a collective operation). ---*/
+
+  const su2double normU = u.norm();
+
+  if (normU == 0.0) {
+    v = ScalarType(0.0);
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  const su2double eps = FD_Scale / normU;
+
+  /*--- Perturb the solution about the linearization point, U = U_old + eps*u. ---*/
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+    for (auto iVar = 0u; iVar < nVar; iVar++)
+      nodes->SetSolution(iPoint, iVar, nodes->GetSolution_Old(iPoint,iVar) + eps*u(iPoint,iVar));
+
+  SU2_OMP_MASTER
+  {
+    solver->InitiateComms(geometry_fine, config_zone, SOLUTION);
+    solver->CompleteComms(geometry_fine, config_zone, SOLUTION);
+  }
+  SU2_OMP_BARRIER
+
+  /*--- Residual of the perturbed state (primitives, gradients, limiters, fluxes, and boundary conditions). ---*/
+
+  solver->Preprocessing(geometry_fine, solvers_fine, config_zone, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+
+  Space_Integration(geometry_fine, solvers_fine, numerics_fine, config_zone, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
+
+  /*--- v = (R(U+eps*u) - R(U)) / eps + Vol/dt * u, with the same treatment of dt = 0 as PrepareImplicitIteration. ---*/
+
+  const auto& LinSysRes = solver->LinSysRes;
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    const su2double Delta_Time = nodes->GetDelta_Time(iPoint);
+
+    if (Delta_Time != 0.0) {
+      const su2double Vol = geometry_fine->node[iPoint]->GetVolume() + geometry_fine->node[iPoint]->GetPeriodicVolume();
+      const su2double Delta = Vol / Delta_Time;
+
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        v(iPoint,iVar) = SU2_TYPE::GetValue((LinSysRes(iPoint,iVar) - Residual_0(iPoint,iVar)) / eps + Delta * u(iPoint,iVar));
+    }
+    else {
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        v(iPoint,iVar) = u(iPoint,iVar);
+    }
+  }
+
+  /*--- Values at the halo points, as for the product with the matrix. ---*/
+
+  SU2_OMP_MASTER
+  {
+    solver->Jacobian.InitiateComms(v, geometry_fine, config_zone, SOLUTION_MATRIX);
+    solver->Jacobian.CompleteComms(v, geometry_fine, config_zone, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+
+}
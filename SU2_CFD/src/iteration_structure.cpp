@@ -321,6 +321,12 @@ void CIteration::SetGrid_Movement(CGeometry **geometry,
     grid_movement->UpdateMultiGrid(geometry, config);
 
   }
+
+  /*--- Update the wall distance of the turbulence model for the new grid. ---*/
+
+  if (config->GetIncremental_WallDistance() && (config->GetKind_Turb_Model() != NONE))
+    geometry[MESH_0]->ComputeWall_Distance(config);
+
 }
 
 void CIteration::SetMesh_Deformation(CGeometry **geometry,
@@ -353,6 +359,11 @@ void CIteration::SetMesh_Deformation(CGeometry **geometry,
       /*--- Start recording if it was stopped ---*/
       AD::StartRecording();
     }
+
+    /*--- Update the wall distance of the turbulence model for the new grid. ---*/
+
+    if (config->GetIncremental_WallDistance() && (config->GetKind_Turb_Model() != NONE))
+      geometry[MESH_0]->ComputeWall_Distance(config);
   }
 
 }
@@ -279,7 +279,7 @@ void CNumerics::GetInviscidProjFlux(su2double *val_density,
                                     su2double *val_velocity,
                                     su2double *val_pressure,
                                     su2double *val_enthalpy,
-                                    su2double *val_normal,
+                                    const su2double *val_normal,
                                     su2double *val_Proj_Flux) {
 
   su2double rhou, rhov, rhow;
@@ -333,7 +333,7 @@ void CNumerics::GetInviscidIncProjFlux(su2double *val_density,
                                            su2double *val_pressure,
                                            su2double *val_betainc2,
                                            su2double *val_enthalpy,
-                                           su2double *val_normal,
+                                           const su2double *val_normal,
                                            su2double *val_Proj_Flux) {
   su2double rhou, rhov, rhow;
 
@@ -361,7 +361,7 @@ void CNumerics::GetInviscidIncProjFlux(su2double *val_density,
 }
 
 void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_energy,
-                                   su2double *val_normal, su2double val_scale,
+                                   const su2double *val_normal, su2double val_scale,
                                    su2double **val_Proj_Jac_Tensor) {
   AD_BEGIN_PASSIVE
   unsigned short iDim, jDim;
@@ -397,10 +397,237 @@ void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_energ
   AD_END_PASSIVE
 }
 
+void CNumerics::GetInviscidProjFluxBatch(const CEdgeBatch::Scalar& density, const CEdgeBatch::Vector& velocity,
+                                         const CEdgeBatch::Scalar& pressure, const CEdgeBatch::Scalar& enthalpy,
+                                         const CEdgeBatch::Vector& normal, su2double scale,
+                                         CEdgeBatch::Scalar* flux) const {
+  constexpr auto W = CEdgeBatch::WIDTH;
+  unsigned short iDim;
+
+  CEdgeBatch::Scalar mdot;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) mdot[k] = 0.0;
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k)
+      mdot[k] += density[k]*velocity[iDim][k]*normal[iDim][k];
+  }
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    flux[0][k] += scale*mdot[k];
+    flux[nDim+1][k] += scale*mdot[k]*enthalpy[k];
+  }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k)
+      flux[iDim+1][k] += scale*(mdot[k]*velocity[iDim][k] + pressure[k]*normal[iDim][k]);
+  }
+}
+
+void CNumerics::GetInviscidProjJacBatch(const CEdgeBatch::Vector& velocity, const CEdgeBatch::Scalar& energy,
+                                        const CEdgeBatch::Vector& normal, su2double scale,
+                                        CEdgeBatch::Matrix& jacobian) const {
+  AD_BEGIN_PASSIVE
+  constexpr auto W = CEdgeBatch::WIDTH;
+  unsigned short iDim, jDim;
+
+  CEdgeBatch::Scalar proj_vel, phi, a1;
+  const su2double a2 = Gamma-1.0;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    su2double sqvel = 0.0;
+    proj_vel[k] = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      sqvel       += velocity[iDim][k]*velocity[iDim][k];
+      proj_vel[k] += velocity[iDim][k]*normal[iDim][k];
+    }
+    phi[k] = 0.5*Gamma_Minus_One*sqvel;
+    a1[k] = Gamma*energy[k]-phi[k];
+  }
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    jacobian[0][0][k] = 0.0;
+    jacobian[0][nDim+1][k] = 0.0;
+    jacobian[nDim+1][0][k] = scale*proj_vel[k]*(phi[k]-a1[k]);
+    jacobian[nDim+1][nDim+1][k] = scale*Gamma*proj_vel[k];
+  }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) {
+      jacobian[0][iDim+1][k] = scale*normal[iDim][k];
+      jacobian[iDim+1][0][k] = scale*(normal[iDim][k]*phi[k] - velocity[iDim][k]*proj_vel[k]);
+      jacobian[iDim+1][nDim+1][k] = scale*a2*normal[iDim][k];
+      jacobian[nDim+1][iDim+1][k] = scale*(normal[iDim][k]*a1[k] - a2*velocity[iDim][k]*proj_vel[k]);
+    }
+    for (jDim = 0; jDim < nDim; jDim++) {
+      SU2_OMP_SIMD
+      for (size_t k = 0; k < W; ++k)
+        jacobian[iDim+1][jDim+1][k] = scale*(normal[jDim][k]*velocity[iDim][k] - a2*normal[iDim][k]*velocity[jDim][k]);
+    }
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k)
+      jacobian[iDim+1][iDim+1][k] += scale*proj_vel[k];
+  }
+  AD_END_PASSIVE
+}
+
+void CNumerics::GetRoeDissipationBatch(const CEdgeBatch::Scalar& density, const CEdgeBatch::Vector& velocity,
+                                       const CEdgeBatch::Scalar& enthalpy, const CEdgeBatch::Scalar& soundSpeed,
+                                       const CEdgeBatch::Vector& unitNormal, const CEdgeBatch::Scalar* lambda,
+                                       const CEdgeBatch::Scalar* delta, CEdgeBatch::Scalar* result) const {
+  constexpr auto W = CEdgeBatch::WIDTH;
+  unsigned short iDim;
+
+  /*--- Wave strengths of the increment, linearized about the Roe state. ---*/
+
+  CEdgeBatch::Vector delta_vel;
+  CEdgeBatch::Scalar sq_vel, proj_vel, proj_delta_vel, vel_dot_delta_vel, alpha_0, alpha_p, alpha_m;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    sq_vel[k] = 0.0; proj_vel[k] = 0.0; proj_delta_vel[k] = 0.0; vel_dot_delta_vel[k] = 0.0;
+    su2double vel_dot_delta_mom = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      delta_vel[iDim][k] = (delta[iDim+1][k] - velocity[iDim][k]*delta[0][k]) / density[k];
+      sq_vel[k] += velocity[iDim][k]*velocity[iDim][k];
+      proj_vel[k] += velocity[iDim][k]*unitNormal[iDim][k];
+      proj_delta_vel[k] += delta_vel[iDim][k]*unitNormal[iDim][k];
+      vel_dot_delta_vel[k] += velocity[iDim][k]*delta_vel[iDim][k];
+      vel_dot_delta_mom += velocity[iDim][k]*delta[iDim+1][k];
+    }
+    const su2double delta_p = Gamma_Minus_One*(delta[nDim+1][k] - vel_dot_delta_mom + 0.5*sq_vel[k]*delta[0][k]);
+    const su2double sq_c = soundSpeed[k]*soundSpeed[k];
+    const su2double rho_c = density[k]*soundSpeed[k];
+
+    alpha_0[k] = lambda[0][k]*(delta[0][k] - delta_p/sq_c);
+    alpha_p[k] = lambda[1][k]*(delta_p + rho_c*proj_delta_vel[k]) / (2.0*sq_c);
+    alpha_m[k] = lambda[2][k]*(delta_p - rho_c*proj_delta_vel[k]) / (2.0*sq_c);
+  }
+
+  /*--- Sum of the waves times their right eigenvectors. ---*/
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    const su2double c_un = soundSpeed[k]*proj_vel[k];
+
+    result[0][k] = alpha_0[k] + alpha_p[k] + alpha_m[k];
+
+    result[nDim+1][k] = alpha_0[k]*0.5*sq_vel[k] +
+                        lambda[0][k]*density[k]*(vel_dot_delta_vel[k] - proj_vel[k]*proj_delta_vel[k]) +
+                        alpha_p[k]*(enthalpy[k] + c_un) + alpha_m[k]*(enthalpy[k] - c_un);
+  }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) {
+      const su2double c_n = soundSpeed[k]*unitNormal[iDim][k];
+
+      result[iDim+1][k] = alpha_0[k]*velocity[iDim][k] +
+                          lambda[0][k]*density[k]*(delta_vel[iDim][k] - proj_delta_vel[k]*unitNormal[iDim][k]) +
+                          alpha_p[k]*(velocity[iDim][k] + c_n) + alpha_m[k]*(velocity[iDim][k] - c_n);
+    }
+  }
+}
+
+void CNumerics::AddRoeDissipationJacBatch(const CEdgeBatch::Scalar& density, const CEdgeBatch::Vector& velocity,
+                                          const CEdgeBatch::Scalar& enthalpy, const CEdgeBatch::Scalar& soundSpeed,
+                                          const CEdgeBatch::Vector& unitNormal, const CEdgeBatch::Scalar* lambda,
+                                          const CEdgeBatch::Scalar& scale, CEdgeBatch& batch) const {
+  AD_BEGIN_PASSIVE
+  constexpr auto W = CEdgeBatch::WIDTH;
+  unsigned short iVar, jVar;
+
+  /*--- Build |A| one column at a time, by applying it to the unit vectors. ---*/
+
+  CEdgeBatch::Scalar unit[CEdgeBatch::MAXNVAR], column[CEdgeBatch::MAXNVAR];
+
+  for (jVar = 0; jVar < nVar; jVar++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      SU2_OMP_SIMD
+      for (size_t k = 0; k < W; ++k) unit[iVar][k] = su2double(iVar == jVar);
+    }
+
+    GetRoeDissipationBatch(density, velocity, enthalpy, soundSpeed, unitNormal, lambda, unit, column);
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      SU2_OMP_SIMD
+      for (size_t k = 0; k < W; ++k) {
+        batch.Jacobian_i[iVar][jVar][k] += scale[k]*column[iVar][k];
+        batch.Jacobian_j[iVar][jVar][k] -= scale[k]*column[iVar][k];
+      }
+    }
+  }
+  AD_END_PASSIVE
+}
+
+void CNumerics::ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) {
+
+  /*--- The inputs of the lanes are copied to local arrays, the pointers set by the caller are
+   *    restored at the end such that they do not point to these arrays after returning. ---*/
+
+  const su2double* Normal_old = Normal;
+  su2double *V_i_old = V_i, *V_j_old = V_j, *S_i_old = S_i, *S_j_old = S_j;
+
+  su2double normal[CEdgeBatch::MAXNDIM] = {0.0};
+  su2double prim_i[CEdgeBatch::MAXNPRIM] = {0.0}, prim_j[CEdgeBatch::MAXNPRIM] = {0.0};
+  su2double sec_i[2] = {0.0}, sec_j[2] = {0.0};
+
+  SetNormal(normal);
+  SetPrimitive(prim_i, prim_j);
+  SetSecondary(sec_i, sec_j);
+
+  /*--- Secondaries (dP/drho_e, dP/de_rho) of the ideal gas, the only model the batches are used for. ---*/
+
+  auto idealGasSecondary = [this](const su2double* prim, su2double* sec) {
+    su2double sqvel = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) sqvel += pow(prim[iDim+1], 2);
+    const su2double staticEnergy = prim[nDim+3] - prim[nDim+1]/prim[nDim+2] - 0.5*sqvel;
+    sec[0] = Gamma_Minus_One*staticEnergy;
+    sec[1] = Gamma_Minus_One*prim[nDim+2];
+  };
+
+  for (unsigned short iLane = 0; iLane < batch.nLane; ++iLane) {
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      normal[iDim] = batch.Normal[iDim][iLane];
+
+    for (unsigned short iVar = 0; iVar < nDim+4; iVar++) {
+      prim_i[iVar] = batch.V_i[iVar][iLane];
+      prim_j[iVar] = batch.V_j[iVar][iLane];
+    }
+
+    idealGasSecondary(prim_i, sec_i);
+    idealGasSecondary(prim_j, sec_j);
+
+    auto residual = ComputeResidual(config);
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      batch.Flux[iVar][iLane] = residual.residual[iVar];
+      if (residual.jacobian_i == nullptr) continue;
+      for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+        batch.Jacobian_i[iVar][jVar][iLane] = residual.jacobian_i[iVar][jVar];
+        batch.Jacobian_j[iVar][jVar][iLane] = residual.jacobian_j[iVar][jVar];
+      }
+    }
+  }
+
+  SetNormal(Normal_old);
+  SetPrimitive(V_i_old, V_j_old);
+  SetSecondary(S_i_old, S_j_old);
+
+}
+
 
 void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_enthalpy,
     su2double *val_chi, su2double *val_kappa,
-    su2double *val_normal, su2double val_scale,
+    const su2double *val_normal, su2double val_scale,
     su2double **val_Proj_Jac_Tensor) {
   AD_BEGIN_PASSIVE
   unsigned short iDim, jDim;
@@ -436,7 +663,7 @@ void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_entha
   AD_END_PASSIVE
 }
 
-void CNumerics::GetInviscidIncProjJac(su2double *val_density, su2double *val_velocity, su2double *val_betainc2, su2double *val_cp, su2double *val_temperature, su2double *val_dRhodT, su2double *val_normal,
+void CNumerics::GetInviscidIncProjJac(su2double *val_density, su2double *val_velocity, su2double *val_betainc2, su2double *val_cp, su2double *val_temperature, su2double *val_dRhodT, const su2double *val_normal,
     su2double val_scale, su2double **val_Proj_Jac_Tensor) {
   AD_BEGIN_PASSIVE
   unsigned short iDim;
@@ -531,7 +758,7 @@ void CNumerics::GetPreconditioner(su2double *val_density, su2double *val_velocit
 }
 
 void CNumerics::GetPreconditionedProjJac(su2double *val_density, su2double *val_lambda,
-                                         su2double *val_betainc2, su2double *val_normal, su2double **val_invPrecon_A) {
+                                         su2double *val_betainc2, const su2double *val_normal, su2double **val_invPrecon_A) {
   unsigned short iDim, jDim, kDim;
 
   val_invPrecon_A[0][0] = val_lambda[nDim]/2.0 + val_lambda[nDim+1]/2.0;
@@ -563,7 +790,7 @@ void CNumerics::GetPreconditionedProjJac(su2double *val_density, su2double *val_
 }
 
 void CNumerics::GetPMatrix(su2double *val_density, su2double *val_velocity,
-                           su2double *val_soundspeed, su2double *val_normal, su2double **val_p_tensor) {
+                           su2double *val_soundspeed, const su2double *val_normal, su2double **val_p_tensor) {
 
   su2double sqvel, rhooc, rhoxc;
   //su2double c2;
@@ -637,7 +864,7 @@ void CNumerics::GetPMatrix(su2double *val_density, su2double *val_velocity,
 
 void CNumerics::GetPMatrix(su2double *val_density, su2double *val_velocity, su2double *val_soundspeed,
                            su2double *val_enthalpy, su2double *val_chi, su2double *val_kappa,
-                           su2double *val_normal, su2double **val_p_tensor) {
+                           const su2double *val_normal, su2double **val_p_tensor) {
 
   su2double sqvel, rhooc, zeta;
   //su2double rhoxc, c2;
@@ -708,7 +935,7 @@ void CNumerics::GetPMatrix(su2double *val_density, su2double *val_velocity, su2d
 }
 
 void CNumerics::GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
-                               su2double *val_soundspeed, su2double *val_normal,
+                               su2double *val_soundspeed, const su2double *val_normal,
                                su2double **val_invp_tensor) {
 
   su2double rhoxc, c2, gm1, k0orho, k1orho, gm1_o_c2, gm1_o_rhoxc, sqvel;
@@ -785,7 +1012,7 @@ void CNumerics::GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
 
 void CNumerics::GetPMatrix_inv(su2double **val_invp_tensor, su2double *val_density,
                                su2double *val_velocity, su2double *val_soundspeed,
-                               su2double *val_chi, su2double *val_kappa, su2double *val_normal) {
+                               su2double *val_chi, su2double *val_kappa, const su2double *val_normal) {
 
   su2double rhoxc, c2, k0orho, k1orho, sqvel, k_o_c2, k_o_rhoxc, dp_drho;
 
@@ -1257,7 +1484,7 @@ void CNumerics::GetCharJump(su2double val_soundspeed, su2double val_density, su2
 }
 
 void CNumerics::GetPrecondJacobian(su2double Beta2, su2double r_hat, su2double s_hat, su2double t_hat,
-                                   su2double rB2a2, su2double* Lambda, su2double *val_normal, su2double **val_absPeJac) {
+                                   su2double rB2a2, su2double* Lambda, const su2double *val_normal, su2double **val_absPeJac) {
 
   su2double lam1, lam2, lam3, lam4;
   lam1 = Lambda[0]; lam2 = Lambda[1]; lam3 = Lambda[2]; lam4 = Lambda[3];
@@ -1324,7 +1551,7 @@ void CNumerics::GetPrecondJacobian(su2double Beta2, su2double r_hat, su2double s
 }
 
 void CNumerics::GetJacInviscidLambda_fabs(su2double *val_velocity, su2double val_soundspeed,
-    su2double *val_normal, su2double *val_Lambda_Vector) {
+    const su2double *val_normal, su2double *val_Lambda_Vector) {
   su2double ProjVelocity = 0;
 
   for (unsigned short iDim = 0; iDim < nDim; iDim++)
@@ -1349,7 +1576,7 @@ void CNumerics::GetAdjViscousFlux_Jac(su2double Pressure_i, su2double Pressure_j
                                       su2double ViscDens_i, su2double ViscDens_j, su2double *Velocity_i, su2double *Velocity_j,
                                       su2double sq_vel_i, su2double sq_vel_j,
                                       su2double XiDens_i, su2double XiDens_j, su2double **Mean_GradPhi, su2double *Mean_GradPsiE,
-                                      su2double dPhiE_dn, su2double *Normal, su2double *Edge_Vector, su2double dist_ij_2, su2double *val_residual_i, su2double *val_residual_j,
+                                      su2double dPhiE_dn, const su2double *Normal, su2double *Edge_Vector, su2double dist_ij_2, su2double *val_residual_i, su2double *val_residual_j,
                                       su2double **val_Jacobian_ii, su2double **val_Jacobian_ij, su2double **val_Jacobian_ji,
                                       su2double **val_Jacobian_jj, bool implicit) {
 
@@ -234,6 +234,87 @@ void CFEALinearElasticity::Compute_Constitutive_Matrix(CElement *element_contain
 }
 
 
+void CFEALinearElasticity::Compute_Stiffness_Product(CElement *element, const su2double *nodalVector,
+                                                     const CConfig *config) {
+
+  unsigned short iVar, jVar, iGauss, iNode, iDim;
+
+  /*--- Auxiliary vectors, Voigt notation. ---*/
+  su2double Strain[6], Stress[6], Force[3];
+
+  /*--- Set element properties and recompute the constitutive matrix (see Compute_Tangent_Matrix). ---*/
+  SetElement_Properties(element, config);
+  Compute_Lame_Parameters();
+  Compute_Constitutive_Matrix(element, config);
+
+  const unsigned short bDim = (nDim == 2) ? DIM_STRAIN_2D : DIM_STRAIN_3D;
+
+  element->ClearElement();
+  element->ComputeGrad_Linear();
+  const unsigned short nNode = element->GetnNodes();
+  const unsigned short nGauss = element->GetnGaussPoints();
+
+  for (iGauss = 0; iGauss < nGauss; iGauss++) {
+
+    const su2double WeightJac = element->GetWeight(iGauss) * element->GetJ_X(iGauss);
+
+    for (iNode = 0; iNode < nNode; iNode++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        GradNi_Ref_Mat[iNode][iDim] = element->GetGradNi_X(iNode,iGauss,iDim);
+
+    /*--- Strain as B*v, with the same ordering of components as Ba_Mat. ---*/
+
+    for (iVar = 0; iVar < bDim; iVar++) Strain[iVar] = 0.0;
+
+    for (iNode = 0; iNode < nNode; iNode++) {
+      const su2double* grad = GradNi_Ref_Mat[iNode];
+      const su2double* v = &nodalVector[iNode*nDim];
+
+      if (nDim == 2) {
+        Strain[0] += grad[0]*v[0];
+        Strain[1] += grad[1]*v[1];
+        Strain[2] += grad[1]*v[0] + grad[0]*v[1];
+      }
+      else {
+        Strain[0] += grad[0]*v[0];
+        Strain[1] += grad[1]*v[1];
+        Strain[2] += grad[2]*v[2];
+        Strain[3] += grad[1]*v[0] + grad[0]*v[1];
+        Strain[4] += grad[2]*v[0] + grad[0]*v[2];
+        Strain[5] += grad[2]*v[1] + grad[1]*v[2];
+      }
+    }
+
+    /*--- Stress as D*epsilon, scaled by the integration weight. ---*/
+
+    for (iVar = 0; iVar < bDim; iVar++) {
+      Stress[iVar] = 0.0;
+      for (jVar = 0; jVar < bDim; jVar++)
+        Stress[iVar] += D_Mat[iVar][jVar]*Strain[jVar];
+      Stress[iVar] *= WeightJac;
+    }
+
+    /*--- Nodal forces as B^T*sigma. ---*/
+
+    for (iNode = 0; iNode < nNode; iNode++) {
+      const su2double* grad = GradNi_Ref_Mat[iNode];
+
+      if (nDim == 2) {
+        Force[0] = grad[0]*Stress[0] + grad[1]*Stress[2];
+        Force[1] = grad[1]*Stress[1] + grad[0]*Stress[2];
+      }
+      else {
+        Force[0] = grad[0]*Stress[0] + grad[1]*Stress[3] + grad[2]*Stress[4];
+        Force[1] = grad[1]*Stress[1] + grad[0]*Stress[3] + grad[2]*Stress[5];
+        Force[2] = grad[2]*Stress[2] + grad[0]*Stress[4] + grad[1]*Stress[5];
+      }
+      element->Add_Kt_a(iNode, Force);
+    }
+
+  }
+
+}
+
 void CFEALinearElasticity::Compute_Averaged_NodalStress(CElement *element, const CConfig *config) {
 
   unsigned short iVar, jVar;
@@ -967,3 +967,125 @@ CNumerics::ResidualType<> CUpwAUSM_Flow::ComputeResidual(const CConfig* config)
 
   return ResidualType<>(Flux, Jacobian_i, Jacobian_j);
 }
+
+void CUpwAUSM_Flow::ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) {
+
+  constexpr auto W = CEdgeBatch::WIDTH;
+  unsigned short iDim;
+
+  const auto& V_i = batch.V_i;
+  const auto& V_j = batch.V_j;
+
+  /*--- Face area and unit normal. ---*/
+
+  CEdgeBatch::Scalar area;
+  CEdgeBatch::Vector unitNormal;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    area[k] = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      area[k] += pow(batch.Normal[iDim][k], 2);
+    area[k] = sqrt(area[k]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      unitNormal[iDim][k] = batch.Normal[iDim][k] / area[k];
+  }
+
+  /*--- Split Mach numbers and pressures. ---*/
+
+  CEdgeBatch::Vector vel_i, vel_j;
+  CEdgeBatch::Scalar energy_i, energy_j, rhoc_i, rhoc_j, mF, pF;
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) {
+      vel_i[iDim][k] = V_i[iDim+1][k];
+      vel_j[iDim][k] = V_j[iDim+1][k];
+    }
+  }
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    su2double sq_vel_i = 0.0, sq_vel_j = 0.0, projVel_i = 0.0, projVel_j = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      sq_vel_i += vel_i[iDim][k]*vel_i[iDim][k];
+      sq_vel_j += vel_j[iDim][k]*vel_j[iDim][k];
+      projVel_i += vel_i[iDim][k]*unitNormal[iDim][k];
+      projVel_j += vel_j[iDim][k]*unitNormal[iDim][k];
+    }
+    const su2double pressure_i = V_i[nDim+1][k], density_i = V_i[nDim+2][k];
+    const su2double pressure_j = V_j[nDim+1][k], density_j = V_j[nDim+2][k];
+
+    energy_i[k] = V_i[nDim+3][k] - pressure_i/density_i;
+    energy_j[k] = V_j[nDim+3][k] - pressure_j/density_j;
+
+    const su2double soundSpeed_i = sqrt(fabs(Gamma*Gamma_Minus_One*(energy_i[k]-0.5*sq_vel_i)));
+    const su2double soundSpeed_j = sqrt(fabs(Gamma*Gamma_Minus_One*(energy_j[k]-0.5*sq_vel_j)));
+
+    rhoc_i[k] = density_i*soundSpeed_i;
+    rhoc_j[k] = density_j*soundSpeed_j;
+
+    const su2double mL = projVel_i/soundSpeed_i;
+    const su2double mR = projVel_j/soundSpeed_j;
+    const bool subsonic_L = (fabs(mL) <= 1.0);
+    const bool subsonic_R = (fabs(mR) <= 1.0);
+
+    const su2double mLP = subsonic_L? 0.25*(mL+1.0)*(mL+1.0) : 0.5*(mL+fabs(mL));
+    const su2double mRM = subsonic_R? -0.25*(mR-1.0)*(mR-1.0) : 0.5*(mR-fabs(mR));
+    mF[k] = mLP + mRM;
+
+    const su2double pLP = subsonic_L? 0.25*pressure_i*(mL+1.0)*(mL+1.0)*(2.0-mL) : 0.5*pressure_i*(mL+fabs(mL))/mL;
+    const su2double pRM = subsonic_R? 0.25*pressure_j*(mR-1.0)*(mR-1.0)*(2.0+mR) : 0.5*pressure_j*(mR-fabs(mR))/mR;
+    pF[k] = pLP + pRM;
+  }
+
+  /*--- Flux, the mass flux part is 0.5*(mF*(f_i+f_j) - |mF|*(f_j-f_i)). ---*/
+
+  auto massFlux = [&](size_t k, const su2double& f_i, const su2double& f_j) {
+    return 0.5*(mF[k]*(rhoc_i[k]*f_i + rhoc_j[k]*f_j) - fabs(mF[k])*(rhoc_j[k]*f_j - rhoc_i[k]*f_i));
+  };
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    batch.Flux[0][k] = massFlux(k, 1.0, 1.0) * area[k];
+    batch.Flux[nVar-1][k] = massFlux(k, V_i[nDim+3][k], V_j[nDim+3][k]) * area[k];
+  }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k)
+      batch.Flux[iDim+1][k] = (massFlux(k, vel_i[iDim][k], vel_j[iDim][k]) + unitNormal[iDim][k]*pF[k]) * area[k];
+  }
+
+  if (!implicit) return;
+
+  /*--- Roe's Jacobian for AUSM, 0.5*(A_i, A_j) +/- 0.5*|A|*Area, without entropy fix. ---*/
+
+  CEdgeBatch::Scalar roeDensity, roeEnthalpy, roeSoundSpeed, lambda[3], scale;
+  CEdgeBatch::Vector roeVelocity;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    const su2double R = sqrt(fabs(V_j[nDim+2][k]/V_i[nDim+2][k]));
+    roeDensity[k] = R*V_i[nDim+2][k];
+    su2double sq_vel = 0.0, projVel = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      roeVelocity[iDim][k] = (R*vel_j[iDim][k]+vel_i[iDim][k])/(R+1);
+      sq_vel += roeVelocity[iDim][k]*roeVelocity[iDim][k];
+      projVel += roeVelocity[iDim][k]*unitNormal[iDim][k];
+    }
+    roeEnthalpy[k] = (R*V_j[nDim+3][k]+V_i[nDim+3][k])/(R+1);
+    roeSoundSpeed[k] = sqrt(fabs((Gamma-1)*(roeEnthalpy[k]-0.5*sq_vel)));
+
+    lambda[0][k] = fabs(projVel);
+    lambda[1][k] = fabs(projVel + roeSoundSpeed[k]);
+    lambda[2][k] = fabs(projVel - roeSoundSpeed[k]);
+    scale[k] = 0.5*area[k];
+  }
+
+  GetInviscidProjJacBatch(vel_i, energy_i, batch.Normal, 0.5, batch.Jacobian_i);
+  GetInviscidProjJacBatch(vel_j, energy_j, batch.Normal, 0.5, batch.Jacobian_j);
+
+  AddRoeDissipationJacBatch(roeDensity, roeVelocity, roeEnthalpy, roeSoundSpeed,
+                            unitNormal, lambda, scale, batch);
+}
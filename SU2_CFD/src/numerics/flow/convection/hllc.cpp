@@ -555,6 +555,112 @@ CNumerics::ResidualType<> CUpwHLLC_Flow::ComputeResidual(const CConfig* config)
 
 }
 
+void CUpwHLLC_Flow::ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) {
+
+  if (implicit || dynamic_grid) {
+    CNumerics::ComputeResidualBatch(batch, config);
+    return;
+  }
+
+  constexpr auto W = CEdgeBatch::WIDTH;
+
+  const auto& V_i = batch.V_i;
+  const auto& V_j = batch.V_j;
+
+  /*--- Wave speeds and state (left or right, star or not) from which the flux is computed. ---*/
+
+  CEdgeBatch::Scalar area, sM, pStar, factor, sMinusU, projVel;
+  CEdgeBatch::Scalar density, pressure, enthalpy, energy;
+  CEdgeBatch::Vector unitNormal, velocity;
+  bool starState[W];
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    area[k] = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      area[k] += pow(batch.Normal[iDim][k], 2);
+    area[k] = sqrt(area[k]);
+
+    su2double sq_vel_i = 0.0, sq_vel_j = 0.0, projVel_i = 0.0, projVel_j = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      unitNormal[iDim][k] = batch.Normal[iDim][k] / area[k];
+      sq_vel_i += pow(V_i[iDim+1][k], 2);
+      sq_vel_j += pow(V_j[iDim+1][k], 2);
+      projVel_i += V_i[iDim+1][k]*unitNormal[iDim][k];
+      projVel_j += V_j[iDim+1][k]*unitNormal[iDim][k];
+    }
+    const su2double pressure_i = V_i[nDim+1][k], density_i = V_i[nDim+2][k], enthalpy_i = V_i[nDim+3][k];
+    const su2double pressure_j = V_j[nDim+1][k], density_j = V_j[nDim+2][k], enthalpy_j = V_j[nDim+3][k];
+
+    const su2double soundSpeed_i = sqrt((enthalpy_i - 0.5*sq_vel_i) * Gamma_Minus_One);
+    const su2double soundSpeed_j = sqrt((enthalpy_j - 0.5*sq_vel_j) * Gamma_Minus_One);
+
+    /*--- Roe's averaging. ---*/
+
+    const su2double sqrtRho_i = sqrt(density_i), sqrtRho_j = sqrt(density_j);
+    const su2double Rrho = sqrtRho_i + sqrtRho_j;
+
+    su2double sq_velRoe = 0.0, roeProjVel = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const su2double roeVel = (V_i[iDim+1][k]*sqrtRho_i + V_j[iDim+1][k]*sqrtRho_j) / Rrho;
+      sq_velRoe += roeVel*roeVel;
+      roeProjVel += roeVel*unitNormal[iDim][k];
+    }
+    const su2double roeEnthalpy = (sqrtRho_j*enthalpy_j + sqrtRho_i*enthalpy_i) / Rrho;
+    const su2double roeSoundSpeed = sqrt(Gamma_Minus_One*(roeEnthalpy - 0.5*sq_velRoe));
+
+    /*--- Speed of the left and right waves and of the contact surface. ---*/
+
+    const su2double sL = min(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const su2double sR = max(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    const su2double RHO = density_j*(sR - projVel_j) - density_i*(sL - projVel_i);
+    sM[k] = (pressure_i - pressure_j - density_i*projVel_i*(sL - projVel_i) +
+             density_j*projVel_j*(sR - projVel_j)) / RHO;
+    pStar[k] = density_j*(projVel_j - sR)*(projVel_j - sM[k]) + pressure_j;
+
+    /*--- Select the side of the contact, and whether the star state is used. ---*/
+
+    const bool left = (sM[k] > 0.0);
+    const su2double s = left? sL : sR;
+    starState[k] = left? (sL <= 0.0) : (sR >= 0.0);
+
+    density[k]  = left? density_i  : density_j;
+    pressure[k] = left? pressure_i : pressure_j;
+    enthalpy[k] = left? enthalpy_i : enthalpy_j;
+    projVel[k]  = left? projVel_i  : projVel_j;
+    energy[k] = enthalpy[k] - pressure[k]/density[k];
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      velocity[iDim][k] = left? V_i[iDim+1][k] : V_j[iDim+1][k];
+
+    sMinusU[k] = s - projVel[k];
+    factor[k] = sMinusU[k] / (s - sM[k]);
+  }
+
+  /*--- Flux of the selected state, F(U) or F(U*) = sM*U* + pStar*(0, n, 0). ---*/
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    const su2double mdot = density[k]*projVel[k];
+    const su2double starMass = factor[k]*density[k];
+    const su2double starEnergy = factor[k]*(density[k]*energy[k] - (pressure[k]*projVel[k] - pStar[k]*sM[k]) / sMinusU[k]);
+
+    batch.Flux[0][k] = area[k] * (starState[k]? sM[k]*starMass : mdot);
+    batch.Flux[nVar-1][k] = area[k] * (starState[k]? sM[k]*(starEnergy + pStar[k]) : mdot*enthalpy[k]);
+  }
+
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) {
+      const su2double starMom = factor[k]*(density[k]*velocity[iDim][k] + (pStar[k]-pressure[k]) / sMinusU[k]*unitNormal[iDim][k]);
+
+      batch.Flux[iDim+1][k] = area[k] * (starState[k]? sM[k]*starMom + pStar[k]*unitNormal[iDim][k] :
+                                         density[k]*velocity[iDim][k]*projVel[k] + pressure[k]*unitNormal[iDim][k]);
+    }
+  }
+
+}
+
 CUpwGeneralHLLC_Flow::CUpwGeneralHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
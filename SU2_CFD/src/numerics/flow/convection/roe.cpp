@@ -291,6 +291,135 @@ void CUpwRoe_Flow::FinalizeResidual(su2double *val_residual, su2double **val_Jac
 
 }
 
+void CUpwRoe_Flow::ComputeResidualBatch(CEdgeBatch& batch, const CConfig* config) {
+
+  if (roe_low_dissipation || dynamic_grid) {
+    CNumerics::ComputeResidualBatch(batch, config);
+    return;
+  }
+
+  constexpr auto W = CEdgeBatch::WIDTH;
+  const su2double entropyFix = config->GetEntropyFix_Coeff();
+  unsigned short iDim, iVar;
+
+  const auto& V_i = batch.V_i;
+  const auto& V_j = batch.V_j;
+
+  /*--- Face area and unit normal. ---*/
+
+  CEdgeBatch::Scalar area;
+  CEdgeBatch::Vector unitNormal;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    area[k] = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      area[k] += pow(batch.Normal[iDim][k], 2);
+    area[k] = sqrt(area[k]);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      unitNormal[iDim][k] = batch.Normal[iDim][k] / area[k];
+  }
+
+  /*--- Primitive and conservative variables at i and j. ---*/
+
+  CEdgeBatch::Vector vel_i, vel_j;
+  CEdgeBatch::Scalar energy_i, energy_j;
+  CEdgeBatch::Scalar U_i[CEdgeBatch::MAXNVAR], U_j[CEdgeBatch::MAXNVAR];
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) {
+      vel_i[iDim][k] = V_i[iDim+1][k];
+      vel_j[iDim][k] = V_j[iDim+1][k];
+      U_i[iDim+1][k] = V_i[nDim+2][k]*vel_i[iDim][k];
+      U_j[iDim+1][k] = V_j[nDim+2][k]*vel_j[iDim][k];
+    }
+  }
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    energy_i[k] = V_i[nDim+3][k] - V_i[nDim+1][k]/V_i[nDim+2][k];
+    energy_j[k] = V_j[nDim+3][k] - V_j[nDim+1][k]/V_j[nDim+2][k];
+    U_i[0][k] = V_i[nDim+2][k];
+    U_j[0][k] = V_j[nDim+2][k];
+    U_i[nDim+1][k] = V_i[nDim+2][k]*energy_i[k];
+    U_j[nDim+1][k] = V_j[nDim+2][k]*energy_j[k];
+  }
+
+  /*--- Roe-averaged variables and (entropy-fixed) absolute eigenvalues. ---*/
+
+  CEdgeBatch::Scalar roeDensity, roeEnthalpy, roeSoundSpeed, lambda[3];
+  CEdgeBatch::Vector roeVelocity;
+  bool valid[W];
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) {
+    const su2double R = sqrt(fabs(V_j[nDim+2][k]/V_i[nDim+2][k]));
+    roeDensity[k] = R*V_i[nDim+2][k];
+    su2double sq_vel = 0.0, projVel = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      roeVelocity[iDim][k] = (R*vel_j[iDim][k]+vel_i[iDim][k])/(R+1);
+      sq_vel += roeVelocity[iDim][k]*roeVelocity[iDim][k];
+      projVel += roeVelocity[iDim][k]*unitNormal[iDim][k];
+    }
+    roeEnthalpy[k] = (R*V_j[nDim+3][k]+V_i[nDim+3][k])/(R+1);
+    const su2double sq_c = (Gamma-1)*(roeEnthalpy[k]-0.5*sq_vel);
+
+    /*--- Negative RoeSoundSpeed^2, the jump is too large, the lane is cleared below. ---*/
+    valid[k] = (sq_c > 0.0);
+    roeSoundSpeed[k] = sqrt(valid[k]? sq_c : su2double(1.0));
+
+    const su2double maxLambda = entropyFix*(fabs(projVel) + roeSoundSpeed[k]);
+    lambda[0][k] = max(fabs(projVel), maxLambda);
+    lambda[1][k] = max(fabs(projVel + roeSoundSpeed[k]), maxLambda);
+    lambda[2][k] = max(fabs(projVel - roeSoundSpeed[k]), maxLambda);
+  }
+
+  /*--- Central part of the flux, kappa*(fc_i+fc_j)*Normal. ---*/
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) batch.Flux[iVar][k] = 0.0;
+  }
+  GetInviscidProjFluxBatch(V_i[nDim+2], vel_i, V_i[nDim+1], V_i[nDim+3], batch.Normal, kappa, batch.Flux);
+  GetInviscidProjFluxBatch(V_j[nDim+2], vel_j, V_j[nDim+1], V_j[nDim+3], batch.Normal, kappa, batch.Flux);
+
+  /*--- Dissipation, (1-kappa)*|A|*(U_j-U_i)*Area. ---*/
+
+  CEdgeBatch::Scalar diff_U[CEdgeBatch::MAXNVAR], dissipation[CEdgeBatch::MAXNVAR];
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) diff_U[iVar][k] = U_j[iVar][k]-U_i[iVar][k];
+  }
+
+  GetRoeDissipationBatch(roeDensity, roeVelocity, roeEnthalpy, roeSoundSpeed, unitNormal, lambda, diff_U, dissipation);
+
+  CEdgeBatch::Scalar scale;
+
+  SU2_OMP_SIMD
+  for (size_t k = 0; k < W; ++k) scale[k] = (1.0-kappa)*area[k];
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    SU2_OMP_SIMD
+    for (size_t k = 0; k < W; ++k) batch.Flux[iVar][k] -= scale[k]*dissipation[iVar][k];
+  }
+
+  /*--- Jacobians, kappa*(A_i, A_j) +/- (1-kappa)*|A|*Area. ---*/
+
+  if (implicit) {
+    GetInviscidProjJacBatch(vel_i, energy_i, batch.Normal, kappa, batch.Jacobian_i);
+    GetInviscidProjJacBatch(vel_j, energy_j, batch.Normal, kappa, batch.Jacobian_j);
+
+    AddRoeDissipationJacBatch(roeDensity, roeVelocity, roeEnthalpy, roeSoundSpeed,
+                              unitNormal, lambda, scale, batch);
+  }
+
+  for (unsigned short iLane = 0; iLane < batch.nLane; ++iLane)
+    if (!valid[iLane]) batch.ClearLane(iLane, nVar);
+
+}
+
 CUpwL2Roe_Flow::CUpwL2Roe_Flow(unsigned short val_nDim, unsigned short val_nVar, const CConfig* config) :
                 CUpwRoeBase_Flow(val_nDim, val_nVar, config, false) {}
 
@@ -414,6 +414,39 @@ void CFlowCompOutput::SetVolumeOutputFields(CConfig *config){
   }
 }
 
+void CFlowCompOutput::SetVolumeOutputColumns(CConfig *config, CGeometry *geometry, CSolver **solver){
+
+  const CSysVector<su2double>& Res_Flow = solver[FLOW_SOL]->LinSysRes;
+
+  if (nDim == 3){
+    AddVolumeOutputColumns({"DENSITY", "MOMENTUM-X", "MOMENTUM-Y", "MOMENTUM-Z", "ENERGY"},
+                           solver[FLOW_SOL]->GetNodes()->GetSolution());
+    AddVolumeOutputColumns({"RES_DENSITY", "RES_MOMENTUM-X", "RES_MOMENTUM-Y", "RES_MOMENTUM-Z", "RES_ENERGY"},
+                           Res_Flow.data(), Res_Flow.GetNVar());
+  } else {
+    AddVolumeOutputColumns({"DENSITY", "MOMENTUM-X", "MOMENTUM-Y", "ENERGY"},
+                           solver[FLOW_SOL]->GetNodes()->GetSolution());
+    AddVolumeOutputColumns({"RES_DENSITY", "RES_MOMENTUM-X", "RES_MOMENTUM-Y", "RES_ENERGY"},
+                           Res_Flow.data(), Res_Flow.GetNVar());
+  }
+
+  if (config->GetKind_Turb_Model() == NONE) return;
+
+  const CSysVector<su2double>& Res_Turb = solver[TURB_SOL]->LinSysRes;
+
+  switch(config->GetKind_Turb_Model()){
+  case SST: case SST_SUST:
+    AddVolumeOutputColumns({"TKE", "DISSIPATION"}, solver[TURB_SOL]->GetNodes()->GetSolution());
+    AddVolumeOutputColumns({"RES_TKE", "RES_DISSIPATION"}, Res_Turb.data(), Res_Turb.GetNVar());
+    break;
+  case SA: case SA_COMP: case SA_E:
+  case SA_E_COMP: case SA_NEG:
+    AddVolumeOutputColumns({"NU_TILDE"}, solver[TURB_SOL]->GetNodes()->GetSolution());
+    AddVolumeOutputColumns({"RES_NU_TILDE"}, Res_Turb.data(), Res_Turb.GetNVar());
+    break;
+  }
+}
+
 void CFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned long iPoint){
 
   CVariable* Node_Flow = solver[FLOW_SOL]->GetNodes();
@@ -430,29 +463,7 @@ void CFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
   if (nDim == 3)
     SetVolumeOutputValue("COORD-Z", iPoint, Node_Geo->GetCoord(2));
 
-  SetVolumeOutputValue("DENSITY",    iPoint, Node_Flow->GetSolution(iPoint, 0));
-  SetVolumeOutputValue("MOMENTUM-X", iPoint, Node_Flow->GetSolution(iPoint, 1));
-  SetVolumeOutputValue("MOMENTUM-Y", iPoint, Node_Flow->GetSolution(iPoint, 2));
-  if (nDim == 3){
-    SetVolumeOutputValue("MOMENTUM-Z", iPoint, Node_Flow->GetSolution(iPoint, 3));
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, 4));
-  } else {
-    SetVolumeOutputValue("ENERGY",     iPoint, Node_Flow->GetSolution(iPoint, 3));
-  }
-
-  // Turbulent Residuals
-  switch(config->GetKind_Turb_Model()){
-  case SST: case SST_SUST:
-    SetVolumeOutputValue("TKE",         iPoint, Node_Turb->GetSolution(iPoint, 0));
-    SetVolumeOutputValue("DISSIPATION", iPoint, Node_Turb->GetSolution(iPoint, 1));
-    break;
-  case SA: case SA_COMP: case SA_E:
-  case SA_E_COMP: case SA_NEG:
-    SetVolumeOutputValue("NU_TILDE", iPoint, Node_Turb->GetSolution(iPoint, 0));
-    break;
-  case NONE:
-    break;
-  }
+  /*--- The solution and the residuals are set by SetVolumeOutputColumns. ---*/
 
   if (config->GetGrid_Movement()){
     SetVolumeOutputValue("GRID_VELOCITY-X", iPoint, Node_Geo->GetGridVel()[0]);
@@ -484,29 +495,6 @@ void CFlowCompOutput::LoadVolumeData(CConfig *config, CGeometry *geometry, CSolv
     SetVolumeOutputValue("INTERMITTENCY", iPoint, Node_Turb->GetGammaBC(iPoint));
   }
 
-  SetVolumeOutputValue("RES_DENSITY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 0));
-  SetVolumeOutputValue("RES_MOMENTUM-X", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 1));
-  SetVolumeOutputValue("RES_MOMENTUM-Y", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 2));
-  if (nDim == 3){
-    SetVolumeOutputValue("RES_MOMENTUM-Z", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 3));
-    SetVolumeOutputValue("RES_ENERGY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 4));
-  } else {
-    SetVolumeOutputValue("RES_ENERGY", iPoint, solver[FLOW_SOL]->LinSysRes(iPoint, 3));
-  }
-
-  switch(config->GetKind_Turb_Model()){
-  case SST: case SST_SUST:
-    SetVolumeOutputValue("RES_TKE", iPoint, solver[TURB_SOL]->LinSysRes(iPoint, 0));
-    SetVolumeOutputValue("RES_DISSIPATION", iPoint, solver[TURB_SOL]->LinSysRes(iPoint, 1));
-    break;
-  case SA: case SA_COMP: case SA_E:
-  case SA_E_COMP: case SA_NEG:
-    SetVolumeOutputValue("RES_NU_TILDE", iPoint, solver[TURB_SOL]->LinSysRes(iPoint, 0));
-    break;
-  case NONE:
-    break;
-  }
-
   SetVolumeOutputValue("LIMITER_DENSITY",    iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 0));
   SetVolumeOutputValue("LIMITER_MOMENTUM-X", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 1));
   SetVolumeOutputValue("LIMITER_MOMENTUM-Y", iPoint, Node_Flow->GetLimiter_Primitive(iPoint, 2));
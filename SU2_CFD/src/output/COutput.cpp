@@ -40,7 +40,10 @@
 #include "../../include/output/filewriter/CCSVFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
+#include "../../include/output/filewriter/CSU2CompressedFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../include/output/filewriter/CAsyncFileWriter.hpp"
+#include "../../../Common/include/omp_structure.hpp"
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
@@ -160,8 +163,6 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
 
   convergence        = false;
 
-  buildFieldIndexCache = false;
-
   curInnerIter = 0;
   curOuterIter = 0;
   curTimeIter  = 0;
@@ -169,6 +170,12 @@ COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutp
   volumeDataSorter = nullptr;
   surfaceDataSorter = nullptr;
 
+  asyncOutput = config->GetAsync_Output();
+  asyncDataSorter = nullptr;
+  asyncFileWriter = nullptr;
+  asyncBatchOpen = false;
+  asyncConnectivity = false;
+
   headerNeeded = false;
 
 }
@@ -180,6 +187,11 @@ COutput::~COutput(void) {
   delete fileWritingTable;
   delete historyFileTable;
 
+  /*--- Waits for the files that are still being written. ---*/
+
+  delete asyncFileWriter;
+  delete asyncDataSorter;
+
   if (volumeDataSorter != nullptr)
     delete volumeDataSorter;
 
@@ -321,6 +333,65 @@ void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
   }
 
+  /*--- With asynchronous output, a second volume sorter holds the data being written
+   *  in the background, while the solver keeps loading data into the first one. ---*/
+
+  if (asyncOutput && (asyncFileWriter == nullptr)) {
+
+    if (!CAsyncFileWriter::IsSupported()) {
+      if (rank == MASTER_NODE)
+        cout << "WARNING: ASYNC_OUTPUT requires MPI_THREAD_MULTIPLE (run SU2_CFD with --thread_multiple),\n"
+                "         the files are written synchronously." << endl;
+      asyncOutput = false;
+      return;
+    }
+
+    asyncFileWriter = new CAsyncFileWriter();
+
+    if (femOutput)
+      asyncDataSorter = new CFEMDataSorter(config, geometry, volumeFieldNames);
+    else
+      asyncDataSorter = new CFVMDataSorter(config, geometry, volumeFieldNames);
+  }
+
+}
+
+CParallelDataSorter* COutput::GetWritingDataSorter(CConfig *config, unsigned short format) {
+
+  /*--- Only the formats whose writers do all their communication through CFileWriter
+   *  (i.e. on the communicator of the background thread) are written asynchronously. ---*/
+
+  const bool background = asyncOutput &&
+                          ((format == RESTART_BINARY) || (format == PARAVIEW_XML) || (format == PARAVIEW_BINARY));
+
+  if (!background) return volumeDataSorter;
+
+  /*--- For the first of these files in this output, wait for the files of the previous output
+   *  (only blocks if they take longer to write than the solver takes to reach the next output),
+   *  then take a copy of the sorted data that will not change until all files are written. ---*/
+
+  if (!asyncBatchOpen) {
+    WaitForAsyncFiles(config);
+    asyncDataSorter->CopySortedData(*volumeDataSorter);
+    asyncBatchOpen = true;
+    asyncConnectivity = false;
+  }
+
+  if ((format != RESTART_BINARY) && !asyncConnectivity) {
+    asyncDataSorter->CopyConnectivity(*volumeDataSorter);
+    asyncConnectivity = true;
+  }
+
+  return asyncDataSorter;
+}
+
+void COutput::WaitForAsyncFiles(CConfig *config) {
+
+  if (asyncFileWriter == nullptr) return;
+
+  const su2double bandwidth = asyncFileWriter->Wait();
+
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+bandwidth);
 }
 
 void COutput::Load_Data(CGeometry *geometry, CConfig *config, CSolver** solver_container){
@@ -343,6 +414,10 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
   CFileWriter *fileWriter = NULL;
 
+  /*--- Sorter given to the writer, a copy of the volume data for the files written in the background. ---*/
+
+  CParallelDataSorter *writingDataSorter = volumeDataSorter;
+
   unsigned short lastindex = fileName.find_last_of(".");
   fileName = fileName.substr(0, lastindex);
 
@@ -388,7 +463,17 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           (*fileWritingTable) << "SU2 restart" << fileName + CSU2BinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CSU2BinaryFileWriter(fileName, volumeDataSorter);
+      writingDataSorter = GetWritingDataSorter(config, format);
+
+      /*--- The block format is only used when needed, as only SU2 can read it. ---*/
+
+      if (config->GetRestart_Compression() ||
+          (std::find(restartSinglePrecision.begin(), restartSinglePrecision.end(), true) != restartSinglePrecision.end())) {
+        fileWriter = new CSU2CompressedFileWriter(fileName, writingDataSorter, restartSinglePrecision,
+                                                  config->GetRestart_Compression());
+      } else {
+        fileWriter = new CSU2BinaryFileWriter(fileName, writingDataSorter);
+      }
 
       break;
 
@@ -401,13 +486,17 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 
       volumeDataSorter->SortConnectivity(config, geometry, true);
 
-      /*--- Set the mesh ASCII format ---*/
+      /*--- Set the mesh ASCII or binary format ---*/
       if (rank == MASTER_NODE) {
+        if (config->GetMesh_Out_FileFormat() == SU2_BINARY)
+          (*fileWritingTable) << "SU2 binary mesh" << fileName + CSU2MeshFileWriter::fileExtBinary;
+        else
           (*fileWritingTable) << "SU2 mesh" << fileName + CSU2MeshFileWriter::fileExt;
       }
 
       fileWriter = new CSU2MeshFileWriter(fileName, volumeDataSorter,
-                                          config->GetiZone(), config->GetnZone());
+                                          config->GetiZone(), config->GetnZone(),
+                                          config->GetMesh_Out_FileFormat() == SU2_BINARY);
 
 
       break;
@@ -464,7 +553,9 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
         (*fileWritingTable) << "Paraview" << fileName + CParaviewXMLFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewXMLFileWriter(fileName, volumeDataSorter);
+      writingDataSorter = GetWritingDataSorter(config, format);
+
+      fileWriter = new CParaviewXMLFileWriter(fileName, writingDataSorter);
 
       break;
 
@@ -482,7 +573,9 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
           (*fileWritingTable) << "Paraview binary" << fileName + CParaviewBinaryFileWriter::fileExt;
       }
 
-      fileWriter = new CParaviewBinaryFileWriter(fileName, volumeDataSorter);
+      writingDataSorter = GetWritingDataSorter(config, format);
+
+      fileWriter = new CParaviewBinaryFileWriter(fileName, writingDataSorter);
 
       break;
 
@@ -719,7 +812,14 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
       break;
   }
 
-  if (fileWriter != NULL){
+  if ((fileWriter != NULL) && (asyncDataSorter != nullptr) && (writingDataSorter == asyncDataSorter)){
+
+    /*--- Queue the file, the background thread starts at the end of SetResult_Files. ---*/
+
+    asyncFileWriter->AddFile(fileWriter, format == RESTART_BINARY);
+
+  }
+  else if (fileWriter != NULL){
 
     /*--- Write data to file ---*/
 
@@ -786,6 +886,13 @@ bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** so
 
     }
 
+    /*--- Start writing the files queued for the background thread, the solver continues. ---*/
+
+    if (asyncBatchOpen) {
+      asyncFileWriter->Start();
+      asyncBatchOpen = false;
+    }
+
     if (rank == MASTER_NODE && nVolumeFiles != 0){
       fileWritingTable->PrintFooter();
       headerNeeded = true;
@@ -1542,6 +1649,43 @@ void COutput::PreprocessVolumeOutput(CConfig *config){
     }
     cout << endl;
   }
+
+  /*--- Fields stored in single precision in the binary restart files. The groups needed
+   to restart (or to compute sensitivities) are always kept in double precision. ---*/
+
+  const vector<string> restartGroups = {"COORDINATES", "SOLUTION", "GRID_VELOCITY",
+                                        "VELOCITY", "ACCELERATION", "SENSITIVITY"};
+
+  restartSinglePrecision.assign(nVolumeFields, false);
+  vector<string> keptDouble;
+
+  for (unsigned short iReqField = 0; iReqField < config->GetnRestart_SinglePrecision(); iReqField++){
+    RequestedField = config->GetRestart_SinglePrecision(iReqField);
+    bool restartField = false;
+
+    for (const auto& fieldReference : volumeOutput_List){
+      if (volumeOutput_Map.count(fieldReference) == 0) continue;
+      const VolumeOutputField &Field = volumeOutput_Map.at(fieldReference);
+
+      if ((Field.offset == -1) || ((RequestedField != Field.outputGroup) && (RequestedField != fieldReference)))
+        continue;
+
+      if (std::find(restartGroups.begin(), restartGroups.end(), Field.outputGroup) != restartGroups.end())
+        restartField = true;
+      else
+        restartSinglePrecision[Field.offset] = true;
+    }
+    if (restartField) keptDouble.push_back(RequestedField);
+  }
+
+  if ((rank == MASTER_NODE) && !keptDouble.empty()){
+    cout << "  Info: Needed to restart, kept in double precision: ";
+    for (unsigned short iField = 0; iField < keptDouble.size(); iField++){
+      cout << keptDouble[iField];
+      if (iField != keptDouble.size() - 1) cout << ", ";
+    }
+    cout << endl;
+  }
 }
 
 void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver** solver){
@@ -1550,11 +1694,21 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
   unsigned long iPoint = 0, jPoint = 0;
   unsigned long iVertex = 0;
 
-  /*--- Reset the offset cache and index --- */
-  cachePosition = 0;
-  fieldIndexCache.clear();
-  curGetFieldIndex = 0;
-  fieldGetIndexCache.clear();
+  /*--- Profiling (only when compiled with -DPROFILE). ---*/
+  double tick = 0.0;
+  config->Tick(&tick);
+
+  /*--- One column cursor per thread. ---*/
+
+  if (columnCursor.size() < static_cast<size_t>(omp_get_max_threads()))
+    columnCursor.resize(omp_get_max_threads());
+
+  auto& masterCursor = columnCursor[0];
+
+  /*--- The field names of a loader are resolved on the first point it is called for,
+   *    all other points only replay the offsets of the column table. ---*/
+
+  activeColumns = &volumeColumns;
 
   if (femOutput){
 
@@ -1567,16 +1721,21 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
     CVolumeElementFEM *volElem  = DGGeometry->GetVolElem();
 
-    /*--- Access the solution by looping over the owned volume elements. ---*/
+    /*--- Access the solution by looping over the owned volume elements. This is
+     *    done serially as the DG loaders work on the fluid model of the solver. ---*/
 
     for(unsigned long l=0; l<nVolElemOwned; ++l) {
 
       for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
 
-        buildFieldIndexCache = fieldIndexCache.empty();
+        resolveColumns = !volumeColumns.resolved;
+        masterCursor.set = masterCursor.get = 0;
 
         LoadVolumeDataFEM(config, geometry, solver, l, jPoint, j);
 
+        if (resolveColumns) { resolveColumns = false; volumeColumns.resolved = true; }
+        else CheckColumnSequence(masterCursor);
+
         jPoint++;
 
       }
@@ -1584,21 +1743,59 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
   } else {
 
-    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const unsigned long nPointDomain = geometry->GetnPointDomain();
+#ifdef HAVE_OMP
+    const size_t chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_SIZE);
+#endif
+
+    /*--- Fields copied directly from the solvers, the containers may have been reallocated
+     *    since the last output, therefore they are registered every time. ---*/
 
-      /*--- Load the volume data into the data sorter. --- */
+    volumeBulkColumns.clear();
+    SetVolumeOutputColumns(config, geometry, solver);
 
-      buildFieldIndexCache = fieldIndexCache.empty();
+    /*--- The names of the other fields are resolved on the first point (by one thread). ---*/
+
+    const bool resolve = !volumeColumns.resolved && (nPointDomain > 0);
+    const unsigned long iPointBegin = resolve? 1 : 0;
+
+    SU2_OMP_PARALLEL
+    {
+      /*--- Bulk copy of the registered fields, before the per-point loaders as these may read them. ---*/
+
+      if (!volumeBulkColumns.empty()) {
+        SU2_OMP_FOR_STAT(chunkSize)
+        for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+          for (const auto& column : volumeBulkColumns) {
+            volumeDataSorter->SetUnsorted_Data(iPoint, column.offset, column.data[iPoint*column.stride + column.index]);
+          }
+        }
+      }
+
+      if (resolve) {
+        SU2_OMP_MASTER
+        {
+          resolveColumns = true;
+          LoadVolumeData(config, geometry, solver, 0);
+          resolveColumns = false;
+          volumeColumns.resolved = true;
+        }
+        SU2_OMP_BARRIER
+      }
+
+      /*--- Load the volume data into the data sorter. --- */
 
-      LoadVolumeData(config, geometry, solver, iPoint);
+      auto& cursor = columnCursor[omp_get_thread_num()];
 
+      SU2_OMP_FOR_STAT(chunkSize)
+      for (unsigned long iPoint = iPointBegin; iPoint < nPointDomain; iPoint++) {
+        cursor.set = cursor.get = 0;
+        LoadVolumeData(config, geometry, solver, iPoint);
+        CheckColumnSequence(cursor);
+      }
     }
 
-    /*--- Reset the offset cache and index --- */
-    cachePosition = 0;
-    fieldIndexCache.clear();
-    curGetFieldIndex = 0;
-    fieldGetIndexCache.clear();
+    activeColumns = &surfaceColumns;
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -1613,129 +1810,126 @@ void COutput::LoadDataIntoSorter(CConfig* config, CGeometry* geometry, CSolver**
 
           if(geometry->node[iPoint]->GetDomain()){
 
-            buildFieldIndexCache = fieldIndexCache.empty();
+            resolveColumns = !surfaceColumns.resolved;
+            masterCursor.set = masterCursor.get = 0;
 
             LoadSurfaceData(config, geometry, solver, iPoint, iMarker, iVertex);
 
+            if (resolveColumns) { resolveColumns = false; surfaceColumns.resolved = true; }
+            else CheckColumnSequence(masterCursor);
+
           }
         }
       }
     }
   }
-}
 
-void COutput::SetVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+  activeColumns = nullptr;
 
-  if (buildFieldIndexCache){
+  config->Tock(tick, "LoadDataIntoSorter", 1);
+}
 
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
+short COutput::GetVolumeOutputOffset(const char* name) const {
 
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
-        volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
+  const auto it = volumeOutput_Map.find(name);
 
-    /*--- Use the offset cache for the access ---*/
-
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
-      volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
-    }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
-    }
-  }
+  if (it == volumeOutput_Map.end())
+    SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
 
+  return it->second.offset;
 }
 
-su2double COutput::GetVolumeOutputValue(string name, unsigned long iPoint){
+void COutput::CheckColumnSequence(const OutputColumnCursor& cursor) const {
 
-  if (buildFieldIndexCache){
+  /*--- Release builds only check the number of fields, debug builds also check their names (see NextColumn). ---*/
 
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
+  if ((cursor.set != activeColumns->set.size()) || (cursor.get != activeColumns->get.size()))
+    SU2_MPI::Error("The number of output fields loaded for a point must not depend on the point.", CURRENT_FUNCTION);
+}
 
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldGetIndexCache.push_back(Offset);
-      if (Offset != -1){
-        return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
+namespace {
+/*--- Offset of the next field of a resolved column sequence, or resolve it if that is being done. ---*/
+inline short NextColumn(bool resolve, vector<short>& columns, vector<string>* names,
+                        unsigned short& pos, const char* name, short offset) {
+  if (resolve) {
+    columns.push_back(offset);
+    if (names) names->push_back(name);
+    return offset;
+  }
+  if (pos == columns.size())
+    SU2_MPI::Error(string("Output field ") + name + string(" was not loaded for the first point."),
+                   CURRENT_FUNCTION);
+  if (names && ((*names)[pos] != name))
+    SU2_MPI::Error(string("Output field ") + name + string(" was loaded instead of ") + (*names)[pos] +
+                   string(", the output fields loaded for a point must not depend on the point."), CURRENT_FUNCTION);
+  return columns[pos++];
+}
+}
 
-    /*--- Use the offset cache for the access ---*/
+short COutput::NextSetColumn(const char* name) {
+#ifndef NDEBUG
+  auto names = &activeColumns->setNames;
+#else
+  vector<string>* names = nullptr;
+#endif
+  return NextColumn(resolveColumns, activeColumns->set, names, columnCursor[omp_get_thread_num()].set, name,
+                    resolveColumns? GetVolumeOutputOffset(name) : -1);
+}
 
-    const short Offset = fieldGetIndexCache[curGetFieldIndex++];
+short COutput::NextGetColumn(const char* name) {
+#ifndef NDEBUG
+  auto names = &activeColumns->getNames;
+#else
+  vector<string>* names = nullptr;
+#endif
+  return NextColumn(resolveColumns, activeColumns->get, names, columnCursor[omp_get_thread_num()].get, name,
+                    resolveColumns? GetVolumeOutputOffset(name) : -1);
+}
 
-    if (curGetFieldIndex == fieldGetIndexCache.size()){
-      curGetFieldIndex = 0;
-    }
-    if (Offset != -1){
-      return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-    }
+void COutput::AddVolumeOutputColumns(std::initializer_list<const char*> names, const su2double* data,
+                                     unsigned long stride) {
+  unsigned long index = 0;
+  for (const auto name : names) {
+    const short offset = GetVolumeOutputOffset(name);
+    if (offset != -1) volumeBulkColumns.push_back({offset, data, stride, index});
+    ++index;
   }
-
-  return 0.0;
 }
 
-void COutput::SetAvgVolumeOutputValue(string name, unsigned long iPoint, su2double value){
+void COutput::SetVolumeOutputValue(const char* name, unsigned long iPoint, su2double value){
 
-  const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
+  const short Offset = NextSetColumn(name);
+
+  if (Offset != -1){
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset, value);
+  }
+}
 
-  if (buildFieldIndexCache){
+su2double COutput::GetVolumeOutputValue(const char* name, unsigned long iPoint){
 
-    /*--- Build up the offset cache to speed up subsequent
-     * calls of this routine since the order of calls is
-     * the same for every value of iPoint --- */
+  const short Offset = NextGetColumn(name);
 
-    if (volumeOutput_Map.count(name) > 0){
-      const short Offset = volumeOutput_Map.at(name).offset;
-      fieldIndexCache.push_back(Offset);
-      if (Offset != -1){
+  if (Offset != -1){
+    return volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
+  }
+  return 0.0;
+}
 
-        const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-        const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
+void COutput::SetAvgVolumeOutputValue(const char* name, unsigned long iPoint, su2double value){
 
-        volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
-      }
-    } else {
-      SU2_MPI::Error(string("Cannot find output field with name ") + name, CURRENT_FUNCTION);
-    }
-  } else {
+  const su2double scaling = 1.0 / su2double(curAbsTimeIter + 1);
 
-    /*--- Use the offset cache for the access ---*/
+  const short Offset = NextSetColumn(name);
 
-    const short Offset = fieldIndexCache[cachePosition++];
-    if (Offset != -1){
+  if (Offset != -1){
 
-      const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
-      const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
+    const su2double old_value = volumeDataSorter->GetUnsorted_Data(iPoint, Offset);
+    const su2double new_value = value * scaling + old_value *( 1.0 - scaling);
 
-      volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
-    }
-    if (cachePosition == fieldIndexCache.size()){
-      cachePosition = 0;
-    }
+    volumeDataSorter->SetUnsorted_Data(iPoint, Offset, new_value);
   }
-
 }
 
-
-
-
-
 void COutput::Postprocess_HistoryData(CConfig *config){
 
   map<string, pair<su2double, int> > Average;
@@ -0,0 +1,90 @@
+/*!
+ * \file CAsyncFileWriter.cpp
+ * \brief Class that writes files in a background thread.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CAsyncFileWriter.hpp"
+
+CAsyncFileWriter::CAsyncFileWriter() {
+#ifdef HAVE_MPI
+  MPI_Comm_dup(MPI_COMM_WORLD, &comm);
+#else
+  comm = MPI_COMM_WORLD;
+#endif
+}
+
+CAsyncFileWriter::~CAsyncFileWriter() {
+
+  Wait();
+
+#ifdef HAVE_MPI
+  MPI_Comm_free(&comm);
+#endif
+}
+
+bool CAsyncFileWriter::IsSupported() {
+#ifdef HAVE_MPI
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  return (provided == MPI_THREAD_MULTIPLE);
+#else
+  return true;
+#endif
+}
+
+void CAsyncFileWriter::AddFile(CFileWriter* writer, bool restart) {
+
+  if (Busy())
+    SU2_MPI::Error("Files cannot be added while the previous batch is written.", CURRENT_FUNCTION);
+
+  writer->SetCommunicator(comm);
+  writer->SetBackground();
+  writers.emplace_back(writer);
+  restartFile.push_back(restart);
+}
+
+void CAsyncFileWriter::Start() {
+
+  if (writers.empty() || Busy()) return;
+
+  worker = thread([this]() {
+    for (auto& writer : writers) writer->Write_Data();
+  });
+}
+
+su2double CAsyncFileWriter::Wait() {
+
+  if (Busy()) worker.join();
+
+  su2double bandwidth = 0.0;
+
+  for (size_t iFile = 0; iFile < writers.size(); ++iFile)
+    if (restartFile[iFile]) bandwidth += writers[iFile]->Get_Bandwidth();
+
+  writers.clear();
+  restartFile.clear();
+
+  return bandwidth;
+}
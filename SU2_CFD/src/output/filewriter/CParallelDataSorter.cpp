@@ -28,6 +28,7 @@
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
 #include <cassert>
 #include <numeric>
+#include <algorithm>
 
 
 const map<unsigned short, unsigned short> CParallelDataSorter::TypeMap = {
@@ -377,6 +378,51 @@ void CParallelDataSorter::PrepareSendBuffers(std::vector<unsigned long>& globalI
   delete [] idIndex;
 }
 
+void CParallelDataSorter::CopySortedData(const CParallelDataSorter& other) {
+
+  if ((other.GlobalField_Counter != GlobalField_Counter) || (other.nPoint_Recv[size] != nPoint_Recv[size]))
+    SU2_MPI::Error("The data sorters are not compatible.", CURRENT_FUNCTION);
+
+  nPoints = other.nPoints;
+  nPointsGlobal = other.nPointsGlobal;
+
+  /*--- The sorted data is stored as passivedouble at the beginning of dataBuffer. ---*/
+
+  copy_n(other.passiveDoubleBuffer, GlobalField_Counter*nPoints, passiveDoubleBuffer);
+}
+
+void CParallelDataSorter::CopyConnectivity(const CParallelDataSorter& other) {
+
+  nElemPerType = other.nElemPerType;
+  nElemPerTypeGlobal = other.nElemPerTypeGlobal;
+  nElem = other.nElem;
+  nElemGlobal = other.nElemGlobal;
+  nConn = other.nConn;
+  nConnGlobal = other.nConnGlobal;
+
+  copy_n(other.nElem_Cum, size+1, nElem_Cum);
+  copy_n(other.nElemConn_Cum, size+1, nElemConn_Cum);
+
+  auto copyConn = [this](GEO_TYPE type, unsigned short nPointsElem, const int* src, int*& dst) {
+    delete [] dst;
+    dst = NULL;
+    if (src == NULL) return;
+    const unsigned long nEntries = GetnElem(type)*nPointsElem;
+    dst = new int[nEntries];
+    copy_n(src, nEntries, dst);
+  };
+
+  copyConn(LINE,          N_POINTS_LINE,          other.Conn_Line_Par, Conn_Line_Par);
+  copyConn(TRIANGLE,      N_POINTS_TRIANGLE,      other.Conn_Tria_Par, Conn_Tria_Par);
+  copyConn(QUADRILATERAL, N_POINTS_QUADRILATERAL, other.Conn_Quad_Par, Conn_Quad_Par);
+  copyConn(TETRAHEDRON,   N_POINTS_TETRAHEDRON,   other.Conn_Tetr_Par, Conn_Tetr_Par);
+  copyConn(HEXAHEDRON,    N_POINTS_HEXAHEDRON,    other.Conn_Hexa_Par, Conn_Hexa_Par);
+  copyConn(PRISM,         N_POINTS_PRISM,         other.Conn_Pris_Par, Conn_Pris_Par);
+  copyConn(PYRAMID,       N_POINTS_PYRAMID,       other.Conn_Pyra_Par, Conn_Pyra_Par);
+
+  connectivitySorted = other.connectivitySorted;
+}
+
 unsigned long CParallelDataSorter::GetElem_Connectivity(GEO_TYPE type, unsigned long iElem, unsigned long iNode) const {
 
   switch (type) {
@@ -31,7 +31,8 @@
 CFileWriter::CFileWriter(string valFileName, CParallelDataSorter *valDataSorter, string valFileExt):
   fileExt(valFileExt),
   fileName(std::move(valFileName)),
-  dataSorter(valDataSorter){
+  dataSorter(valDataSorter),
+  comm(MPI_COMM_WORLD){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -45,7 +46,8 @@ CFileWriter::CFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
 
 CFileWriter::CFileWriter(string valFileName, string valFileExt):
   fileExt(valFileExt),
-  fileName(std::move(valFileName)){
+  fileName(std::move(valFileName)),
+  comm(MPI_COMM_WORLD){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -218,14 +220,14 @@ bool CFileWriter::OpenMPIFile(){
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(),
+  ierr = MPI_File_open(comm, fileName.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(fileName.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(),
+    ierr = MPI_File_open(comm, fileName.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -266,7 +268,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_DOUBLE, MPI_SUM, comm);
 
   /*--- Compute and store the bandwidth ---*/
 
@@ -0,0 +1,195 @@
+/*!
+ * \file CSU2CompressedFileWriter.cpp
+ * \brief Filewriter class SU2 block-compressed binary format.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CSU2CompressedFileWriter.hpp"
+#include "../../../../Common/include/toolboxes/compression_toolbox.hpp"
+#include "../../../../Common/include/omp_structure.hpp"
+
+const string CSU2CompressedFileWriter::fileExt = ".dat";
+
+constexpr unsigned long CSU2CompressedFileWriter::blockSize;
+
+CSU2CompressedFileWriter::CSU2CompressedFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
+                                                   vector<bool> valSinglePrecision, bool valCompress) :
+  CFileWriter(std::move(valFileName), valDataSorter, fileExt),
+  singlePrecision(std::move(valSinglePrecision)),
+  compress(valCompress) {}
+
+void CSU2CompressedFileWriter::Write_Data(){
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+  const int nVar = fieldNames.size();
+  const unsigned long nLocalPoint = dataSorter->GetnPoints();
+  const unsigned long nPoint_Global = dataSorter->GetnPointsGlobal();
+  const unsigned long firstLocalPoint = dataSorter->GetnPointCumulative(rank);
+  const passivedouble* data = dataSorter->GetData();
+
+  /*--- Size of the values of each field, and start of each field within a block (per point). ---*/
+
+  vector<int> valueSize(nVar);
+  vector<unsigned long> fieldStart(nVar+1, 0);
+  for (int iVar = 0; iVar < nVar; iVar++) {
+    const bool single = (iVar < int(singlePrecision.size())) && singlePrecision[iVar];
+    valueSize[iVar] = single? sizeof(float) : sizeof(passivedouble);
+    fieldStart[iVar+1] = fieldStart[iVar] + valueSize[iVar];
+  }
+  const unsigned long bytesPerPoint = fieldStart[nVar];
+
+  const unsigned long nLocalBlock = (nLocalPoint + blockSize - 1) / blockSize;
+
+  OpenMPIFile();
+
+  /*--- Encode the blocks of this rank, they are independent of each other. In the background
+   *    thread they are encoded serially, the solver threads are busy with the next iterations. ---*/
+
+#ifdef HAVE_MPI
+  startTime = MPI_Wtime();
+#else
+  startTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#endif
+
+  vector<vector<uint8_t> > blocks(nLocalBlock);
+
+  SU2_OMP_PARALLEL_(if(!background))
+  {
+    vector<uint8_t> raw, shuffled;
+
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iBlock = 0; iBlock < nLocalBlock; iBlock++) {
+
+      const unsigned long firstPoint = iBlock*blockSize;
+      const unsigned long nPoint = min(blockSize, nLocalPoint - firstPoint);
+      const unsigned long rawSize = nPoint*bytesPerPoint;
+
+      raw.resize(rawSize);
+
+      for (int iVar = 0; iVar < nVar; iVar++) {
+        uint8_t* column = raw.data() + nPoint*fieldStart[iVar];
+        for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+          const passivedouble value = data[(firstPoint+iPoint)*nVar + iVar];
+          if (valueSize[iVar] == sizeof(float)) {
+            const float single = float(value);
+            memcpy(column + iPoint*sizeof(float), &single, sizeof(float));
+          } else {
+            memcpy(column + iPoint*sizeof(passivedouble), &value, sizeof(passivedouble));
+          }
+        }
+      }
+
+      if (!compress) {
+        blocks[iBlock] = raw;
+        continue;
+      }
+
+      shuffled.resize(rawSize);
+      for (int iVar = 0; iVar < nVar; iVar++) {
+        const unsigned long start = nPoint*fieldStart[iVar];
+        CompressionToolbox::ByteShuffle(raw.data()+start, nPoint, valueSize[iVar], shuffled.data()+start);
+      }
+
+      /*--- A compressed block must be smaller than the raw one, that is how the reader tells them apart. ---*/
+
+      auto& block = blocks[iBlock];
+      block.resize(rawSize);
+      const size_t compressedSize = (rawSize > 1)?
+        CompressionToolbox::LZ4Compress(shuffled.data(), rawSize, block.data(), rawSize-1) : 0;
+
+      if (compressedSize) block.resize(compressedSize);
+      else block = shuffled;
+    }
+  }
+
+#ifdef HAVE_MPI
+  stopTime = MPI_Wtime();
+#else
+  stopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#endif
+  usedTime += stopTime - startTime;
+
+  /*--- Location of the blocks of this rank in the block table and in the data. ---*/
+
+  unsigned long nLocalBytes = 0;
+  for (const auto& block : blocks) nLocalBytes += block.size();
+
+  vector<unsigned long> nBlockRank(size), nBytesRank(size);
+  unsigned long sendBuf = nLocalBlock;
+  SU2_MPI::Allgather(&sendBuf, 1, MPI_UNSIGNED_LONG, nBlockRank.data(), 1, MPI_UNSIGNED_LONG, comm);
+  sendBuf = nLocalBytes;
+  SU2_MPI::Allgather(&sendBuf, 1, MPI_UNSIGNED_LONG, nBytesRank.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  unsigned long nBlock_Global = 0, nBytes_Global = 0, blockOffset = 0, byteOffset = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) {
+      blockOffset += nBlockRank[iRank];
+      byteOffset += nBytesRank[iRank];
+    }
+    nBlock_Global += nBlockRank[iRank];
+    nBytes_Global += nBytesRank[iRank];
+  }
+
+  vector<unsigned long> blockTable(2*nLocalBlock);
+  vector<uint8_t> buffer(nLocalBytes);
+
+  unsigned long position = 0;
+  for (unsigned long iBlock = 0; iBlock < nLocalBlock; iBlock++) {
+    blockTable[2*iBlock] = firstLocalPoint + iBlock*blockSize;
+    blockTable[2*iBlock+1] = byteOffset + position;
+    memcpy(buffer.data()+position, blocks[iBlock].data(), blocks[iBlock].size());
+    position += blocks[iBlock].size();
+  }
+  blocks.clear();
+
+  /*--- Header, names and value sizes are written by the master. ---*/
+
+  int var_buf[5] = {SU2_COMPRESSED_RESTART_MAGIC, nVar, int(nPoint_Global), int(nBlock_Global), compress};
+
+  WriteMPIBinaryData(var_buf, 5*sizeof(int), MASTER_NODE);
+
+  char str_buf[CGNS_STRING_SIZE];
+  for (int iVar = 0; iVar < nVar; iVar++) {
+    strncpy(str_buf, fieldNames[iVar].c_str(), CGNS_STRING_SIZE);
+    WriteMPIBinaryData(str_buf, CGNS_STRING_SIZE*sizeof(char), MASTER_NODE);
+  }
+
+  WriteMPIBinaryData(valueSize.data(), nVar*sizeof(int), MASTER_NODE);
+
+  /*--- Block table, the master closes it with the end of the data. ---*/
+
+  const unsigned long entrySize = 2*sizeof(unsigned long);
+
+  WriteMPIBinaryDataAll(blockTable.data(), nLocalBlock*entrySize, nBlock_Global*entrySize, blockOffset*entrySize);
+
+  const unsigned long tableEnd[2] = {nPoint_Global, nBytes_Global};
+  WriteMPIBinaryData(tableEnd, entrySize, MASTER_NODE);
+
+  /*--- Collectively write the blocks. ---*/
+
+  WriteMPIBinaryDataAll(buffer.data(), nLocalBytes, nBytes_Global, byteOffset);
+
+  CloseMPIFile();
+
+}
@@ -29,10 +29,12 @@
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
 
 const string CSU2MeshFileWriter::fileExt = ".su2";
+const string CSU2MeshFileWriter::fileExtBinary = ".su2b";
 
 CSU2MeshFileWriter::CSU2MeshFileWriter(string valFileName, CParallelDataSorter *valDataSorter,
-                                       unsigned short valiZone, unsigned short valnZone) :
-   CFileWriter(std::move(valFileName), valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+                                       unsigned short valiZone, unsigned short valnZone, bool valBinary) :
+   CFileWriter(std::move(valFileName), valDataSorter, valBinary? fileExtBinary : fileExt),
+   iZone(valiZone), nZone(valnZone), binary(valBinary) {}
 
 
 CSU2MeshFileWriter::~CSU2MeshFileWriter(){
@@ -42,6 +44,11 @@ CSU2MeshFileWriter::~CSU2MeshFileWriter(){
 
 void CSU2MeshFileWriter::Write_Data(){
 
+  if (binary) {
+    Write_Data_Binary();
+    return;
+  }
+
   unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, vnodes_edge[2], vnodes_triangle[3], vnodes_quad[4], offset, nElem;
   unsigned short iMarker, iDim, iChar, VTK_Type, nMarker_;
   short SendTo;
@@ -301,3 +308,193 @@ void CSU2MeshFileWriter::Write_Data(){
     output_file.close();
   }
 }
+
+void CSU2MeshFileWriter::ReadBoundaryFile(vector<string>& markerNames,
+                                          vector<vector<unsigned long> >& markerConn) const {
+
+  string str = (nZone == 1)? "boundary" : "boundary_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
+
+  ifstream input_file(str.c_str(), ios::in);
+
+  if (!input_file.is_open()){
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
+
+  string text_line;
+  unsigned long nElem_Bound_ = 0;
+  unsigned short VTK_Type;
+
+  while (getline(input_file, text_line)) {
+
+    if (text_line.find("MARKER_TAG=",0) != string::npos) {
+      markerNames.emplace_back();
+      markerConn.emplace_back();
+      istringstream(text_line.substr(11)) >> markerNames.back();
+    }
+    else if (text_line.find("MARKER_ELEMS=",0) != string::npos) {
+      nElem_Bound_ = atol(text_line.substr(13).c_str());
+
+      /*--- The next line is SEND_TO= followed by the elements. ---*/
+
+      getline(input_file, text_line);
+
+      for (unsigned long iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+
+        getline(input_file, text_line);
+        istringstream bound_line(text_line);
+        bound_line >> VTK_Type;
+
+        unsigned short nNodes = 0;
+        switch (VTK_Type) {
+          case LINE:          nNodes = N_POINTS_LINE;          break;
+          case TRIANGLE:      nNodes = N_POINTS_TRIANGLE;      break;
+          case QUADRILATERAL: nNodes = N_POINTS_QUADRILATERAL; break;
+          default: continue;
+        }
+
+        auto& conn = markerConn.back();
+        const auto start = conn.size();
+        conn.resize(start+SU2_CONN_SIZE, 0);
+        conn[start+1] = VTK_Type;
+        for (unsigned short iNode = 0; iNode < nNodes; iNode++)
+          bound_line >> conn[start+SU2_CONN_SKIP+iNode];
+      }
+    }
+  }
+
+}
+
+void CSU2MeshFileWriter::Write_Data_Binary(){
+
+  /*--- The binary mesh only contains 8 byte words, unsigned longs and doubles. ---*/
+
+  const unsigned long wordSize = sizeof(unsigned long);
+  static_assert(sizeof(unsigned long) == sizeof(passivedouble), "Unexpected size of the SU2 binary mesh entries.");
+
+  const unsigned long nDim = dataSorter->GetnDim();
+
+  /*--- The master packs the markers as [nameLength nElemBound], the name
+   padded to a multiple of 8 bytes, and the element records. ---*/
+
+  vector<unsigned long> markerSection;
+  unsigned long nMarker = 0;
+
+  if (rank == MASTER_NODE) {
+    vector<string> markerNames;
+    vector<vector<unsigned long> > markerConn;
+    ReadBoundaryFile(markerNames, markerConn);
+
+    nMarker = markerNames.size();
+
+    for (unsigned long iMarker = 0; iMarker < nMarker; iMarker++) {
+      const string& name = markerNames[iMarker];
+      markerSection.push_back(name.size());
+      markerSection.push_back(markerConn[iMarker].size()/SU2_CONN_SIZE);
+
+      const auto start = markerSection.size();
+      markerSection.resize(start + (name.size()+wordSize-1)/wordSize, 0);
+      memcpy(&markerSection[start], name.data(), name.size());
+
+      markerSection.insert(markerSection.end(), markerConn[iMarker].begin(), markerConn[iMarker].end());
+    }
+  }
+
+  unsigned long markerWords = markerSection.size();
+  SU2_MPI::Bcast(&markerWords, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Pack the local points and elements. The elements are numbered
+   by rank and then by type, as for the ASCII format. ---*/
+
+  const GEO_TYPE elemTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const unsigned short elemNodes[] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                      N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+
+  unsigned long nLocal[2] = {dataSorter->GetnPoints(), 0};
+  for (auto type : elemTypes) nLocal[1] += dataSorter->GetnElem(type);
+
+  vector<unsigned long> nRank(2*size);
+  SU2_MPI::Allgather(nLocal, 2, MPI_UNSIGNED_LONG, nRank.data(), 2, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+  unsigned long pointOffset = 0, elemOffset = 0, nPointGlobal = 0, nElemGlobal = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) {
+      pointOffset += nRank[2*iRank];
+      elemOffset  += nRank[2*iRank+1];
+    }
+    nPointGlobal += nRank[2*iRank];
+    nElemGlobal  += nRank[2*iRank+1];
+  }
+
+  vector<passivedouble> coords(nLocal[0]*nDim);
+  for (unsigned long iPoint = 0; iPoint < nLocal[0]; iPoint++)
+    for (unsigned long iDim = 0; iDim < nDim; iDim++)
+      coords[iPoint*nDim+iDim] = dataSorter->GetData(iDim, iPoint);
+
+  vector<unsigned long> conn(nLocal[1]*SU2_CONN_SIZE, 0);
+  unsigned long iElemLocal = 0;
+  for (unsigned short iType = 0; iType < 6; iType++) {
+    for (unsigned long iElem = 0; iElem < dataSorter->GetnElem(elemTypes[iType]); iElem++) {
+      unsigned long* record = &conn[iElemLocal*SU2_CONN_SIZE];
+      record[0] = elemOffset + iElemLocal;
+      record[1] = elemTypes[iType];
+      for (unsigned short iNode = 0; iNode < elemNodes[iType]; iNode++)
+        record[SU2_CONN_SKIP+iNode] = dataSorter->GetElem_Connectivity(elemTypes[iType], iElem, iNode) - 1;
+      iElemLocal++;
+    }
+  }
+
+  /*--- Open the file, the zones after the first are appended. ---*/
+
+  unsigned long zoneStart = 0;
+
+  if (iZone == 0) {
+    OpenMPIFile();
+  }
+  else {
+#ifdef HAVE_MPI
+    int ierr = MPI_File_open(MPI_COMM_WORLD, fileName.c_str(), MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+    MPI_Offset fileEnd = 0;
+    if (ierr == MPI_SUCCESS) MPI_File_get_size(fhw, &fileEnd);
+    disp = fileEnd;
+    zoneStart = fileEnd;
+#else
+    fhw = fopen(fileName.c_str(), "ab");
+    int ierr = (fhw == NULL);
+    if (!ierr) { fseek(fhw, 0, SEEK_END); zoneStart = ftell(fhw); }
+#endif
+    if (ierr) {
+      SU2_MPI::Error(string("Unable to open file ") + fileName, CURRENT_FUNCTION);
+    }
+    fileSize = 0.0;
+    usedTime = 0;
+  }
+
+  /*--- The header indexes the sections of the zone. ---*/
+
+  unsigned long header[SU2_BINARY_HEADER_SIZE] = {0};
+  header[BIN_MESH_MAGIC]   = SU2_BINARY_MESH_MAGIC;
+  header[BIN_MESH_VERSION] = SU2_BINARY_MESH_VERSION;
+  header[BIN_MESH_IZONE]   = iZone;
+  header[BIN_MESH_NZONE]   = nZone;
+  header[BIN_MESH_NDIM]    = nDim;
+  header[BIN_MESH_NPOIN]   = nPointGlobal;
+  header[BIN_MESH_NELEM]   = nElemGlobal;
+  header[BIN_MESH_NMARK]   = nMarker;
+  header[BIN_MESH_MARKER_OFFSET] = zoneStart + SU2_BINARY_HEADER_SIZE*wordSize;
+  header[BIN_MESH_POINT_OFFSET]  = header[BIN_MESH_MARKER_OFFSET] + markerWords*wordSize;
+  header[BIN_MESH_ELEM_OFFSET]   = header[BIN_MESH_POINT_OFFSET] + nPointGlobal*nDim*wordSize;
+  header[BIN_MESH_NEXT_ZONE]     = header[BIN_MESH_ELEM_OFFSET] + nElemGlobal*SU2_CONN_SIZE*wordSize;
+
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+  WriteMPIBinaryData(markerSection.data(), markerWords*wordSize, MASTER_NODE);
+
+  WriteMPIBinaryDataAll(coords.data(), coords.size()*wordSize,
+                        nPointGlobal*nDim*wordSize, pointOffset*nDim*wordSize);
+
+  WriteMPIBinaryDataAll(conn.data(), conn.size()*wordSize,
+                        nElemGlobal*SU2_CONN_SIZE*wordSize, elemOffset*SU2_CONN_SIZE*wordSize);
+
+  CloseMPIFile();
+
+}
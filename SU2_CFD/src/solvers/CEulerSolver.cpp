@@ -32,6 +32,7 @@
 #include "../../include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../include/gradients/computeGradientsLeastSquares.hpp"
 #include "../../include/limiters/computeLimiters.hpp"
+#include "../../include/limiters/computeGradientsAndLimiters.hpp"
 
 void CEulerSolver::AeroCoeffsArray::allocate(int size) {
   _size = size;
@@ -517,6 +518,10 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
     InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_NEIGHBORS);
     CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_NEIGHBORS);
   }
+
+  /*--- Periodic volumes are part of the contiguous dual grid. ---*/
+  geometry->SetDualGridSoA();
+
   SetImplicitPeriodic(euler_implicit);
   if (iMesh == MESH_0) SetRotatePeriodic(true);
 
@@ -2495,7 +2500,7 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   unsigned long InnerIter = config->GetInnerIter();
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool disc_adjoint     = config->GetDiscrete_Adjoint();
-  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   bool muscl            = (config->GetMUSCL_Flow() || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == ROE));
   bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
   bool center           = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
@@ -2519,10 +2524,13 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     SU2_OMP_BARRIER
   }
 
-  /*--- Set the primitive variables ---*/
+  /*--- Set the primitive variables, this invalidates the reconstructed states. ---*/
 
   SU2_OMP_MASTER
-  ErrorCounter = 0;
+  {
+    ErrorCounter = 0;
+    ReconstructedStatesSet = false;
+  }
   SU2_OMP_BARRIER
 
   SU2_OMP_ATOMIC
@@ -2571,19 +2579,28 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if ((muscl && !center) && (iMesh == MESH_0) && !Output) {
 
-    /*--- Gradient computation for MUSCL reconstruction. ---*/
+    if (FusedReconstruction(config, iMesh)) {
+
+      /*--- Gradients, limiters, and reconstructed states in one pass. ---*/
+
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
+    }
+    else {
 
-    if (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS)
-      SetPrimitive_Gradient_GG(geometry, config, true);
-    if (config->GetKind_Gradient_Method_Recon() == LEAST_SQUARES)
-      SetPrimitive_Gradient_LS(geometry, config, true);
-    if (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES)
-      SetPrimitive_Gradient_LS(geometry, config, true);
+      /*--- Gradient computation for MUSCL reconstruction. ---*/
 
-    /*--- Limiter computation ---*/
+      if (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS)
+        SetPrimitive_Gradient_GG(geometry, config, true);
+      if (config->GetKind_Gradient_Method_Recon() == LEAST_SQUARES)
+        SetPrimitive_Gradient_LS(geometry, config, true);
+      if (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES)
+        SetPrimitive_Gradient_LS(geometry, config, true);
 
-    if (limiter && (iMesh == MESH_0) && !Output && !van_albada)
-      SetPrimitive_Limiter(geometry, config);
+      /*--- Limiter computation ---*/
+
+      if (limiter && (iMesh == MESH_0) && !Output && !van_albada)
+        SetPrimitive_Limiter(geometry, config);
+    }
   }
 
   /*--- Artificial dissipation ---*/
@@ -2904,7 +2921,7 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   const bool jst_scheme = (config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0);
 
   /*--- Pick one numerics object per thread. ---*/
@@ -2913,6 +2930,9 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
   /*--- Determine if using the reducer strategy is necessary, see CEulerSolver::SumEdgeFluxes(). ---*/
   const bool reducer_strategy = (MGLevel != MESH_0) && (omp_get_num_threads() > 1);
 
+  /*--- Contiguous copy of the edge and point data. ---*/
+  const auto& dualGrid = geometry->GetDualGridSoA();
+
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring)
   {
@@ -2924,10 +2944,10 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+    auto iPoint = dualGrid.GetNode(iEdge,0);
+    auto jPoint = dualGrid.GetNode(iEdge,1);
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    numerics->SetNormal(dualGrid.GetNormal(iEdge));
     numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
 
     /*--- Set primitive variables w/o reconstruction ---*/
@@ -2995,7 +3015,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
          "Oops! The CEulerSolver static array sizes are not large enough.");
 
   const auto InnerIter        = config->GetInnerIter();
-  const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   const bool ideal_gas        = (config->GetKind_FluidModel() == STANDARD_AIR) ||
                                 (config->GetKind_FluidModel() == IDEAL_GAS);
 
@@ -3013,6 +3033,20 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   SU2_OMP_MASTER
   ErrorCounter = 0;
 
+  /*--- Profiling (only when compiled with -DPROFILE), timed by the master thread. ---*/
+  double tick = 0.0;
+  SU2_OMP_MASTER
+  config->Tick(&tick);
+
+  /*--- Post the exchange of the limiters (see LimiterCommOverlap), the edges between
+   *    domain points are computed while it is in flight, then the edges with halos. ---*/
+  const bool comm_overlap = LimiterCommOverlap(config, iMesh);
+
+  if (comm_overlap) {
+    SU2_OMP_MASTER
+    InitiateComms(geometry, config, PRIMITIVE_LIMITER);
+  }
+
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
@@ -3023,196 +3057,174 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   /*--- Determine if using the reducer strategy is necessary, see CEulerSolver::SumEdgeFluxes(). ---*/
   const bool reducer_strategy = (MGLevel != MESH_0) && (omp_get_num_threads() > 1);
 
-    /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
-  {
-  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE, ColorGroupSize)*ColorGroupSize)
-  for(auto k = 0ul; k < color.size; ++k) {
-
-    auto iEdge = color.indices[k];
-
-    unsigned short iDim, iVar;
-
-    /*--- Points in edge and normal vectors ---*/
+  /*--- Contiguous copy of the edge and point data. ---*/
+  const auto& dualGrid = geometry->GetDualGridSoA();
 
-    auto iPoint = geometry->edge[iEdge]->GetNode(0);
-    auto jPoint = geometry->edge[iEdge]->GetNode(1);
+  /*--- Vectorized path, the fluxes of groups of edges are computed by the numerics in one call. ---*/
 
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-
-    auto Coord_i = geometry->node[iPoint]->GetCoord();
-    auto Coord_j = geometry->node[jPoint]->GetCoord();
-
-    /*--- Roe Turkel preconditioning ---*/
-
-    if (roe_turkel) {
-      su2double sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += pow(config->GetVelocity_FreeStream()[iDim], 2);
-      numerics->SetVelocity2_Inf(sqvel);
-    }
+#ifdef HAVE_OMP
+  /*--- Batches must not straddle color groups, as those may be computed by different threads. ---*/
+  const bool batch_aligned = (ColorGroupSize % CEdgeBatch::WIDTH == 0);
+#else
+  /*--- Without OpenMP all the edges are one group (and the color group size is not set). ---*/
+  const bool batch_aligned = true;
+#endif
 
-    /*--- Grid movement ---*/
+  /*--- Implicit HLLC has no batched kernel, the per-edge fallback through the batches is slower. ---*/
+  const auto kind_upwind = config->GetKind_Upwind_Flow();
+  const bool edge_batching = config->GetEdge_Batching() &&
+                             ((kind_upwind == ROE) || ((kind_upwind == HLLC) && !implicit) || (kind_upwind == AUSM)) &&
+                             ideal_gas && !low_mach_corr && !dynamic_grid &&
+                             (kind_dissipation == NO_ROELOWDISS) && !config->GetDiscrete_Adjoint() &&
+                             batch_aligned;
 
-    if (dynamic_grid) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
-                           geometry->node[jPoint]->GetGridVel());
+  if (edge_batching) {
+    Upwind_Residual_Batch(geometry, solver_container, numerics_container, config, iMesh, counter_local);
+  }
+  else {
+    /*--- With overlap, two passes over the edges, see above. The chunks are the same in both
+     *    passes, i.e. edges of a color group are still computed by the same thread. ---*/
+    for (int pass = 0; pass < (comm_overlap? 2 : 1); ++pass)
+    {
+    if (pass == 1) {
+      SU2_OMP_MASTER
+      CompleteComms(geometry, config, PRIMITIVE_LIMITER);
+      SU2_OMP_BARRIER
     }
 
-    /*--- Get primitive and secondary variables ---*/
+    /*--- Loop over edge colors. ---*/
+    for (auto color : EdgeColoring)
+    {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE, ColorGroupSize)*ColorGroupSize)
+    for(auto k = 0ul; k < color.size; ++k) {
 
-    auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
-    auto S_i = nodes->GetSecondary(iPoint); auto S_j = nodes->GetSecondary(jPoint);
+      auto iEdge = color.indices[k];
 
-    /*--- Set them with or without high order reconstruction using MUSCL strategy. ---*/
+      unsigned short iDim;
 
-    if (!muscl) {
+      /*--- Points in edge and normal vectors ---*/
 
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetSecondary(S_i, S_j);
+      auto iPoint = dualGrid.GetNode(iEdge,0);
+      auto jPoint = dualGrid.GetNode(iEdge,1);
 
-    }
-    else {
-      /*--- Reconstruction ---*/
+      if (comm_overlap && ((max(iPoint,jPoint) >= nPointDomain) != (pass == 1))) continue;
 
-      su2double Vector_ij[MAXNDIM] = {0.0};
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
-      }
+      numerics->SetNormal(dualGrid.GetNormal(iEdge));
 
-      auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
-      auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+      auto Coord_i = dualGrid.GetCoord(iPoint);
+      auto Coord_j = dualGrid.GetCoord(jPoint);
 
-      su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+      /*--- Roe Turkel preconditioning ---*/
 
-      if (limiter) {
-        Limiter_i = nodes->GetLimiter_Primitive(iPoint);
-        Limiter_j = nodes->GetLimiter_Primitive(jPoint);
+      if (roe_turkel) {
+        su2double sqvel = 0.0;
+        for (iDim = 0; iDim < nDim; iDim ++)
+          sqvel += pow(config->GetVelocity_FreeStream()[iDim], 2);
+        numerics->SetVelocity2_Inf(sqvel);
       }
 
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-
-        su2double Project_Grad_i = 0.0;
-        su2double Project_Grad_j = 0.0;
+      /*--- Grid movement ---*/
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
-        }
+      if (dynamic_grid) {
+        numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
+                             geometry->node[jPoint]->GetGridVel());
+      }
 
-        if (limiter) {
-          if (van_albada) {
-            su2double V_ij = V_j[iVar] - V_i[iVar];
-            Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
-            Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
-          }
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
+      /*--- Get primitive and secondary variables ---*/
 
-      }
+      auto V_i = nodes->GetPrimitive(iPoint); auto V_j = nodes->GetPrimitive(jPoint);
+      auto S_i = nodes->GetSecondary(iPoint); auto S_j = nodes->GetSecondary(jPoint);
 
-      /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
+      /*--- Set them with or without high order reconstruction using MUSCL strategy. ---*/
 
-      if (!ideal_gas || low_mach_corr) {
-        ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_i, Secondary_i);
-        ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_j, Secondary_j);
-      }
+      if (!muscl) {
 
-      /*--- Low-Mach number correction. ---*/
+        numerics->SetPrimitive(V_i, V_j);
+        numerics->SetSecondary(S_i, S_j);
 
-      if (low_mach_corr) {
-        LowMachPrimitiveCorrection(GetFluidModel(), nDim, Primitive_i, Primitive_j);
       }
+      else {
+        /*--- Reconstruction ---*/
 
-      /*--- Check for non-physical solutions after reconstruction. If found, use the
-       cell-average value of the solution. This is a locally 1st order approximation,
-       which is typically only active during the start-up of a calculation. ---*/
+        MUSCLReconstruction(dualGrid, iEdge, limiter, van_albada, Primitive_i, Primitive_j);
 
-      bool neg_pres_or_rho_i = (Primitive_i[nDim+1] < 0.0) || (Primitive_i[nDim+2] < 0.0);
-      bool neg_pres_or_rho_j = (Primitive_j[nDim+1] < 0.0) || (Primitive_j[nDim+2] < 0.0);
+        /*--- Recompute the reconstructed quantities in a thermodynamically consistent way. ---*/
 
-      su2double R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      su2double sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        su2double RoeVelocity = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += pow(RoeVelocity, 2);
-      }
-      su2double RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+        if (!ideal_gas || low_mach_corr) {
+          ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_i, Secondary_i);
+          ComputeConsistentExtrapolation(GetFluidModel(), nDim, Primitive_j, Secondary_j);
+        }
 
-      bool neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+        /*--- Low-Mach number correction. ---*/
 
-      bool bad_i = neg_sound_speed || neg_pres_or_rho_i;
-      bool bad_j = neg_sound_speed || neg_pres_or_rho_j;
+        if (low_mach_corr) {
+          LowMachPrimitiveCorrection(GetFluidModel(), nDim, Primitive_i, Primitive_j);
+        }
 
-      nodes->SetNon_Physical(iPoint, bad_i);
-      nodes->SetNon_Physical(jPoint, bad_j);
+        /*--- Check for non-physical solutions after reconstruction. ---*/
 
-      /*--- Get updated state, in case the point recovered after the set. ---*/
-      bad_i = nodes->GetNon_Physical(iPoint);
-      bad_j = nodes->GetNon_Physical(jPoint);
+        bool bad_i, bad_j;
+        CheckNonPhysicalReconstruction(iPoint, jPoint, Primitive_i, Primitive_j, bad_i, bad_j);
 
-      counter_local += bad_i+bad_j;
+        counter_local += bad_i+bad_j;
 
-      numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
-      numerics->SetSecondary(bad_i? S_i : Secondary_i,  bad_j? S_j : Secondary_j);
+        numerics->SetPrimitive(bad_i? V_i : Primitive_i,  bad_j? V_j : Primitive_j);
+        numerics->SetSecondary(bad_i? S_i : Secondary_i,  bad_j? S_j : Secondary_j);
 
-    }
+      }
 
-    /*--- Roe Low Dissipation Scheme ---*/
+      /*--- Roe Low Dissipation Scheme ---*/
 
-    if (kind_dissipation != NO_ROELOWDISS) {
+      if (kind_dissipation != NO_ROELOWDISS) {
 
-      numerics->SetDissipation(nodes->GetRoe_Dissipation(iPoint),
-                               nodes->GetRoe_Dissipation(jPoint));
+        numerics->SetDissipation(nodes->GetRoe_Dissipation(iPoint),
+                                 nodes->GetRoe_Dissipation(jPoint));
 
-      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
-        numerics->SetSensor(nodes->GetSensor(iPoint),
-                            nodes->GetSensor(jPoint));
-      }
-      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
-        numerics->SetCoord(Coord_i, Coord_j);
+        if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
+          numerics->SetSensor(nodes->GetSensor(iPoint),
+                              nodes->GetSensor(jPoint));
+        }
+        if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
+          numerics->SetCoord(Coord_i, Coord_j);
+        }
       }
-    }
 
-    /*--- Compute the residual ---*/
+      /*--- Compute the residual ---*/
 
-    auto residual = numerics->ComputeResidual(config);
+      auto residual = numerics->ComputeResidual(config);
 
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
+      /*--- Set the final value of the Roe dissipation coefficient ---*/
 
-    if ((kind_dissipation != NO_ROELOWDISS) && (MGLevel != MESH_0)) {
-      nodes->SetRoe_Dissipation(iPoint,numerics->GetDissipation());
-      nodes->SetRoe_Dissipation(jPoint,numerics->GetDissipation());
-    }
+      if ((kind_dissipation != NO_ROELOWDISS) && (MGLevel != MESH_0)) {
+        nodes->SetRoe_Dissipation(iPoint,numerics->GetDissipation());
+        nodes->SetRoe_Dissipation(jPoint,numerics->GetDissipation());
+      }
 
-    /*--- Update residual value ---*/
+      /*--- Update residual value ---*/
 
-    if (reducer_strategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
-      if (implicit)
-        Jacobian.UpdateBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
-    }
-    else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
+      if (reducer_strategy) {
+        EdgeFluxes.SetBlock(iEdge, residual);
+        if (implicit)
+          Jacobian.UpdateBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
+      }
+      else {
+        LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.SubtractBlock(jPoint, residual);
 
-      /*--- Set implicit computation ---*/
-      if (implicit)
-        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
-    }
+        /*--- Set implicit computation ---*/
+        if (implicit)
+          Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
+      }
 
-    /*--- Viscous contribution. ---*/
+      /*--- Viscous contribution. ---*/
 
-    Viscous_Residual(iEdge, geometry, solver_container,
-                     numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+      Viscous_Residual(iEdge, geometry, solver_container,
+                       numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
+    }
+    } // end color loop
+    } // end pass loop
   }
-  } // end color loop
 
   if (reducer_strategy) {
     SumEdgeFluxes(geometry);
@@ -3220,6 +3232,9 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
       Jacobian.SetDiagonalAsColumnSum();
   }
 
+  SU2_OMP_MASTER
+  config->Tock(tick, "Upwind_Residual", 1);
+
   /*--- Warning message about non-physical reconstructions. ---*/
 
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
@@ -3240,16 +3255,264 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
 }
 
+void CEulerSolver::MUSCLReconstruction(const CDualGridSoA& dualGrid, unsigned long iEdge,
+                                       bool limiter, bool van_albada,
+                                       su2double* Primitive_i, su2double* Primitive_j) {
+
+  const auto iPoint = dualGrid.GetNode(iEdge,0);
+  const auto jPoint = dualGrid.GetNode(iEdge,1);
+
+  /*--- Use the states computed with the limiters for the domain points (the
+   *    halo points have no states, their side of the edge is computed here). ---*/
+
+  bool done_i = false, done_j = false;
+
+  if (ReconstructedStatesSet) {
+    if (iPoint < nPointDomain) {
+      const su2double* state = ReconstructedStates[dualGrid.GetNeighborPosition(iEdge,0)];
+      for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++) Primitive_i[iVar] = state[iVar];
+      done_i = true;
+    }
+    if (jPoint < nPointDomain) {
+      const su2double* state = ReconstructedStates[dualGrid.GetNeighborPosition(iEdge,1)];
+      for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++) Primitive_j[iVar] = state[iVar];
+      done_j = true;
+    }
+    if (done_i && done_j) return;
+  }
+
+  const auto Coord_i = dualGrid.GetCoord(iPoint);
+  const auto Coord_j = dualGrid.GetCoord(jPoint);
+
+  const auto V_i = nodes->GetPrimitive(iPoint);
+  const auto V_j = nodes->GetPrimitive(jPoint);
+
+  su2double Vector_ij[MAXNDIM] = {0.0};
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    Vector_ij[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+  }
+
+  auto Gradient_i = nodes->GetGradient_Reconstruction(iPoint);
+  auto Gradient_j = nodes->GetGradient_Reconstruction(jPoint);
+
+  su2double *Limiter_i = nullptr, *Limiter_j = nullptr;
+
+  if (limiter) {
+    Limiter_i = nodes->GetLimiter_Primitive(iPoint);
+    Limiter_j = nodes->GetLimiter_Primitive(jPoint);
+  }
+
+  for (unsigned short iVar = 0; iVar < nPrimVarGrad; iVar++) {
+
+    su2double Project_Grad_i = 0.0;
+    su2double Project_Grad_j = 0.0;
+
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+      Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
+    }
+
+    if (limiter) {
+      if (van_albada) {
+        su2double V_ij = V_j[iVar] - V_i[iVar];
+        Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
+        Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
+      }
+      if (!done_i) Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+      if (!done_j) Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+    }
+    else {
+      if (!done_i) Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
+      if (!done_j) Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
+    }
+
+  }
+
+}
+
+void CEulerSolver::CheckNonPhysicalReconstruction(unsigned long iPoint, unsigned long jPoint,
+                                                  const su2double* Primitive_i, const su2double* Primitive_j,
+                                                  bool& bad_i, bool& bad_j) {
+
+  /*--- If a non-physical state is found, the cell-average value of the solution should be used.
+   This is a locally 1st order approximation, which is typically only active during the start-up
+   of a calculation. ---*/
+
+  bool neg_pres_or_rho_i = (Primitive_i[nDim+1] < 0.0) || (Primitive_i[nDim+2] < 0.0);
+  bool neg_pres_or_rho_j = (Primitive_j[nDim+1] < 0.0) || (Primitive_j[nDim+2] < 0.0);
+
+  su2double R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
+  su2double sq_vel = 0.0;
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    su2double RoeVelocity = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
+    sq_vel += pow(RoeVelocity, 2);
+  }
+  su2double RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
+
+  bool neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+
+  bad_i = neg_sound_speed || neg_pres_or_rho_i;
+  bad_j = neg_sound_speed || neg_pres_or_rho_j;
+
+  nodes->SetNon_Physical(iPoint, bad_i);
+  nodes->SetNon_Physical(jPoint, bad_j);
+
+  /*--- Get updated state, in case the point recovered after the set. ---*/
+  bad_i = nodes->GetNon_Physical(iPoint);
+  bad_j = nodes->GetNon_Physical(jPoint);
+
+}
+
+void CEulerSolver::Upwind_Residual_Batch(CGeometry *geometry, CSolver **solver_container,
+                                         CNumerics **numerics_container, CConfig *config,
+                                         unsigned short iMesh, unsigned long& counter_local) {
+
+  constexpr auto W = CEdgeBatch::WIDTH;
+
+  const bool implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
+  const bool muscl      = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
+  const bool limiter    = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                          (config->GetInnerIter() <= config->GetLimiterIter());
+  const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
+
+  /*--- The batch only carries the primitives used by the ideal gas upwind schemes. ---*/
+  const unsigned short nPrimVarBatch = nDim+4;
+
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+  CNumerics* visc_numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Thread-local batch, and scalar copies of the results of one lane. ---*/
+
+  CEdgeBatch batch;
+  su2double Flux[MAXNVAR] = {0.0}, JacBuffer_i[MAXNVAR][MAXNVAR], JacBuffer_j[MAXNVAR][MAXNVAR];
+  su2double *Jacobian_i[MAXNVAR], *Jacobian_j[MAXNVAR];
+
+  for (unsigned short iVar = 0; iVar < MAXNVAR; iVar++) {
+    Jacobian_i[iVar] = JacBuffer_i[iVar];
+    Jacobian_j[iVar] = JacBuffer_j[iVar];
+  }
+
+  su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
+
+  const bool reducer_strategy = (MGLevel != MESH_0) && (omp_get_num_threads() > 1);
+
+  const auto& dualGrid = geometry->GetDualGridSoA();
+
+  /*--- Two passes with comm/computation overlap (see Upwind_Residual), the batches with halo points are deferred. ---*/
+  const bool comm_overlap = LimiterCommOverlap(config, iMesh);
+
+  for (int pass = 0; pass < (comm_overlap? 2 : 1); ++pass)
+  {
+  if (pass == 1) {
+    SU2_OMP_MASTER
+    CompleteComms(geometry, config, PRIMITIVE_LIMITER);
+    SU2_OMP_BARRIER
+  }
+
+  for (auto color : EdgeColoring)
+  {
+  /*--- Same chunk size as the scalar loop, expressed in number of batches. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE, ColorGroupSize)*ColorGroupSize/W)
+  for (auto k = 0ul; k < color.size; k += W) {
+
+    batch.nLane = min<unsigned long>(W, color.size-k);
+
+    if (comm_overlap) {
+      bool halo = false;
+      for (unsigned short iLane = 0; iLane < batch.nLane; ++iLane) {
+        const auto iEdge = color.indices[k+iLane];
+        halo |= (max(dualGrid.GetNode(iEdge,0), dualGrid.GetNode(iEdge,1)) >= nPointDomain);
+      }
+      if (halo != (pass == 1)) continue;
+    }
+
+    /*--- Gather the edge data (with MUSCL reconstruction) into the batch. ---*/
+
+    for (unsigned short iLane = 0; iLane < batch.nLane; ++iLane) {
+
+      const auto iEdge = color.indices[k+iLane];
+      const auto iPoint = dualGrid.GetNode(iEdge,0);
+      const auto jPoint = dualGrid.GetNode(iEdge,1);
+
+      batch.iEdge[iLane] = iEdge;
+      batch.iPoint[iLane] = iPoint;
+      batch.jPoint[iLane] = jPoint;
+
+      const auto Normal = dualGrid.GetNormal(iEdge);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        batch.Normal[iDim][iLane] = Normal[iDim];
+
+      const su2double* V_i = nodes->GetPrimitive(iPoint);
+      const su2double* V_j = nodes->GetPrimitive(jPoint);
+
+      if (muscl) {
+        MUSCLReconstruction(dualGrid, iEdge, limiter, van_albada, Primitive_i, Primitive_j);
+
+        bool bad_i, bad_j;
+        CheckNonPhysicalReconstruction(iPoint, jPoint, Primitive_i, Primitive_j, bad_i, bad_j);
+        counter_local += bad_i+bad_j;
+
+        if (!bad_i) V_i = Primitive_i;
+        if (!bad_j) V_j = Primitive_j;
+      }
+
+      for (unsigned short iVar = 0; iVar < nPrimVarBatch; iVar++) {
+        batch.V_i[iVar][iLane] = V_i[iVar];
+        batch.V_j[iVar][iLane] = V_j[iVar];
+      }
+    }
+    batch.PadLanes(nDim, nPrimVarBatch);
+
+    /*--- Compute the fluxes of all the edges at once. ---*/
+
+    numerics->ComputeResidualBatch(batch, config);
+
+    /*--- Scatter, lanes are processed in sequence as they may share points. ---*/
+
+    for (unsigned short iLane = 0; iLane < batch.nLane; ++iLane) {
+
+      const auto iEdge = batch.iEdge[iLane];
+      const auto iPoint = batch.iPoint[iLane];
+      const auto jPoint = batch.jPoint[iLane];
+
+      batch.GetLane(iLane, nVar, Flux, implicit? Jacobian_i : nullptr, Jacobian_j);
+
+      if (reducer_strategy) {
+        EdgeFluxes.SetBlock(iEdge, Flux);
+        if (implicit)
+          Jacobian.UpdateBlocks(iEdge, Jacobian_i, Jacobian_j);
+      }
+      else {
+        LinSysRes.AddBlock(iPoint, Flux);
+        LinSysRes.SubtractBlock(jPoint, Flux);
+        if (implicit)
+          Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+      }
+
+      /*--- Viscous contribution. ---*/
+
+      Viscous_Residual(iEdge, geometry, solver_container, visc_numerics, config);
+    }
+  }
+  } // end color loop
+  } // end pass loop
+
+}
+
 void CEulerSolver::SumEdgeFluxes(CGeometry* geometry) {
 
+  const auto& dualGrid = geometry->GetDualGridSoA();
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
-    for (unsigned short iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); ++iNeigh) {
+    const auto edges = dualGrid.GetNeighborEdges(iPoint);
 
-      auto iEdge = geometry->node[iPoint]->GetEdge(iNeigh);
+    for (unsigned long iNeigh = 0; iNeigh < dualGrid.GetnNeighbor(iPoint); ++iNeigh) {
+
+      auto iEdge = edges[iNeigh];
 
-      if (iPoint == geometry->edge[iEdge]->GetNode(0))
+      if (iPoint == dualGrid.GetNode(iEdge,0))
         LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
       else
         LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
@@ -3319,7 +3582,7 @@ void CEulerSolver::LowMachPrimitiveCorrection(CFluidModel *fluidModel, unsigned
 void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   const bool rotating_frame   = config->GetRotating_Frame();
   const bool axisymmetric     = config->GetAxisymmetric();
   const bool gravity          = (config->GetGravityForce() == YES);
@@ -4627,7 +4890,23 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
 void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  const bool adjoint = config->GetContinuous_Adjoint();
+  PrepareImplicitIteration(geometry, solver_container, config);
+
+  /*--- Solve or smooth the linear system. ---*/
+
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
+
+  CompleteImplicitIteration(geometry, solver_container, config);
+}
+
+void CEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
   const bool roe_turkel = config->GetKind_Upwind_Flow() == TURKEL;
   const bool low_mach_prec = config->Low_Mach_Preconditioning();
 
@@ -4729,17 +5008,13 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
       delete [] LowMachPrec[iVar];
     delete [] LowMachPrec;
   }
+  SU2_OMP_BARRIER
 
-  /*--- Solve or smooth the linear system. ---*/
+}
 
-  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
-  SU2_OMP_MASTER
-  {
-    SetIterLinSolver(iter);
-    SetResLinSolver(System.GetResidual());
-  }
-  SU2_OMP_BARRIER
+void CEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
+  const bool adjoint = config->GetContinuous_Adjoint();
 
   ComputeUnderRelaxationFactor(solver_container, config);
 
@@ -4861,8 +5136,44 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   auto& primMax = nodes->GetSolution_Max();
   auto& limiter = nodes->GetLimiter_Primitive();
 
+  /*--- With comm/computation overlap the limiters are exchanged by Upwind_Residual. ---*/
+
   computeLimiters(kindLimiter, this, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1, PERIODIC_LIM_PRIM_2,
-            *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
+            *geometry, *config, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiter,
+            !LimiterCommOverlap(config, MGLevel));
+}
+
+void CEulerSolver::SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config, bool reconstruction) {
+
+  /*--- Past LIMITER_ITER the states are not limited (as in Upwind_Residual). ---*/
+
+  const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                       (config->GetInnerIter() <= config->GetLimiterIter());
+
+  auto kindLimiter = limiter? static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow()) : NO_LIMITER;
+  auto kindGradient = reconstruction? config->GetKind_Gradient_Method_Recon() : config->GetKind_Gradient_Method();
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  auto& primMin = nodes->GetSolution_Min();
+  auto& primMax = nodes->GetSolution_Max();
+  auto& limiters = nodes->GetLimiter_Primitive();
+
+  /*--- One state per point-neighbor pair, no reallocation if the size does not change. ---*/
+
+  SU2_OMP_MASTER
+  ReconstructedStates.resize(geometry->GetDualGridSoA().GetNeighborPattern().getNumNonZeros(), nPrimVarGrad);
+  SU2_OMP_BARRIER
+
+  /*--- With comm/computation overlap the limiters are exchanged by Upwind_Residual. ---*/
+
+  computeGradientsAndLimiters(kindLimiter, this, PRIMITIVE_GRADIENT, PRIMITIVE_LIMITER, *geometry, *config,
+            kindGradient, 0, nPrimVarGrad, primitives, gradient, primMin, primMax, limiters,
+            ReconstructedStates, !LimiterCommOverlap(config, MGLevel));
+
+  SU2_OMP_MASTER
+  ReconstructedStatesSet = true;
+  SU2_OMP_BARRIER
 }
 
 void CEulerSolver::SetPreconditioner(const CConfig *config, unsigned long iPoint,
@@ -6781,7 +7092,7 @@ void CEulerSolver::BC_Sym_Plane(CGeometry      *geometry,
   unsigned short iDim, iVar;
   unsigned long iVertex, iPoint;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT),
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only,
        viscous  = config->GetViscous();
 
   /*--- Allocation of variables necessary for convective fluxes. ---*/
@@ -7065,7 +7376,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
   su2double Gas_Constant     = config->GetGas_ConstantND();
 
-  bool implicit       = config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT;
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   bool viscous        = config->GetViscous();
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
 
@@ -7320,7 +7631,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   su2double *gridVel;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
 
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
   bool gravity = (config->GetGravityForce());
@@ -7826,7 +8137,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   su2double AverageEnthalpy, AverageEntropy;
   unsigned short  iZone  = config->GetiZone();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
   bool viscous = config->GetViscous();
@@ -8483,7 +8794,7 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container, CNu
   su2double Pressure_e;
   su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
   unsigned short  iZone     = config->GetiZone();
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool viscous              = config->GetViscous();
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(config->GetMarker_All_TurbomachineryFlag(val_marker));
@@ -9223,7 +9534,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
   su2double *V_inlet, *V_domain;
 
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   su2double Two_Gamma_M1       = 2.0/Gamma_Minus_One;
   su2double Gas_Constant       = config->GetGas_ConstantND();
   unsigned short Kind_Inlet = config->GetKind_Inlet();
@@ -9520,7 +9831,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   Area, UnitNormal[3];
   su2double *V_outlet, *V_domain;
 
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   su2double Gas_Constant     = config->GetGas_ConstantND();
   string Marker_Tag       = config->GetMarker_All_TagBound(val_marker);
   bool gravity = (config->GetGravityForce());
@@ -9693,7 +10004,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   su2double Density, Pressure, Temperature, Energy, *Vel, Velocity2;
   su2double Gas_Constant = config->GetGas_ConstantND();
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   su2double *Normal = new su2double[nDim];
@@ -9835,7 +10146,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   unsigned long iVertex, iPoint;
   su2double *V_outlet, *V_domain;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   su2double *Normal = new su2double[nDim];
@@ -9957,7 +10268,7 @@ void CEulerSolver::BC_Engine_Inflow(CGeometry *geometry, CSolver **solver_contai
   su2double *V_inflow, *V_domain;
 
   su2double DampingFactor = config->GetDamp_Engine_Inflow();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   unsigned short Kind_Engine_Inflow = config->GetKind_Engine_Inflow();
   su2double Gas_Constant = config->GetGas_ConstantND();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
@@ -10179,7 +10490,7 @@ void CEulerSolver::BC_Engine_Exhaust(CGeometry *geometry, CSolver **solver_conta
   su2double *V_exhaust, *V_domain, Target_Exhaust_Pressure, Exhaust_Pressure_old, Exhaust_Pressure_inc;
 
   su2double Gas_Constant = config->GetGas_ConstantND();
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   su2double DampingFactor = config->GetDamp_Engine_Exhaust();
@@ -10431,7 +10742,7 @@ void CEulerSolver::BC_Fluid_Interface(CGeometry *geometry, CSolver **solver_cont
   unsigned long iVertex, jVertex, iPoint, Point_Normal = 0;
   unsigned short iDim, iVar, jVar, iMarker, nDonorVertex;
 
-  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit      = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   bool viscous       = config->GetViscous();
 
   su2double Normal[MAXNDIM] = {0.0};
@@ -10598,7 +10909,7 @@ void CEulerSolver::BC_Interface_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
 
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -10660,7 +10971,7 @@ void CEulerSolver::BC_NearField_Boundary(CGeometry *geometry, CSolver **solver_c
   unsigned long iVertex, iPoint, GlobalIndex_iPoint, GlobalIndex_jPoint;
   unsigned short iDim, iVar;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
 
   su2double *Normal = new su2double[nDim];
   su2double *PrimVar_i = new su2double[nPrimVar];
@@ -10749,7 +11060,7 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
   Mach_out, Pressure_in, Density_in, SoundSpeed_in, Velocity2_in,
   Mach_in, PressureAdj, TemperatureAdj;
 
-  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   su2double Gas_Constant  = config->GetGas_ConstantND();
   bool tkeNeeded          = (config->GetKind_Turb_Model() == SST) || (config->GetKind_Turb_Model() == SST_SUST);
   bool ratio              = (config->GetActDisk_Jump() == RATIO);
@@ -11173,7 +11484,7 @@ void CEulerSolver::BC_Custom(CGeometry      *geometry,
     unsigned short iVar;
     unsigned long iVertex, iPoint, total_index;
 
-    bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
 
     /*--- Get the physical time. ---*/
 
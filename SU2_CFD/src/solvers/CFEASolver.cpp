@@ -221,10 +221,23 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   if (config->GetRefGeom()) Set_ReferenceGeometry(geometry, config);
   if (config->GetPrestretch()) Set_Prestretch(geometry, config);
 
-  /*--- Initialization of matrix structures ---*/
-  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
-
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  /*--- Initialization of matrix structures, in matrix-free mode the stiffness
+   *    matrix is applied element by element and only its diagonal is stored. ---*/
+  matrix_free = config->GetMatrixFree_Elasticity();
+
+  if (matrix_free) {
+    if ((config->GetGeometricConditions() != SMALL_DEFORMATIONS) || dynamic || de_effects ||
+        config->GetPrestretch() || config->GetDiscrete_Adjoint()) {
+      SU2_MPI::Error("MATRIX_FREE_ELASTICITY is only available for static linear elasticity (primal).",
+                     CURRENT_FUNCTION);
+    }
+    if (rank == MASTER_NODE) cout << "Initialize matrix-free structures (Linear Elasticity)." << endl;
+    InitializeMatrixFree(geometry);
+  }
+  else {
+    if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  }
 
   if (dynamic) {
     MassMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
@@ -818,13 +831,30 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Profiling (only when compiled with -DPROFILE). ---*/
+  double tick = 0.0;
+  config->Tick(&tick);
+
+  /*--- The matrix-free product uses the same numerics, the Dirichlet conditions are set again after this. ---*/
+  if (matrix_free) {
+    MatrixFree_Numerics = numerics;
+    EnforcedNode.assign(nPoint, false);
+  }
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
   {
     /*--- Clear vector and matrix before calculation. ---*/
     LinSysRes.SetValZero();
-    Jacobian.SetValZero();
+
+    if (!matrix_free) {
+      Jacobian.SetValZero();
+    }
+    else {
+      SU2_OMP_FOR_STAT(omp_chunk_size)
+      for (auto i = 0ul; i < BlockDiag.size(); ++i) BlockDiag[i] = 0.0;
+    }
 
     for(auto color : ElemColoring) {
 
@@ -883,9 +913,18 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
           for (iVar = 0; iVar < nVar; iVar++)
             LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
 
+          if (matrix_free) {
+            /*--- Only the diagonal blocks are kept, for the preconditioner. ---*/
+            auto Kaa = element->Get_Kab(iNode, iNode);
+            auto Dii = &BlockDiag[indexNode[iNode]*nVar*nVar];
+            for (iVar = 0; iVar < nVar*nVar; iVar++)
+              Dii[iVar] += SU2_TYPE::GetValue(simp_penalty*Kaa[iVar]);
+            continue;
+          }
+
           for (jNode = 0; jNode < nNodes; jNode++) {
             auto Kab = element->Get_Kab(iNode, jNode);
-            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], simp_penalty, Kab);
+            Jacobian.AddElemBlock(iElem, nNodes, iNode, jNode, simp_penalty, Kab);
           }
         }
 
@@ -895,6 +934,8 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
 
   } // end SU2_OMP_PARALLEL
 
+  config->Tock(tick, "Compute_StiffMatrix", 2);
+
 }
 
 void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumerics **numerics, CConfig *config) {
@@ -906,6 +947,10 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Profiling (only when compiled with -DPROFILE). ---*/
+  double tick = 0.0;
+  config->Tick(&tick);
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -1000,7 +1045,7 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
           for (jNode = 0; jNode < nNodes; jNode++) {
 
             /*--- Get a pointer to the matrix block to perform the update. ---*/
-            auto Kij = Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
+            auto Kij = Jacobian.GetElemBlock(iElem, nNodes, iNode, jNode);
 
             /*--- Retrieve the values of the FEA term. ---*/
             auto Kab = fea_elem->Get_Kab(iNode, jNode);
@@ -1031,6 +1076,8 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
 
   } // end SU2_OMP_PARALLEL
 
+  config->Tock(tick, "Compute_StiffMatrix_NodalStressRes", 2);
+
 }
 
 void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CNumerics **numerics, CConfig *config) {
@@ -1038,6 +1085,10 @@ void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CNumerics **numerics, C
   const bool topology_mode = config->GetTopology_Optimization();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
 
+  /*--- Profiling (only when compiled with -DPROFILE). ---*/
+  double tick = 0.0;
+  config->Tick(&tick);
+
   /*--- Start OpenMP parallel region. ---*/
 
   SU2_OMP_PARALLEL
@@ -1093,7 +1144,7 @@ void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CNumerics **numerics, C
 
           for (jNode = 0; jNode < nNodes; jNode++) {
 
-            auto Mij = MassMatrix.GetBlock(indexNode[iNode], indexNode[jNode]);
+            auto Mij = MassMatrix.GetElemBlock(iElem, nNodes, iNode, jNode);
             su2double Mab = element->Get_Mab(iNode, jNode);
 
             for (iVar = 0; iVar < nVar; iVar++)
@@ -1107,6 +1158,8 @@ void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CNumerics **numerics, C
 
   } // end SU2_OMP_PARALLEL
 
+  config->Tock(tick, "Compute_MassMatrix", 2);
+
 }
 
 void CFEASolver::Compute_MassRes(CGeometry *geometry, CNumerics **numerics, CConfig *config) {
@@ -1698,7 +1751,7 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, CNumerics *numerics, CConfig *c
 
     LinSysSol.SetBlock(iPoint, zeros);
     LinSysReact.SetBlock(iPoint, zeros);
-    Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+    EnforceSolutionAtNode(iPoint, zeros);
 
   }
 
@@ -1762,7 +1815,7 @@ void CFEASolver::BC_DispDir(CGeometry *geometry, CNumerics *numerics, CConfig *c
       LinSysSol(iNode,iDim) = DispDir[iDim] - nodes->GetSolution(iNode,iDim);
 
     /*--- Enforce the solution. ---*/
-    Jacobian.EnforceSolutionAtNode(iNode, LinSysSol.GetBlock(iNode), LinSysRes);
+    EnforceSolutionAtNode(iNode, LinSysSol.GetBlock(iNode));
   }
 
 }
@@ -1795,21 +1848,44 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
     /*--- If the problem is linear, the only check we do is the RMS of the residuals. ---*/
     /*---  Compute the residual Ax-f ---*/
 
+    if (matrix_free) {
+      MatrixFree_Geometry = geometry;
+      MatrixFree_Numerics = numerics;
+      MatrixFree_Config = config;
+    }
+
     SU2_OMP_PARALLEL
     {
+      if (matrix_free) {
+        /*--- The product is computed in the precision of the linear solver. ---*/
+        auto& sol = MatrixFree_Work[0];
+        auto& prod = MatrixFree_Work[1];
+        sol.PassiveCopy(LinSysSol);
+        MatrixFreeProduct(sol, prod);
+        LinSysAux.PassiveCopy(prod);
+        LinSysAux.Equals_AX_Plus_BY(1.0, LinSysRes, -1.0, LinSysAux);
+
+        /*--- The product is complete at the ghost points (it is communicated) but the
+         *    right hand side was cleared there by Solve_System, skip their residual. ---*/
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER
+        for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+          LinSysAux.SetBlock_Zero(iPoint);
+        SU2_OMP_BARRIER
+      }
+      else {
 #ifndef CODI_REVERSE_TYPE
-      Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
+        Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
 #else
-      /*---  We need temporaries to interface with the matrix ---*/
-      {
+        /*---  We need temporaries to interface with the matrix ---*/
         CSysVector<passivedouble> sol, res;
         sol.PassiveCopy(LinSysSol);
         res.PassiveCopy(LinSysRes);
         CSysVector<passivedouble> aux(res);
         Jacobian.ComputeResidual(sol, res, aux);
         LinSysAux.PassiveCopy(aux);
-      }
 #endif
+      }
     } // end SU2_OMP_PARALLEL
 
     /*--- Set maximum residual to zero. ---*/
@@ -2076,7 +2152,7 @@ void CFEASolver::BC_Deforming(CGeometry *geometry, CNumerics *numerics, CConfig
 
     /*--- Set and enforce solution ---*/
     LinSysSol.SetBlock(iNode, Disp);
-    Jacobian.EnforceSolutionAtNode(iNode, Disp, LinSysRes);
+    EnforceSolutionAtNode(iNode, Disp);
 
   }
 
@@ -2720,8 +2796,38 @@ void CFEASolver::GeneralizedAlpha_UpdateLoads(CGeometry *geometry, CSolver **sol
 
 void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
 
+  if (matrix_free) {
+    MatrixFree_Geometry = geometry;
+    MatrixFree_Config = config;
+    System.SetMatrixFreeProduct(&MatrixFree_Product);
+    System.SetMatrixFreePreconditioner(&MatrixFree_Prec);
+  }
+
   SU2_OMP_PARALLEL
   {
+  if (matrix_free) {
+    /*--- Move the columns of the enforced nodes to the right hand side, which is what
+     *    EnforceSolutionAtNode does with an assembled matrix (b -= K*x_enforced).
+     *    This is done before clearing the ghost points, which can also be enforced. ---*/
+    auto& x = MatrixFree_Work[0];
+    auto& Kx = MatrixFree_Work[1];
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        x(iPoint,iVar) = EnforcedNode[iPoint]? SU2_TYPE::GetValue(LinSysSol(iPoint,iVar)) : 0.0;
+
+    MatrixFreeProduct(x, Kx, false);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (auto iVar = 0ul; iVar < nVar; iVar++) {
+        if (EnforcedNode[iPoint]) LinSysRes(iPoint,iVar) = LinSysSol(iPoint,iVar);
+        else LinSysRes(iPoint,iVar) -= Kx(iPoint,iVar);
+      }
+    }
+  }
+
   /*--- Initialize residual and solution at the ghost points ---*/
 
   SU2_OMP(sections)
@@ -2746,6 +2852,253 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
   SU2_OMP_BARRIER
 
   } // end SU2_OMP_PARALLEL
+
+  if (matrix_free) {
+    System.SetMatrixFreeProduct(nullptr);
+    System.SetMatrixFreePreconditioner(nullptr);
+  }
+}
+
+void CFEASolver::InitializeMatrixFree(CGeometry *geometry) {
+
+  EnforcedNode.assign(nPoint, false);
+  BlockDiag.assign(nPoint*nVar*nVar, 0.0);
+  BlockDiagInv.assign(nPoint*nVar*nVar, 0.0);
+
+  for (auto& vec : MatrixFree_Work)
+    vec.Initialize(nPoint, nPointDomain, nVar, 0.0);
+}
+
+void CFEASolver::EnforceSolutionAtNode(unsigned long iPoint, const su2double *x_i) {
+
+  if (!matrix_free) {
+    Jacobian.EnforceSolutionAtNode(iPoint, x_i, LinSysRes);
+    return;
+  }
+
+  /*--- The solution is the initial guess of the linear solver, the rest is done by Solve_System. ---*/
+  EnforcedNode[iPoint] = true;
+  LinSysSol.SetBlock(iPoint, x_i);
+}
+
+void CFEASolver::MatrixFreeProduct(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v, bool constrained) {
+
+  const auto geometry = MatrixFree_Geometry;
+  const auto numerics = MatrixFree_Numerics;
+  const auto config = MatrixFree_Config;
+
+  const bool topology_mode = config->GetTopology_Optimization();
+  const su2double simp_exponent = config->GetSIMP_Exponent();
+  const su2double simp_minstiff = config->GetSIMP_MinStiffness();
+
+  /*--- Make the view of the vectors consistent before the element loop (the
+   *    vector operations of the linear solver do not synchronize the threads). ---*/
+  v.SetValZero();
+  SU2_OMP_BARRIER
+
+  /*--- Profiling (only when compiled with -DPROFILE), timed by the master thread. ---*/
+  double tick = 0.0;
+  SU2_OMP_MASTER
+  config->Tick(&tick);
+
+  for(auto color : ElemColoring) {
+
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(roundUpDiv(OMP_MIN_SIZE, ColorGroupSize)*ColorGroupSize)
+    for(auto k = 0ul; k < color.size; ++k) {
+
+      auto iElem = color.indices[k];
+
+      unsigned short iNode, iDim;
+
+      int thread = omp_get_thread_num();
+
+      /*--- Convert VTK type to index in the element container. ---*/
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+
+      /*--- Each thread needs a dedicated element. ---*/
+      CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+
+      /*--- Gather the reference coordinates and the vector at the nodes, the
+       *    columns of the enforced nodes are not part of the operator. ---*/
+      unsigned long indexNode[MAXNNODE];
+      su2double nodalVector[MAXNNODE*MAXNVAR];
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+
+        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+        const bool enforced = constrained && EnforcedNode[indexNode[iNode]];
+
+        for (iDim = 0; iDim < nDim; iDim++) {
+          element->SetRef_Coord(iNode, iDim, Get_ValCoord(geometry, indexNode[iNode], iDim));
+          nodalVector[iNode*nDim+iDim] = enforced? 0.0 : u(indexNode[iNode], iDim);
+        }
+      }
+
+      /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
+      su2double simp_penalty = 1.0;
+      if (topology_mode) {
+        su2double density = element_properties[iElem]->GetPhysicalDensity();
+        simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+      }
+
+      element->Set_ElProperties(element_properties[iElem]);
+
+      int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+
+      numerics[NUM_TERM]->Compute_Stiffness_Product(element, nodalVector, config);
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+        auto Ka = element->Get_Kt_a(iNode);
+        for (iDim = 0; iDim < nDim; iDim++)
+          v(indexNode[iNode], iDim) += SU2_TYPE::GetValue(simp_penalty*Ka[iDim]);
+      }
+
+    } // end iElem loop
+
+  } // end color loop
+
+  /*--- The rows of the enforced nodes are those of the identity. ---*/
+  if (constrained) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
+      if (EnforcedNode[iPoint])
+        for (auto iVar = 0ul; iVar < nVar; iVar++) v(iPoint,iVar) = u(iPoint,iVar);
+  }
+
+  /*--- MPI Parallelization by master thread, the matrix is only used for its communication
+   *    pattern (periodic and halo exchanges of vectors, it does not need to be allocated). ---*/
+  SU2_OMP_MASTER
+  {
+    Jacobian.InitiateComms(v, geometry, config, SOLUTION_MATRIX);
+    Jacobian.CompleteComms(v, geometry, config, SOLUTION_MATRIX);
+    config->Tock(tick, "MatrixFreeProduct", 2);
+  }
+  SU2_OMP_BARRIER
+}
+
+void CFEASolver::ApplyBlockDiagInv(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v, ScalarType scale) {
+
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const auto Dinv = &BlockDiagInv[iPoint*nVar*nVar];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) {
+      ScalarType sum = 0.0;
+      for (auto jVar = 0ul; jVar < nVar; jVar++)
+        sum += Dinv[iVar*nVar+jVar] * u(iPoint,jVar);
+      v(iPoint,iVar) = scale*sum;
+    }
+  }
+
+  SU2_OMP_MASTER
+  {
+    Jacobian.InitiateComms(v, MatrixFree_Geometry, MatrixFree_Config, SOLUTION_MATRIX);
+    Jacobian.CompleteComms(v, MatrixFree_Geometry, MatrixFree_Config, SOLUTION_MATRIX);
+  }
+  SU2_OMP_BARRIER
+}
+
+void CFEASolver::BuildMatrixFreePreconditioner() {
+
+  /*--- Invert the diagonal blocks (symmetric positive definite 2x2 or 3x3),
+   *    the blocks of the enforced nodes are the identity. ---*/
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    const auto D = &BlockDiag[iPoint*nVar*nVar];
+    auto Dinv = &BlockDiagInv[iPoint*nVar*nVar];
+
+    if (EnforcedNode[iPoint]) {
+      for (auto iVar = 0ul; iVar < nVar; iVar++)
+        for (auto jVar = 0ul; jVar < nVar; jVar++)
+          Dinv[iVar*nVar+jVar] = (iVar == jVar)? 1.0 : 0.0;
+    }
+    else if (nVar == 2) {
+      const ScalarType invDet = 1.0 / (D[0]*D[3] - D[1]*D[2]);
+      Dinv[0] =  D[3]*invDet;  Dinv[1] = -D[1]*invDet;
+      Dinv[2] = -D[2]*invDet;  Dinv[3] =  D[0]*invDet;
+    }
+    else {
+      Dinv[0] = D[4]*D[8] - D[5]*D[7];
+      Dinv[1] = D[2]*D[7] - D[1]*D[8];
+      Dinv[2] = D[1]*D[5] - D[2]*D[4];
+      Dinv[3] = D[5]*D[6] - D[3]*D[8];
+      Dinv[4] = D[0]*D[8] - D[2]*D[6];
+      Dinv[5] = D[2]*D[3] - D[0]*D[5];
+      Dinv[6] = D[3]*D[7] - D[4]*D[6];
+      Dinv[7] = D[1]*D[6] - D[0]*D[7];
+      Dinv[8] = D[0]*D[4] - D[1]*D[3];
+      const ScalarType invDet = 1.0 / (D[0]*Dinv[0] + D[1]*Dinv[3] + D[2]*Dinv[6]);
+      for (auto iVar = 0ul; iVar < 9; iVar++) Dinv[iVar] *= invDet;
+    }
+  }
+
+  if (MatrixFree_Config->GetMatrixFree_Chebyshev_Degree() == 0) return;
+
+  /*--- Estimate the largest eigenvalue of D^-1 K with a few power iterations,
+   *    the Chebyshev polynomial is then built on [lambda/30, 1.1*lambda]. ---*/
+
+  auto& x = MatrixFree_Work[0];
+  auto& Kx = MatrixFree_Work[1];
+
+  x = ScalarType(1.0);
+  ScalarType lambda = x.norm();
+
+  for (int iIter = 0; iIter < 10; ++iIter) {
+    MatrixFreeProduct(x, Kx);
+    ApplyBlockDiagInv(Kx, x, 1.0/lambda);
+    lambda = x.norm();
+  }
+
+  SU2_OMP_MASTER
+  LambdaMax = lambda;
+  SU2_OMP_BARRIER
+}
+
+void CFEASolver::MatrixFreePreconditioner(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) {
+
+  const auto degree = MatrixFree_Config->GetMatrixFree_Chebyshev_Degree();
+
+  if (degree == 0) {
+    ApplyBlockDiagInv(u, v, 1.0);
+    return;
+  }
+
+  /*--- Chebyshev iteration for K*v = u, starting from v = 0, preconditioned by the diagonal blocks.
+   *    Each degree costs one matrix-free product, the result is a fixed polynomial of D^-1 K times
+   *    D^-1, which is symmetric and therefore also suitable for the conjugate gradient method. ---*/
+
+  auto& r = MatrixFree_Work[0];
+  auto& d = MatrixFree_Work[1];
+  auto& t = MatrixFree_Work[2];
+
+  const ScalarType lambdaMax = 1.1*LambdaMax, lambdaMin = LambdaMax/30;
+  const ScalarType theta = 0.5*(lambdaMax+lambdaMin), delta = 0.5*(lambdaMax-lambdaMin);
+  const ScalarType sigma = theta / delta;
+  ScalarType rho = 1.0 / sigma;
+
+  ApplyBlockDiagInv(u, d, 1.0/theta);
+  v = d;
+  r = u;
+
+  for (auto iDegree = 0u; iDegree < degree; ++iDegree) {
+
+    MatrixFreeProduct(d, t);
+    r.Plus_AX(-1.0, t);
+
+    const ScalarType rhoNew = 1.0 / (2.0*sigma - rho);
+
+    ApplyBlockDiagInv(r, t, 1.0);
+    d.Equals_AX_Plus_BY(rhoNew*rho, d, 2.0*rhoNew/delta, t);
+    v += d;
+
+    rho = rhoNew;
+  }
 }
 
 
@@ -35,8 +35,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = NULL;
-
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
   CFx_Inv = NULL; CFy_Inv = NULL; CFz_Inv = NULL;
@@ -69,8 +67,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Basic array initialization ---*/
 
-  FluidModel = NULL;
-
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
   CFx_Inv = NULL; CFy_Inv = NULL; CFz_Inv = NULL;
@@ -114,8 +110,6 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
 
   /*--- Array initialization ---*/
-  FluidModel = NULL;
-
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL; CEff_Inv = NULL;
   CMx_Inv = NULL;   CMy_Inv = NULL;   CMz_Inv = NULL;
   CFx_Inv = NULL;   CFy_Inv = NULL;   CFz_Inv = NULL;
@@ -730,7 +724,7 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
-  if(FluidModel    != NULL) delete FluidModel;
+  for(auto& model : FluidModel) delete model;
   if(blasFunctions != NULL) delete blasFunctions;
 
   /*--- Array deallocation ---*/
@@ -806,6 +800,8 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   Density_FreeStream  = config->GetDensity_FreeStream();
   Temperature_FreeStream  = config->GetTemperature_FreeStream();
 
+  CFluidModel* auxFluidModel = nullptr;
+
   switch (config->GetKind_FluidModel()) {
 
     case STANDARD_AIR:
@@ -813,69 +809,69 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       if (config->GetSystemMeasurements() == SI) config->SetGas_Constant(287.058);
       else if (config->GetSystemMeasurements() == US) config->SetGas_Constant(1716.49);
 
-      FluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(1.4, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case IDEAL_GAS:
 
-      FluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
+      auxFluidModel = new CIdealGas(Gamma, config->GetGas_Constant(), config->GetCompute_Entropy());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case VW_GAS:
 
-      FluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
-                                       config->GetPressure_Critical(), config->GetTemperature_Critical());
+      auxFluidModel = new CVanDerWaalsGas(Gamma, config->GetGas_Constant(),
+                                          config->GetPressure_Critical(), config->GetTemperature_Critical());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
     case PR_GAS:
 
-      FluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
-                                     config->GetTemperature_Critical(), config->GetAcentric_Factor());
+      auxFluidModel = new CPengRobinson(Gamma, config->GetGas_Constant(), config->GetPressure_Critical(),
+                                        config->GetTemperature_Critical(), config->GetAcentric_Factor());
       if (free_stream_temp) {
-        FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
-        Density_FreeStream = FluidModel->GetDensity();
+        auxFluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
+        Density_FreeStream = auxFluidModel->GetDensity();
         config->SetDensity_FreeStream(Density_FreeStream);
       }
       else {
-        FluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
-        Temperature_FreeStream = FluidModel->GetTemperature();
+        auxFluidModel->SetTDState_Prho(Pressure_FreeStream, Density_FreeStream );
+        Temperature_FreeStream = auxFluidModel->GetTemperature();
         config->SetTemperature_FreeStream(Temperature_FreeStream);
       }
       break;
 
   }
 
-  Mach2Vel_FreeStream = FluidModel->GetSoundSpeed();
+  Mach2Vel_FreeStream = auxFluidModel->GetSoundSpeed();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
 
@@ -924,17 +920,17 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
             from the dimensional version of Sutherland's law or the constant
             viscosity, depending on the input option.---*/
 
-      FluidModel->SetLaminarViscosityModel(config);
+      auxFluidModel->SetLaminarViscosityModel(config);
 
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
 
       Density_FreeStream = Reynolds*Viscosity_FreeStream/(Velocity_Reynolds*config->GetLength_Reynolds());
       config->SetDensity_FreeStream(Density_FreeStream);
-      FluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
-      Pressure_FreeStream = FluidModel->GetPressure();
+      auxFluidModel->SetTDState_rhoT(Density_FreeStream, Temperature_FreeStream);
+      Pressure_FreeStream = auxFluidModel->GetPressure();
       config->SetPressure_FreeStream(Pressure_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -942,10 +938,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     else {
 
-      FluidModel->SetLaminarViscosityModel(config);
-      Viscosity_FreeStream = FluidModel->GetLaminarViscosity();
+      auxFluidModel->SetLaminarViscosityModel(config);
+      Viscosity_FreeStream = auxFluidModel->GetLaminarViscosity();
       config->SetViscosity_FreeStream(Viscosity_FreeStream);
-      Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+      Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
     }
 
@@ -959,7 +955,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     /*--- For inviscid flow, energy is calculated from the specified
      FreeStream quantities using the proper gas law. ---*/
 
-    Energy_FreeStream = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
+    Energy_FreeStream = auxFluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStream*ModVel_FreeStream;
 
   }
 
@@ -1038,37 +1034,9 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
 
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
-
-  delete FluidModel;
-
-  switch (config->GetKind_FluidModel()) {
-
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-  }
+  /*--- Auxiliary (dimensional) FluidModel no longer needed. ---*/
 
-  Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+  delete auxFluidModel;
 
   if (viscous) {
 
@@ -1083,12 +1051,50 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     /* constant thermal conductivity model */
     config->SetKt_ConstantND(config->GetKt_Constant()/Conductivity_Ref);
+  }
+
+  /*--- Create one fluid model object per OpenMP thread, the tasks of the residual
+        computation are carried out in parallel (see ProcessTaskList_DG).
+        GetFluidModel() returns the object of the calling thread. ---*/
+
+  for(auto& model : FluidModel) delete model;
+  FluidModel.assign(omp_get_max_threads(), nullptr);
+
+  SU2_OMP_PARALLEL
+  {
+    const int thread = omp_get_thread_num();
+
+    switch (config->GetKind_FluidModel()) {
+
+      case STANDARD_AIR:
+        FluidModel[thread] = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
+
+      case IDEAL_GAS:
+        FluidModel[thread] = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        break;
 
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+      case VW_GAS:
+        FluidModel[thread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                 config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+
+      case PR_GAS:
+        FluidModel[thread] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                               config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+    }
 
+    GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+
+    if (viscous) {
+      GetFluidModel()->SetLaminarViscosityModel(config);
+      GetFluidModel()->SetThermalConductivityModel(config);
+    }
   }
 
+  Energy_FreeStreamND = GetFluidModel()->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -2307,7 +2313,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             /* Create the dependencies for this task. */
             prevInd[0] = indexInList[CTaskDefinition::VOLUME_RESIDUAL][level];
             prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED][level];
-            prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
+            prevInd[2] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
             prevInd[3] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS][level];
             prevInd[4] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
 
@@ -2462,6 +2468,9 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
     tasksList.push_back(CTaskDefinition(CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS, 0,  2, 6, 9, 10, 11)); // Task 12
     tasksList.push_back(CTaskDefinition(CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX,                 0, 12));               // Task 13
   }
+
+  /* Store the dependencies in the form needed to carry out the tasks in parallel. */
+  taskScheduler.SetTasks(tasksList);
 }
 
 void CFEM_DG_EulerSolver::Prepare_MPI_Communication(const CMeshFEM *FEMGeometry,
@@ -3155,9 +3164,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
           const su2double Mom2         = solDOF[1]*solDOF[1] + solDOF[2]*solDOF[2];
           const su2double StaticEnergy = DensityInv*(solDOF[3] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3181,9 +3190,9 @@ void CFEM_DG_EulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_co
                                        + solDOF[3]*solDOF[3];
           const su2double StaticEnergy = DensityInv*(solDOF[4] - 0.5*DensityInv*Mom2);
 
-          FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-          const su2double Pressure    = FluidModel->GetPressure();
-          const su2double Temperature = FluidModel->GetTemperature();
+          GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+          const su2double Pressure    = GetFluidModel()->GetPressure();
+          const su2double Temperature = GetFluidModel()->GetTemperature();
 
           if((Pressure < 0.0) || (solDOF[0] < 0.0) || (Temperature < 0.0)) {
             ++ErrorCounter;
@@ -3639,8 +3648,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3671,8 +3680,8 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
 
               /*--- Compute the maximum value of the wave speed. This is a rather
                     conservative estimate. ---*/
-              FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-              const su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
+              GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+              const su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
               const su2double SoundSpeed  = sqrt(fabs(SoundSpeed2));
 
               const su2double radx     = fabs(u-gridVel[0]) + SoundSpeed;
@@ -3783,311 +3792,259 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   /* Easier storage of the number of time levels.. */
   const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
-
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
-
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
+  /* Allocate the memory for the work arrays of the threads and initialize it to
+     zero to avoid warnings in debug mode about uninitialized memory when padding
+     is applied. */
+  vector<su2double> workArrayVec(omp_get_max_threads()*sizeWorkArray, 0.0);
+
+  /* The tasks are carried out by all the threads, see CTaskScheduler. */
+  SU2_OMP_PARALLEL
+  {
+    /* Work array and numerics of this thread. */
+    const int thread = omp_get_thread_num();
+    su2double  *workArray      = workArrayVec.data() + thread*sizeWorkArray;
+    CNumerics **numericsThread = numerics + thread*MAX_TERMS;
+
+    /* Function, which carries out the given task. The only tasks that may fail
+       are the completions of the non-blocking communication, if commMustBeCompleted
+       is false. In that case false is returned and the scheduler attempts to complete
+       the communication later. */
+    auto runTask = [&](const unsigned long i, const bool commMustBeCompleted) -> bool {
+
+      switch( tasksList[i].task ) {
+
+        case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+
+          /* Carry out the ADER predictor step for the elements whose
+             solution must be communicated for this time level. */
+          const unsigned short level   = tasksList[i].timeLevel;
+          const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                       + nVolElemInternalPerTimeLevel[level];
+          const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+
+          ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+          return true;
         }
 
-        if( taskCanBeCarriedOut ) {
+        case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
-
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
-
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+          /* Carry out the ADER predictor step for the elements whose
+             solution must not be communicated for this time level. */
+          const unsigned short level   = tasksList[i].timeLevel;
+          const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+          const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                       + nVolElemInternalPerTimeLevel[level];
+          ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+          return true;
+        }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+          /* Start the MPI communication of the solution in the halo elements. */
+          Initiate_MPI_Communication(config, tasksList[i].timeLevel);
+          return true;
+        }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+          /* Attempt to complete the MPI communication of the solution data.
+             If commMustBeCompleted is false, SU2_MPI::Testall will be used,
+             which returns false if not all requests can be completed. Otherwise
+             there is no other work left and MPI_Waitall is used. */
+          return Complete_MPI_Communication(config, tasksList[i].timeLevel,
+                                            commMustBeCompleted);
+        }
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Start the communication of the residuals, for which the
+             reverse communication must be used. */
+          Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
+          return true;
+        }
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+        case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
-
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Attempt to complete the MPI communication of the residual data,
+             see COMPLETE_MPI_COMMUNICATION. */
+          return Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
+                                                   commMustBeCompleted);
+        }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+        case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+          /* Interpolate the predictor solution of the owned elements
+             in time to the given time integration point for the
+             given time level. */
+          const unsigned short level = tasksList[i].timeLevel;
+          unsigned long nAdjElem = 0, *adjElem = NULL;
+          if(level < (nTimeLevels-1)) {
+            nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+            adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+          }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                              nVolElemOwnedPerTimeLevel[level],
+                                              nVolElemOwnedPerTimeLevel[level+1],
+                                              nAdjElem, adjElem,
+                                              tasksList[i].secondPartTimeIntADER,
+                                              VecWorkSolDOFs[level].data());
+          return true;
+        }
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+        case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+          /* Interpolate the predictor solution of the halo elements
+             in time to the given time integration point for the
+             given time level. */
+          const unsigned short level = tasksList[i].timeLevel;
+          unsigned long nAdjElem = 0, *adjElem = NULL;
+          if(level < (nTimeLevels-1)) {
+            nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+            adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+          }
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
+                                              nVolElemHaloPerTimeLevel[level],
+                                              nVolElemHaloPerTimeLevel[level+1],
+                                              nAdjElem, adjElem,
+                                              tasksList[i].secondPartTimeIntADER,
+                                              VecWorkSolDOFs[level].data());
+          return true;
+        }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+        case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+          const unsigned short level = tasksList[i].timeLevel;
+          Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                             nVolElemOwnedPerTimeLevel[level+1], workArray);
+          return true;
+        }
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+        case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+          const unsigned short level = tasksList[i].timeLevel;
+          Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                             nVolElemHaloPerTimeLevel[level+1], workArray);
+          return true;
+        }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+        case CTaskDefinition::VOLUME_RESIDUAL: {
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Compute the volume portion of the residual. ---*/
+          const unsigned short level = tasksList[i].timeLevel;
+          Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
+                          nVolElemOwnedPerTimeLevel[level+1], workArray);
+          return true;
+        }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+        case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Compute the residual of the faces that only involve owned elements. */
+          const unsigned short level = tasksList[i].timeLevel;
+          unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+          ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                        nMatchingInternalFacesLocalElem[level+1],
+                        indResFaces, numericsThread[CONV_TERM], workArray);
+          return true;
+        }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+        case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Compute the residual of the faces that involve a halo element. */
+          const unsigned short level = tasksList[i].timeLevel;
+          unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+          ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                        nMatchingInternalFacesWithHaloElem[level+1],
+                        indResFaces, numericsThread[CONV_TERM], workArray);
+          return true;
+        }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+        case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Apply the boundary conditions that only depend on data
+                of owned elements. ---*/
+          Boundary_Conditions(tasksList[i].timeLevel, config, numericsThread, false,
+                              workArray);
+          return true;
+        }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+        case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Apply the boundary conditions that also depend on data
+                of halo elements. ---*/
+          Boundary_Conditions(tasksList[i].timeLevel, config, numericsThread, true,
+                              workArray);
+          return true;
+        }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+        case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Create the final residual by summing up all contributions. */
+          CreateFinalResidual(tasksList[i].timeLevel, true);
+          return true;
+        }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+        case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Create the final residual by summing up all contributions. */
+          CreateFinalResidual(tasksList[i].timeLevel, false);
+          return true;
+        }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+        case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Accumulate the space time residuals for the owned elements
+             for ADER-DG. */
+          AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
+                                                   tasksList[i].intPointADER);
+          return true;
+        }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+        case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /* Accumulate the space time residuals for the halo elements
+             for ADER-DG. */
+          AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
+                                                  tasksList[i].intPointADER);
+          return true;
+        }
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+        case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+          const unsigned short level = tasksList[i].timeLevel;
+          const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+          MultiplyResidualByInverseMassMatrix(config, useADER,
+                                              nVolElemOwnedPerTimeLevel[level],
+                                              nVolElemOwnedPerTimeLevel[level+1],
+                                              workArray);
+          return true;
+        }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+        case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          /*--- Perform the update step for ADER-DG. ---*/
+          const unsigned short level = tasksList[i].timeLevel;
+          ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                            nVolElemOwnedPerTimeLevel[level+1]);
+          return true;
+        }
 
-            default: {
+        default: {
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
+          cout << "Task not defined. This should not happen." << endl;
+          exit(1);
         }
-
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
       }
+    };
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
-    }
+    /* Carry out all the tasks of the list. */
+    taskScheduler.Execute(runTask);
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
-  }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
@@ -4743,8 +4700,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4992,8 +4949,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5282,8 +5239,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5497,8 +5454,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = GetFluidModel()->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5882,8 +5839,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5977,8 +5934,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = GetFluidModel()->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6886,8 +6843,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
                   const su2double v            = sol[2]*DensityInv;
                   const su2double StaticEnergy = sol[3]*DensityInv - 0.5*(u*u + v*v);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -6939,8 +6896,8 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
                   const su2double w            = sol[3]*DensityInv;
                   const su2double StaticEnergy = sol[4]*DensityInv - 0.5*(u*u + v*v + w*w);
 
-                  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-                  const su2double Pressure = FluidModel->GetPressure();
+                  GetFluidModel()->SetTDState_rhoe(sol[0], StaticEnergy);
+                  const su2double Pressure = GetFluidModel()->GetPressure();
 
                   /*-- Compute the vector from the reference point to the integration
                        point and update the inviscid force. Note that the normal points
@@ -7554,9 +7511,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7662,9 +7619,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      GetFluidModel()->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = GetFluidModel()->GetSoundSpeed2();
+      su2double Pressure    = GetFluidModel()->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7726,10 +7683,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      GetFluidModel()->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = GetFluidModel()->GetStaticEnergy()
+                                 + GetFluidModel()->GetPressure()/GetFluidModel()->GetDensity();
+      const su2double Entropy_e  = GetFluidModel()->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7756,9 +7713,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          GetFluidModel()->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = GetFluidModel()->GetDensity();
+          const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7788,10 +7745,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7839,10 +7796,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      GetFluidModel()->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = GetFluidModel()->GetDensity();
+      const su2double StaticEnergy_e = GetFluidModel()->GetStaticEnergy();
+      const su2double SoundSpeed     = GetFluidModel()->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7936,7 +7893,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          GetFluidModel()->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7951,7 +7908,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(GetFluidModel()->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8002,11 +7959,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8081,11 +8038,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          GetFluidModel()->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = GetFluidModel()->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = GetFluidModel()->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -9480,9 +9437,9 @@ void CFEM_DG_EulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, C
 
       su2double StaticEnergy = VecSolDOFs[ii+nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
-      su2double Pressure = FluidModel->GetPressure();
-      su2double Temperature = FluidModel->GetTemperature();
+      GetFluidModel()->SetTDState_rhoe(VecSolDOFs[ii], StaticEnergy);
+      su2double Pressure = GetFluidModel()->GetPressure();
+      su2double Temperature = GetFluidModel()->GetTemperature();
 
       /*--- Use the values at the infinity if the state is not physical. ---*/
       if((Pressure < 0.0) || (VecSolDOFs[ii] < 0.0) || (Temperature < 0.0)) {
@@ -98,7 +98,12 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(true
 
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+
+  /*--- In matrix-free mode the stiffness matrix is applied element by element (see CFEASolver). ---*/
+  matrix_free = config->GetMatrixFree_Elasticity() && !config->GetDiscrete_Adjoint();
+
+  if (matrix_free) InitializeMatrixFree(geometry);
+  else Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 
 #ifdef HAVE_OMP
   /*--- Get the element coloring. ---*/
@@ -422,8 +427,9 @@ void CMeshSolver::SetMesh_Stiffness(CGeometry **geometry, CNumerics **numerics,
       case SOLID_WALL_DISTANCE: E = 1.0 / element[iElem].GetWallDistance(); break;
       }
 
-      /*--- Set the element elastic properties in the numerics container ---*/
-      numerics[FEA_TERM]->SetMeshElasticProperties(iElem, E);
+      /*--- Set the element elastic properties in the numerics container of each thread ---*/
+      for (int thread = 0; thread < omp_get_max_threads(); ++thread)
+        numerics[FEA_TERM + thread*MAX_TERMS]->SetMeshElasticProperties(iElem, E);
 
     }
 
@@ -437,7 +443,7 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   if (multizone) nodes->Set_BGSSolution_k();
 
   /*--- Initialize sparse matrix ---*/
-  Jacobian.SetValZero();
+  if (!matrix_free) Jacobian.SetValZero();
 
   /*--- Compute the stiffness matrix. ---*/
   Compute_StiffMatrix(geometry[MESH_0], numerics, config);
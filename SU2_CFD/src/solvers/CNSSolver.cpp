@@ -172,7 +172,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   unsigned long InnerIter   = config->GetInnerIter();
   bool cont_adjoint         = config->GetContinuous_Adjoint();
   bool disc_adjoint         = config->GetDiscrete_Adjoint();
-  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   bool center               = (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) || (cont_adjoint && config->GetKind_ConvNumScheme_AdjFlow() == SPACE_CENTERED);
   bool center_jst           = center && config->GetKind_Centered_Flow() == JST;
   bool limiter_flow         = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
@@ -198,10 +198,13 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     SU2_OMP_BARRIER
   }
 
-  /*--- Set the primitive variables ---*/
+  /*--- Set the primitive variables, this invalidates the reconstructed states. ---*/
 
   SU2_OMP_MASTER
-  ErrorCounter = 0;
+  {
+    ErrorCounter = 0;
+    ReconstructedStatesSet = false;
+  }
   SU2_OMP_BARRIER
 
   SU2_OMP_ATOMIC
@@ -264,30 +267,46 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     }
   }
 
+  /*--- With fused reconstruction the limiters (and the states for Upwind_Residual) are
+   computed together with the gradient that is used for reconstruction. ---*/
+
+  const bool fused = FusedReconstruction(config, iMesh) && !Output;
+
   /*--- Compute gradient for MUSCL reconstruction. ---*/
 
   if (config->GetReconstructionGradientRequired() && (iMesh == MESH_0)) {
-    if (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS)
-      SetPrimitive_Gradient_GG(geometry, config, true);
-    if (config->GetKind_Gradient_Method_Recon() == LEAST_SQUARES)
-      SetPrimitive_Gradient_LS(geometry, config, true);
-    if (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES)
-      SetPrimitive_Gradient_LS(geometry, config, true);
+    if (fused) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true);
+    }
+    else {
+      if (config->GetKind_Gradient_Method_Recon() == GREEN_GAUSS)
+        SetPrimitive_Gradient_GG(geometry, config, true);
+      if (config->GetKind_Gradient_Method_Recon() == LEAST_SQUARES)
+        SetPrimitive_Gradient_LS(geometry, config, true);
+      if (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES)
+        SetPrimitive_Gradient_LS(geometry, config, true);
+    }
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+  if (fused && !config->GetReconstructionGradientRequired()) {
+    SetPrimitive_Gradient_Limiter(geometry, config, false);
   }
-  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+  else {
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
   }
 
   /*--- Compute the limiter in case we need it in the turbulence model
    or to limit the viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
 
-  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow) && !Output && !van_albada) {
+  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow) && !Output && !van_albada &&
+      !(fused && limiter_flow)) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -395,7 +414,7 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
 void CNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                  CNumerics *numerics, CConfig *config) {
 
-  const bool implicit  = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit  = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
   const bool tkeNeeded = (config->GetKind_Turb_Model() == SST) ||
                          (config->GetKind_Turb_Model() == SST_SUST);
 
@@ -404,13 +423,14 @@ void CNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CSolv
 
   /*--- Points, coordinates and normal vector in edge ---*/
 
-  auto iPoint = geometry->edge[iEdge]->GetNode(0);
-  auto jPoint = geometry->edge[iEdge]->GetNode(1);
+  const auto& dualGrid = geometry->GetDualGridSoA();
+
+  auto iPoint = dualGrid.GetNode(iEdge,0);
+  auto jPoint = dualGrid.GetNode(iEdge,1);
 
-  numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                     geometry->node[jPoint]->GetCoord());
+  numerics->SetCoord(dualGrid.GetCoord(iPoint), dualGrid.GetCoord(jPoint));
 
-  numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+  numerics->SetNormal(dualGrid.GetNormal(iEdge));
 
   /*--- Primitive and secondary variables. ---*/
 
@@ -1045,7 +1065,7 @@ void CNSSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container
   tau[3][3] = {{0.0,0.0,0.0},{0.0,0.0,0.0},{0.0,0.0,0.0}};
   su2double delta[3][3] = {{1.0, 0.0, 0.0},{0.0,1.0,0.0},{0.0,0.0,1.0}};
 
-  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
 
   /*--- Identify the boundary by string name ---*/
 
@@ -1297,7 +1317,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
   su2double Gas_Constant = config->GetGas_ConstantND();
   su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
 
   /*--- Identify the boundary ---*/
 
@@ -1621,7 +1641,7 @@ void CNSSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver
 
   su2double Temperature_Ref = config->GetTemperature_Ref();
 
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) && !residual_only;
 
   /*--- Identify the boundary ---*/
 
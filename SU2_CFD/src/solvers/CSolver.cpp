@@ -44,6 +44,7 @@
 #include "../../../Common/include/toolboxes/MMS/CUserDefinedSolution.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
 
@@ -3634,7 +3635,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_MAGIC)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3673,7 +3674,7 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
-  if (magic_number == 535532) {
+  if ((magic_number == 535532) || (magic_number == SU2_COMPRESSED_RESTART_MAGIC)) {
     SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                    string("SU2 reads/writes binary restart files by default.\n") +
                    string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3758,6 +3759,10 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
   Restart_Vars = new int[5];
   fields.clear();
 
+  /*--- Profiling (only when compiled with -DPROFILE). ---*/
+  double tick = 0.0;
+  config->Tick(&tick);
+
 #ifndef HAVE_MPI
 
   /*--- Serial binary input. ---*/
@@ -3779,6 +3784,15 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
     SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
   }
 
+  /*--- Files written in blocks (compressed and/or single precision) have their own reader. ---*/
+
+  if (Restart_Vars[0] == SU2_COMPRESSED_RESTART_MAGIC) {
+    fclose(fhw);
+    Read_SU2_Restart_Blocks(geometry, val_filename);
+    config->Tock(tick, "Read_SU2_Restart_Binary", 0);
+    return;
+  }
+
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
@@ -3856,6 +3870,15 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
   SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
+  /*--- Files written in blocks (compressed and/or single precision) have their own reader. ---*/
+
+  if (Restart_Vars[0] == SU2_COMPRESSED_RESTART_MAGIC) {
+    MPI_File_close(&fhw);
+    Read_SU2_Restart_Blocks(geometry, val_filename);
+    config->Tock(tick, "Read_SU2_Restart_Binary", 0);
+    return;
+  }
+
   /*--- Check that this is an SU2 binary file. SU2 binary files
    have the hex representation of "SU2" as the first int in the file. ---*/
 
@@ -3958,6 +3981,237 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, stri
 
 #endif
 
+  config->Tock(tick, "Read_SU2_Restart_Binary", 0);
+
+}
+
+void CSolver::Read_SU2_Restart_Blocks(CGeometry *geometry, const string& fname) {
+
+  const int nRestart_Vars = 5;
+  fields.clear();
+
+  /*--- Open the file, the master reads the header and the tables, then each rank reads its blocks. ---*/
+
+#ifdef HAVE_MPI
+  MPI_File fhr;
+  if (MPI_File_open(MPI_COMM_WORLD, fname.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fhr)) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+  }
+#else
+  FILE *fhr = fopen(fname.c_str(), "rb");
+  if (!fhr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+  }
+#endif
+
+  auto readAt = [&fhr](unsigned long offset, void* buf, unsigned long sizeInBytes) {
+#ifdef HAVE_MPI
+    MPI_Status status;
+    int count = 0;
+    MPI_File_read_at(fhr, offset, buf, int(sizeInBytes), MPI_BYTE, &status);
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    return ((unsigned long)count == sizeInBytes);
+#else
+    return (fseek(fhr, offset, SEEK_SET) == 0) && (fread(buf, 1, sizeInBytes, fhr) == sizeInBytes);
+#endif
+  };
+
+  if ((rank == MASTER_NODE) && !readAt(0, Restart_Vars, nRestart_Vars*sizeof(int))) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  const int nFields = Restart_Vars[1];
+  const unsigned long nPointFile = Restart_Vars[2];
+  const unsigned long nBlock = Restart_Vars[3];
+  const bool compressed = Restart_Vars[4];
+
+  /*--- Names and value sizes of the fields, and the block table {first point, start of the data}. ---*/
+
+  vector<char> names(nFields*CGNS_STRING_SIZE);
+  vector<int> valueSize(nFields);
+  vector<unsigned long> blockTable(2*(nBlock+1));
+
+  unsigned long disp = nRestart_Vars*sizeof(int);
+  const unsigned long namesStart = disp;
+  disp += names.size()*sizeof(char);
+  const unsigned long sizesStart = disp;
+  disp += valueSize.size()*sizeof(int);
+  const unsigned long tableStart = disp;
+  disp += blockTable.size()*sizeof(unsigned long);
+  const unsigned long dataStart = disp;
+
+  if (rank == MASTER_NODE) {
+    if (!readAt(namesStart, names.data(), names.size()*sizeof(char)) ||
+        !readAt(sizesStart, valueSize.data(), valueSize.size()*sizeof(int)) ||
+        !readAt(tableStart, blockTable.data(), blockTable.size()*sizeof(unsigned long))) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+  }
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(valueSize.data(), valueSize.size(), MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(blockTable.data(), blockTable.size(), MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Same conventions as the plain format for the names (quoted in parallel). ---*/
+
+  fields.push_back("Point_ID");
+  for (int iVar = 0; iVar < nFields; iVar++) {
+    const char* name = &names[iVar*CGNS_STRING_SIZE];
+    const string field(name, strnlen(name, CGNS_STRING_SIZE));
+#ifdef HAVE_MPI
+    fields.push_back("\"" + field + "\"");
+#else
+    fields.push_back(field);
+#endif
+  }
+
+  vector<unsigned long> fieldStart(nFields+1, 0);
+  for (int iVar = 0; iVar < nFields; iVar++) {
+    if ((valueSize[iVar] != sizeof(float)) && (valueSize[iVar] != sizeof(passivedouble))) {
+      SU2_MPI::Error(string("Invalid field size in restart file ") + fname, CURRENT_FUNCTION);
+    }
+    fieldStart[iVar+1] = fieldStart[iVar] + valueSize[iVar];
+  }
+  const unsigned long bytesPerPoint = fieldStart[nFields];
+
+  bool validTable = (blockTable[0] == 0) && (blockTable[2*nBlock] == nPointFile);
+  for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++) {
+    validTable &= (blockTable[2*iBlock] < blockTable[2*iBlock+2]) &&
+                  (blockTable[2*iBlock+1] <= blockTable[2*iBlock+3]);
+  }
+  if (!validTable) {
+    SU2_MPI::Error(string("Corrupted block table in restart file ") + fname, CURRENT_FUNCTION);
+  }
+
+  /*--- Global indices of the points of this rank, in the order they are stored in Restart_Data. ---*/
+
+  const unsigned long nPointDomain = geometry->GetnPointDomain();
+  vector<unsigned long> ownedPoints;
+  ownedPoints.reserve(nPointDomain);
+#ifdef HAVE_MPI
+  for (unsigned long iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++)
+    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) ownedPoints.push_back(iPoint_Global);
+#else
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) ownedPoints.push_back(iPoint);
+#endif
+
+  if ((ownedPoints.size() != nPointDomain) || (nPointDomain && (ownedPoints.back() >= nPointFile))) {
+    SU2_MPI::Error(string("The restart file ") + fname + string(" does not match the mesh."), CURRENT_FUNCTION);
+  }
+
+  /*--- Blocks that contain points of this rank, and the range of those points in ownedPoints. ---*/
+
+  vector<unsigned long> readBlocks, ownedBegin;
+  unsigned long iOwned = 0;
+  for (unsigned long iBlock = 0; (iBlock < nBlock) && (iOwned < nPointDomain); iBlock++) {
+    const unsigned long blockEnd = blockTable[2*iBlock+2];
+    if (ownedPoints[iOwned] >= blockEnd) continue;
+    readBlocks.push_back(iBlock);
+    ownedBegin.push_back(iOwned);
+    while ((iOwned < nPointDomain) && (ownedPoints[iOwned] < blockEnd)) iOwned++;
+  }
+  ownedBegin.push_back(iOwned);
+
+  /*--- Read the blocks, consecutive blocks are read at once. ---*/
+
+  const unsigned long maxReadSize = 1ul << 30;
+  const unsigned long nReadBlock = readBlocks.size();
+  vector<unsigned long> blockPosition(nReadBlock+1, 0);
+  for (unsigned long iRead = 0; iRead < nReadBlock; iRead++) {
+    const unsigned long iBlock = readBlocks[iRead];
+    blockPosition[iRead+1] = blockPosition[iRead] + blockTable[2*iBlock+3] - blockTable[2*iBlock+1];
+  }
+
+  vector<uint8_t> buffer(blockPosition[nReadBlock]);
+
+  for (unsigned long iRead = 0; iRead < nReadBlock; ) {
+    unsigned long jRead = iRead+1;
+    while ((jRead < nReadBlock) && (readBlocks[jRead] == readBlocks[jRead-1]+1) &&
+           (blockPosition[jRead+1] - blockPosition[iRead] <= maxReadSize)) jRead++;
+
+    const unsigned long sizeInBytes = blockPosition[jRead] - blockPosition[iRead];
+    if (!readAt(dataStart + blockTable[2*readBlocks[iRead]+1], buffer.data()+blockPosition[iRead], sizeInBytes)) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    iRead = jRead;
+  }
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fhr);
+#else
+  fclose(fhr);
+#endif
+
+  /*--- Decode the blocks and copy the values of the points of this rank. ---*/
+
+  Restart_Data = new passivedouble[nFields*nPointDomain];
+
+  unsigned long nCorrupted = 0;
+
+  SU2_OMP_PARALLEL
+  {
+    vector<uint8_t> shuffled, raw;
+
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iRead = 0; iRead < nReadBlock; iRead++) {
+
+      const unsigned long iBlock = readBlocks[iRead];
+      const unsigned long firstPoint = blockTable[2*iBlock];
+      const unsigned long nPoint = blockTable[2*iBlock+2] - firstPoint;
+      const unsigned long rawSize = nPoint*bytesPerPoint;
+      const unsigned long storedSize = blockPosition[iRead+1] - blockPosition[iRead];
+
+      const uint8_t* block = buffer.data() + blockPosition[iRead];
+
+      if (compressed) {
+        /*--- Blocks that did not compress are stored shuffled but otherwise as they are. ---*/
+        if (storedSize < rawSize) {
+          shuffled.resize(rawSize);
+          if (!CompressionToolbox::LZ4Decompress(block, storedSize, shuffled.data(), rawSize)) {
+            SU2_OMP_ATOMIC
+            nCorrupted++;
+            continue;
+          }
+          block = shuffled.data();
+        }
+        else if (storedSize != rawSize) {
+          SU2_OMP_ATOMIC
+          nCorrupted++;
+          continue;
+        }
+        raw.resize(rawSize);
+        for (int iVar = 0; iVar < nFields; iVar++) {
+          const unsigned long start = nPoint*fieldStart[iVar];
+          CompressionToolbox::ByteUnshuffle(block+start, nPoint, valueSize[iVar], raw.data()+start);
+        }
+        block = raw.data();
+      }
+      else if (storedSize != rawSize) {
+        SU2_OMP_ATOMIC
+        nCorrupted++;
+        continue;
+      }
+
+      for (unsigned long iOwned = ownedBegin[iRead]; iOwned < ownedBegin[iRead+1]; iOwned++) {
+        const unsigned long iPoint = ownedPoints[iOwned] - firstPoint;
+        for (int iVar = 0; iVar < nFields; iVar++) {
+          const uint8_t* value = block + nPoint*fieldStart[iVar] + iPoint*valueSize[iVar];
+          if (valueSize[iVar] == sizeof(float)) {
+            float single;
+            memcpy(&single, value, sizeof(float));
+            Restart_Data[iOwned*nFields + iVar] = single;
+          } else {
+            memcpy(&Restart_Data[iOwned*nFields + iVar], value, sizeof(passivedouble));
+          }
+        }
+      }
+    }
+  }
+
+  if (nCorrupted) {
+    SU2_MPI::Error(string("Corrupted data block in restart file ") + fname, CURRENT_FUNCTION);
+  }
+
 }
 
 void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bool adjoint, string val_filename) {
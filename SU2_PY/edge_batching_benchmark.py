@@ -0,0 +1,159 @@
+#!/usr/bin/env python
+
+## \file edge_batching_benchmark.py
+#  \brief Python script to compare the upwind residual time with and without the batched flux kernels.
+#  \author SU2 Contributors
+#  \version 7.0.2 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# Runs SU2_CFD with EDGE_BATCHING= NO and YES for each upwind scheme that has a
+# batched kernel (ROE, HLLC, AUSM), with explicit and implicit time integration,
+# and reports the time per call of Upwind_Residual (all edges, i.e. including the
+# MUSCL reconstruction and the scatter of the fluxes) and the speed-up of the
+# batched kernels. The case is an Euler flow in a synthetic box mesh
+# (MESH_FORMAT= BOX). The timings come from the SU2 custom profiling, i.e. SU2_CFD
+# must be compiled with -DPROFILE (e.g. meson.py build -Dcpp_args=-DPROFILE). The
+# script fails if the residuals of the two runs differ by more than a tolerance,
+# the kernels only change the round-off of the fluxes. The slope limiter is off,
+# near the uniform initial solution it amplifies those differences by orders of
+# magnitude per iteration (it is computed outside Upwind_Residual anyway).
+# Implicit HLLC is not batched, it is included as a reference (speed-up ~1).
+#
+# Example: edge_batching_benchmark.py -s 48,48,48 -i 20 -c ROE,AUSM
+
+from optparse import OptionParser
+import os, sys, re, csv, subprocess
+
+config_box = """
+SOLVER= EULER
+MATH_PROBLEM= DIRECT
+MACH_NUMBER= 0.5
+AOA= 0.0
+FREESTREAM_PRESSURE= 101325.0
+FREESTREAM_TEMPERATURE= 288.15
+MESH_FORMAT= BOX
+MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus )
+MARKER_FAR= ( z_minus, z_plus )
+NUM_METHOD_GRAD= GREEN_GAUSS
+MUSCL_FLOW= YES
+SLOPE_LIMITER_FLOW= NONE
+LINEAR_SOLVER= FGMRES
+LINEAR_SOLVER_PREC= ILU
+LINEAR_SOLVER_ITER= 5
+SCREEN_OUTPUT= (INNER_ITER, RMS_DENSITY)
+OUTPUT_FILES= NONE
+"""
+
+def run_case(config_text, options, batching):
+
+    filename = "edge_batching_benchmark.cfg"
+    with open(filename, "w") as f:
+        f.write(config_text)
+        f.write("\nEDGE_BATCHING= %s\nITER= %d\n" % (batching, options.iterations))
+
+    command = [os.path.join(os.environ.get("SU2_RUN", ""), "SU2_CFD"), filename]
+    if int(options.partitions) > 1:
+        command = ["mpirun", "-n", str(options.partitions)] + command
+
+    env = dict(os.environ)
+    if int(options.threads) > 0:
+        env["OMP_NUM_THREADS"] = str(options.threads)
+
+    if os.path.exists("profiling.csv"): os.remove("profiling.csv")
+
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+    screen = proc.communicate()[0].decode(errors="replace")
+
+    if proc.returncode != 0:
+        sys.stdout.write(screen)
+        raise RuntimeError("SU2_CFD failed for EDGE_BATCHING= %s" % batching)
+
+    # Time per call (averaged over the ranks) of the upwind residual
+    upwind = None
+    if os.path.exists("profiling.csv"):
+        with open("profiling.csv") as f:
+            for row in csv.DictReader(f, skipinitialspace=True):
+                if row["Function_Name"].strip() == "Upwind_Residual":
+                    upwind = float(row["Avg_Time"])
+
+    residual = re.findall(r"^\|\s+\d+\|\s+(\S+)\|", screen, re.MULTILINE)
+    residual = float(residual[-1]) if residual else None
+
+    return upwind, residual
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option("-s", "--size", dest="size", default="32,32,32",
+                      help="number of cells of the box in each direction", metavar="NX,NY,NZ")
+    parser.add_option("-c", "--schemes", dest="schemes", default="ROE,HLLC,AUSM",
+                      help="upwind schemes to compare", metavar="SCHEMES")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-t", "--threads", dest="threads", default=0,
+                      help="number of OpenMP threads per rank (default: OMP_NUM_THREADS)", metavar="THREADS")
+    parser.add_option("-i", "--iterations", dest="iterations", default=20, type="int",
+                      help="number of iterations of each run", metavar="ITER")
+    parser.add_option("--tol", dest="tolerance", default=1e-4, type="float",
+                      help="tolerance for the difference of the last residuals", metavar="TOL")
+    (options, args) = parser.parse_args()
+
+    box = config_box + "MESH_BOX_SIZE= (%s)\n" % options.size.replace(" ", "").replace(",", ", ")
+
+    results = []
+    for scheme in options.schemes.replace(" ", "").split(","):
+        for time_discre, cfl in (("EULER_EXPLICIT", 0.5), ("EULER_IMPLICIT", 5.0)):
+            config_text = box + "CONV_NUM_METHOD_FLOW= %s\nTIME_DISCRE_FLOW= %s\nCFL_NUMBER= %g\n" % \
+                          (scheme, time_discre, cfl)
+            runs = []
+            for batching in ("NO", "YES"):
+                print("Running %s %s EDGE_BATCHING= %s" % (scheme, time_discre, batching))
+                runs.append(run_case(config_text, options, batching))
+            results.append((scheme, time_discre, runs))
+
+    if results[0][2][0][0] is None:
+        print("\nNo profiling data, SU2_CFD must be compiled with -DPROFILE to report the upwind residual time.")
+
+    # Report, the speed-up is relative to the scalar kernels
+    print("\n%-6s %-16s %18s %18s %8s %16s %16s" % ("Scheme", "Time integration", "Scalar [s/call]",
+          "Batched [s/call]", "Speedup", "Residual scalar", "Residual batched"))
+
+    failed = False
+    for scheme, time_discre, ((scalar, res_scalar), (batched, res_batched)) in results:
+        line = "%-6s %-16s" % (scheme, time_discre)
+        if scalar is not None and batched is not None:
+            line += " %18.4e %18.4e %8.2f" % (scalar, batched, scalar/batched if batched > 0.0 else 0.0)
+        else:
+            line += " %18s %18s %8s" % ("-", "-", "-")
+        line += " %16s %16s" % tuple("%.6f" % r if r is not None else "-" for r in (res_scalar, res_batched))
+        print(line)
+
+        if None in (res_scalar, res_batched) or \
+           abs(res_scalar-res_batched) > options.tolerance*max(1.0, abs(res_scalar)):
+            failed = True
+
+    if failed:
+        print("\nThe residuals with and without batching differ.")
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+
+## \file fea_assembly_benchmark.py
+#  \brief Python script to measure the assembly time of the finite element stiffness matrix.
+#  \author SU2 Contributors
+#  \version 7.0.2 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# Runs the linear elasticity solver for one iteration on a synthetic hexahedral
+# mesh (MESH_FORMAT= BOX) and reports the time to assemble the stiffness matrix
+# (Compute_StiffMatrix) and the total run time. The assembly time comes from the
+# SU2 custom profiling, i.e. SU2_CFD must be compiled with -DPROFILE (e.g.
+# meson.py build -Dcpp_args=-DPROFILE), otherwise only the total time is reported.
+# With --compare, the same case is also run with the SU2_CFD found in another
+# directory (e.g. a build of an older version) and the results must match.
+#
+# Example: fea_assembly_benchmark.py -s 32,32,32 -n 2 -t 4 -c /path/to/old/bin
+
+from optparse import OptionParser
+import os, sys, re, csv, time, subprocess
+
+config_base = """
+SOLVER= ELASTICITY
+MATH_PROBLEM= DIRECT
+ITER= 1
+GEOMETRIC_CONDITIONS= SMALL_DEFORMATIONS
+MATERIAL_MODEL= LINEAR_ELASTIC
+ELASTICITY_MODULUS= 1000
+POISSON_RATIO= 0.3
+MATERIAL_DENSITY= 1000
+MARKER_CLAMPED= ( x_minus )
+MARKER_LOAD= ( x_plus, 1, 1, 0, -1, 0 )
+MARKER_PRESSURE= ( y_minus, 0.0, y_plus, 0.0, z_minus, 0.0, z_plus, 0.0 )
+LINEAR_SOLVER= CONJUGATE_GRADIENT
+LINEAR_SOLVER_PREC= JACOBI
+LINEAR_SOLVER_ERROR= 1E-8
+LINEAR_SOLVER_ITER= 1000
+MESH_FORMAT= BOX
+SCREEN_OUTPUT= (INNER_ITER, LINSOL_ITER, VMS)
+OUTPUT_FILES= NONE
+"""
+
+def run(bindir, config_text, options, filename):
+
+    with open(filename, "w") as f:
+        f.write(config_text)
+
+    command = [os.path.join(bindir, "SU2_CFD"), filename]
+    if int(options.partitions) > 1:
+        command = ["mpirun", "-n", str(options.partitions)] + command
+
+    env = dict(os.environ, OMP_NUM_THREADS=str(options.threads))
+
+    if os.path.exists("profiling.csv"): os.remove("profiling.csv")
+
+    start = time.time()
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+    screen = proc.communicate()[0].decode(errors="replace")
+    elapsed = time.time() - start
+
+    if proc.returncode != 0:
+        sys.stdout.write(screen)
+        raise RuntimeError("%s failed for %s" % (command[-2], filename))
+
+    assembly = None
+    if os.path.exists("profiling.csv"):
+        with open("profiling.csv") as f:
+            for row in csv.DictReader(f, skipinitialspace=True):
+                if row["Function_Name"].strip() == "Compute_StiffMatrix":
+                    assembly = float(row["Max_Time"])
+
+    return screen, assembly, elapsed
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option("-s", "--size", dest="size", default="24,24,24",
+                      help="number of cells of the box in each direction", metavar="NX,NY,NZ")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-t", "--threads", dest="threads", default=1,
+                      help="number of OpenMP threads per rank", metavar="THREADS")
+    parser.add_option("-r", "--repeat", dest="repeat", default=3, type="int",
+                      help="number of runs per build, the best time is reported", metavar="REPEAT")
+    parser.add_option("-c", "--compare", dest="compare", default=None,
+                      help="directory of another SU2_CFD to compare with", metavar="BINDIR")
+    (options, args) = parser.parse_args()
+
+    size = options.size.replace(" ", "")
+    config_text = config_base + "MESH_BOX_SIZE= (%s)\n" % size.replace(",", ", ")
+
+    builds = [os.environ.get("SU2_RUN", "")]
+    if options.compare: builds.append(options.compare)
+
+    results = []
+    residuals = {}
+    for bindir in builds:
+        best_assembly, best_total = None, None
+        for i in range(options.repeat):
+            screen, assembly, total = run(bindir, config_text, options, "fea_assembly_benchmark.cfg")
+
+            if assembly is not None:
+                best_assembly = assembly if best_assembly is None else min(best_assembly, assembly)
+            best_total = total if best_total is None else min(best_total, total)
+
+        residual = re.findall(r"^\|\s+0\|(.+)\|$", screen, re.MULTILINE)
+        residuals[bindir] = residual[-1] if residual else None
+        results.append((bindir if bindir else "SU2_RUN", best_assembly, best_total))
+
+    print("\n%-40s %24s %14s" % ("Build", "Compute_StiffMatrix [s]", "Total [s]"))
+    for bindir, assembly, total in results:
+        print("%-40s %24s %14.3f" % (bindir[-40:], "%.4f" % assembly if assembly is not None else "-", total))
+
+    if results[0][1] is None:
+        print("\nNo profiling data, SU2_CFD must be compiled with -DPROFILE to report the assembly time.")
+
+    if len(set(residuals.values())) != 1 or None in residuals.values():
+        print("\nThe results of the builds differ: %s" % residuals)
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python
+
+## \file gradient_cache_benchmark.py
+#  \brief Python script to measure the effect of caching the least-squares gradient weights.
+#  \author SU2 Contributors
+#  \version 7.0.2 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+
+# Runs SU2_CFD with and without LEAST_SQUARES_CACHE and reports the time spent per
+# iteration in computeGradientsLeastSquares (all solvers and gradients included),
+# the total time, and the last residual of each run. By default the case is an
+# Euler flow in a synthetic box mesh (MESH_FORMAT= BOX) with weighted least-squares
+# gradients and MUSCL reconstruction, another case can be given with -f.
+# The timings come from the SU2 custom profiling, i.e. SU2_CFD must be compiled
+# with -DPROFILE (e.g. meson.py build -Dcpp_args=-DPROFILE). The script fails if the
+# residuals of the two runs differ by more than a tolerance, so it can be used in CI.
+# The cache only changes the round-off of the gradients, but limiters amplify it,
+# hence the default tolerance is looser than machine precision.
+#
+# Example: gradient_cache_benchmark.py -s 48,48,48 -i 20 -t 4
+
+from optparse import OptionParser
+import os, sys, re, csv, time, subprocess
+
+config_box = """
+SOLVER= EULER
+MATH_PROBLEM= DIRECT
+MACH_NUMBER= 0.5
+AOA= 0.0
+FREESTREAM_PRESSURE= 101325.0
+FREESTREAM_TEMPERATURE= 288.15
+MESH_FORMAT= BOX
+MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus )
+MARKER_FAR= ( z_minus, z_plus )
+NUM_METHOD_GRAD= WEIGHTED_LEAST_SQUARES
+CFL_NUMBER= 1.0
+CONV_NUM_METHOD_FLOW= ROE
+MUSCL_FLOW= YES
+SLOPE_LIMITER_FLOW= VENKATAKRISHNAN
+TIME_DISCRE_FLOW= EULER_EXPLICIT
+SCREEN_OUTPUT= (INNER_ITER, RMS_DENSITY)
+OUTPUT_FILES= NONE
+"""
+
+def run_case(config_text, options, cache):
+
+    filename = "gradient_cache_benchmark.cfg"
+    with open(filename, "w") as f:
+        f.write(config_text)
+        f.write("\nLEAST_SQUARES_CACHE= %s\nITER= %d\n" % (cache, options.iterations))
+
+    command = [os.path.join(os.environ.get("SU2_RUN", ""), "SU2_CFD"), filename]
+    if int(options.partitions) > 1:
+        command = ["mpirun", "-n", str(options.partitions)] + command
+
+    env = dict(os.environ)
+    if int(options.threads) > 0:
+        env["OMP_NUM_THREADS"] = str(options.threads)
+
+    if os.path.exists("profiling.csv"): os.remove("profiling.csv")
+
+    start = time.time()
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+    screen = proc.communicate()[0].decode(errors="replace")
+    elapsed = time.time() - start
+
+    if proc.returncode != 0:
+        sys.stdout.write(screen)
+        raise RuntimeError("SU2_CFD failed for LEAST_SQUARES_CACHE= %s" % cache)
+
+    # Total time (averaged over the ranks) and number of calls of the gradient routine
+    gradient = None
+    if os.path.exists("profiling.csv"):
+        with open("profiling.csv") as f:
+            for row in csv.DictReader(f, skipinitialspace=True):
+                if row["Function_Name"].strip() == "computeGradientsLeastSquares":
+                    gradient = (float(row["Avg_Total_Time"]), int(row["N_Calls"]))
+
+    residual = re.findall(r"^\|\s+\d+\|\s+(\S+)\|", screen, re.MULTILINE)
+    residual = float(residual[-1]) if residual else None
+
+    return gradient, elapsed, residual
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option("-f", "--file", dest="filename",
+                      help="read config from FILE (default: synthetic box case)", metavar="FILE")
+    parser.add_option("-s", "--size", dest="size", default="32,32,32",
+                      help="number of cells of the default box case in each direction", metavar="NX,NY,NZ")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-t", "--threads", dest="threads", default=0,
+                      help="number of OpenMP threads per rank (default: OMP_NUM_THREADS)", metavar="THREADS")
+    parser.add_option("-i", "--iterations", dest="iterations", default=20, type="int",
+                      help="number of iterations of each run", metavar="ITER")
+    parser.add_option("--tol", dest="tolerance", default=1e-4, type="float",
+                      help="tolerance for the difference of the last residuals", metavar="TOL")
+    (options, args) = parser.parse_args()
+
+    if options.filename is None:
+        config_text = config_box + "MESH_BOX_SIZE= (%s)\n" % options.size.replace(" ", "").replace(",", ", ")
+    else:
+        # Remove the options that are set for each run
+        config_text = ""
+        with open(options.filename) as f:
+            for line in f:
+                key = line.split("=")[0].strip()
+                if key not in ("LEAST_SQUARES_CACHE", "ITER"):
+                    config_text += line
+
+    results = []
+    for cache in ("NO", "YES"):
+        print("Running LEAST_SQUARES_CACHE= %s" % cache)
+        results.append((cache,) + run_case(config_text, options, cache))
+
+    if results[0][1] is None:
+        print("\nNo profiling data, SU2_CFD must be compiled with -DPROFILE to report the gradient time.")
+
+    # Report, the speed-up is relative to the run without cache
+    ref = results[0][1]
+
+    print("\n%-6s %12s %22s %8s %12s %16s" % ("Cache", "Calls/iter", "Gradient/iter [s]", "Speedup",
+          "Total [s]", "Residual"))
+    for cache, gradient, total, residual in results:
+        line = "%-6s" % cache
+        if gradient is not None:
+            per_iter = gradient[0]/options.iterations
+            line += " %12.1f %22.4e %8.2f" % (gradient[1]/float(options.iterations), per_iter,
+                                              ref[0]/gradient[0] if gradient[0] > 0.0 else 0.0)
+        else:
+            line += " %12s %22s %8s" % ("-", "-", "-")
+        line += " %12.3f %16s" % (total, "%.6f" % residual if residual is not None else "-")
+        print(line)
+
+    residuals = [r[3] for r in results]
+    if None in residuals or abs(residuals[0]-residuals[1]) > options.tolerance*max(1.0, abs(residuals[0])):
+        print("\nThe residuals with and without cache differ: %s" % residuals)
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
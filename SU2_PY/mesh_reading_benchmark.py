@@ -0,0 +1,148 @@
+#!/usr/bin/env python
+
+## \file mesh_reading_benchmark.py
+#  \brief Python script to measure the time to read native SU2 meshes at startup.
+#  \author SU2 Contributors
+#  \version 7.0.2 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# Writes a synthetic hexahedral mesh (MESH_FORMAT= BOX) in the ASCII and binary
+# native formats with SU2_DEF, then runs SU2_CFD for one iteration on each file
+# and reports the time to read the mesh (Read_Mesh_FVM) and the total run time.
+# The reading time comes from the SU2 custom profiling, i.e. SU2_CFD must be
+# compiled with -DPROFILE (e.g. meson.py build -Dcpp_args=-DPROFILE), otherwise
+# only the total time is reported. The script fails if a run fails, or if the
+# ASCII and binary meshes give different residuals, so it can be used in CI.
+#
+# Example: mesh_reading_benchmark.py -s 64,64,64 -n 4
+
+from optparse import OptionParser
+import os, sys, re, csv, time, subprocess
+
+config_base = """
+SOLVER= EULER
+MATH_PROBLEM= DIRECT
+MACH_NUMBER= 0.5
+AOA= 0.0
+FREESTREAM_PRESSURE= 101325.0
+FREESTREAM_TEMPERATURE= 288.15
+MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus )
+MARKER_FAR= ( z_minus, z_plus )
+NUM_METHOD_GRAD= GREEN_GAUSS
+CFL_NUMBER= 1.0
+CONV_NUM_METHOD_FLOW= ROE
+TIME_DISCRE_FLOW= EULER_EXPLICIT
+SCREEN_OUTPUT= (INNER_ITER, RMS_DENSITY)
+OUTPUT_FILES= NONE
+DV_KIND= NO_DEFORMATION
+DV_MARKER= ( z_minus )
+DV_PARAM= ( 1.0 )
+DV_VALUE= 0.0
+"""
+
+def run(command, config_text, options, filename):
+
+    with open(filename, "w") as f:
+        f.write(config_text)
+
+    command = [os.path.join(os.environ.get("SU2_RUN", ""), command), filename]
+    if int(options.partitions) > 1:
+        command = ["mpirun", "-n", str(options.partitions)] + command
+
+    if os.path.exists("profiling.csv"): os.remove("profiling.csv")
+
+    start = time.time()
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    screen = proc.communicate()[0].decode(errors="replace")
+    elapsed = time.time() - start
+
+    if proc.returncode != 0:
+        sys.stdout.write(screen)
+        raise RuntimeError("%s failed for %s" % (command[-2], filename))
+
+    return screen, elapsed
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option("-s", "--size", dest="size", default="32,32,32",
+                      help="number of cells of the box in each direction", metavar="NX,NY,NZ")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-r", "--repeat", dest="repeat", default=3, type="int",
+                      help="number of runs per format, the best time is reported", metavar="REPEAT")
+    parser.add_option("-f", "--formats", dest="formats", default="SU2,SU2_BINARY",
+                      help="comma separated mesh formats", metavar="FORMATS")
+    (options, args) = parser.parse_args()
+
+    size = options.size.replace(" ", "")
+    box = config_base + "MESH_BOX_SIZE= (%s)\n" % size.replace(",", ", ")
+
+    extension = {"SU2": ".su2", "SU2_BINARY": ".su2b"}
+    formats = [fmt.strip() for fmt in options.formats.split(",")]
+
+    results = []
+    residuals = {}
+    for fmt in formats:
+        if fmt not in extension:
+            parser.error("Unknown mesh format %s." % fmt)
+
+        # Write the mesh with SU2_DEF
+        mesh = "box_%s%s" % (size.replace(",", "x"), extension[fmt])
+        if not os.path.exists(mesh):
+            print("Writing %s" % mesh)
+            run("SU2_DEF", box + "MESH_FORMAT= BOX\nMESH_OUT_FILENAME= %s\nMESH_OUT_FORMAT= %s\n" %
+                (mesh, fmt), options, "mesh_reading_benchmark_def.cfg")
+
+        # Read it with SU2_CFD
+        config_text = box + "MESH_FILENAME= %s\nMESH_FORMAT= %s\nITER= 1\n" % (mesh, fmt)
+        best_read, best_total = None, None
+        for i in range(options.repeat):
+            screen, total = run("SU2_CFD", config_text, options, "mesh_reading_benchmark.cfg")
+
+            read = None
+            if os.path.exists("profiling.csv"):
+                with open("profiling.csv") as f:
+                    for row in csv.DictReader(f, skipinitialspace=True):
+                        if row["Function_Name"].strip() == "Read_Mesh_FVM":
+                            read = float(row["Max_Time"])
+
+            if read is not None: best_read = read if best_read is None else min(best_read, read)
+            best_total = total if best_total is None else min(best_total, total)
+
+        residual = re.findall(r"^\|\s+0\|\s+(\S+)\|", screen, re.MULTILINE)
+        residuals[fmt] = residual[-1] if residual else None
+        results.append((fmt, os.path.getsize(mesh), best_read, best_total))
+
+    print("\n%-12s %14s %18s %14s" % ("Format", "Size [MB]", "Read_Mesh_FVM [s]", "Total [s]"))
+    for fmt, nbytes, read, total in results:
+        print("%-12s %14.1f %18s %14.3f" % (fmt, nbytes/1.0e6, "%.4f" % read if read is not None else "-", total))
+
+    if results[0][2] is None:
+        print("\nNo profiling data, SU2_CFD must be compiled with -DPROFILE to report the reading time.")
+
+    if len(set(residuals.values())) != 1 or None in residuals.values():
+        print("\nThe residuals of the formats differ: %s" % residuals)
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,132 @@
+#!/usr/bin/env python
+
+## \file ordering_benchmark.py
+#  \brief Python script to compare the point and edge orderings (POINT_ORDERING, EDGE_ORDERING).
+#  \author SU2 Contributors
+#  \version 7.0.2 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# Runs SU2_CFD on a case for each combination of point and edge ordering and
+# reports the average time of Upwind_Residual and of the sparse matrix-vector
+# product (MatrixVectorProduct), and the fill of the ILU factorization.
+# The timings come from the SU2 custom profiling, i.e. SU2_CFD must be compiled
+# with -DPROFILE (e.g. meson.py build -Dcpp_args=-DPROFILE), the ILU fill is only
+# reported when the case uses the ILU preconditioner.
+#
+# Example: ordering_benchmark.py -f turb_ONERAM6.cfg -i 20 -t 4
+
+from optparse import OptionParser
+import os, sys, re, csv, subprocess
+
+def run_case(config_text, options, point, edge):
+
+    # Write the modified config file, the mesh and other inputs are found relative to it
+    filename = "ordering_benchmark.cfg"
+    with open(filename, "w") as f:
+        f.write(config_text)
+        f.write("\nPOINT_ORDERING= %s\nEDGE_ORDERING= %s\nITER= %d\n" % (point, edge, options.iterations))
+
+    command = [os.path.join(os.environ.get("SU2_RUN", ""), "SU2_CFD"), filename]
+    if int(options.partitions) > 1:
+        command = ["mpirun", "-n", str(options.partitions)] + command
+
+    env = dict(os.environ)
+    if int(options.threads) > 0:
+        env["OMP_NUM_THREADS"] = str(options.threads)
+
+    if os.path.exists("profiling.csv"): os.remove("profiling.csv")
+
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, env=env)
+    screen = proc.communicate()[0].decode(errors="replace")
+    if proc.returncode != 0:
+        sys.stdout.write(screen)
+        raise RuntimeError("SU2_CFD failed for POINT_ORDERING= %s, EDGE_ORDERING= %s" % (point, edge))
+
+    # Average time per call of the profiled functions
+    times = {}
+    if os.path.exists("profiling.csv"):
+        with open("profiling.csv") as f:
+            for row in csv.DictReader(f, skipinitialspace=True):
+                times[row["Function_Name"].strip()] = float(row["Avg_Time"])
+
+    # Fill of the (first) ILU factorization
+    fill = re.search(r"ILU\(\d+\) fill: (\d+) non-zero blocks, ([0-9.eE+-]+) times", screen)
+    fill = (int(fill.group(1)), float(fill.group(2))) if fill else None
+
+    return times, fill
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option("-f", "--file", dest="filename",
+                      help="read config from FILE", metavar="FILE")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-t", "--threads", dest="threads", default=0,
+                      help="number of OpenMP threads per rank (default: OMP_NUM_THREADS)", metavar="THREADS")
+    parser.add_option("-i", "--iterations", dest="iterations", default=20, type="int",
+                      help="number of iterations of each run", metavar="ITER")
+    parser.add_option("-p", "--point", dest="point", default="RCM,HILBERT,MORTON",
+                      help="comma separated point orderings", metavar="ORDERINGS")
+    parser.add_option("-e", "--edge", dest="edge", default="NATURAL,SORTED,COLOR_TILED",
+                      help="comma separated edge orderings", metavar="ORDERINGS")
+    (options, args) = parser.parse_args()
+
+    if options.filename is None:
+        parser.error("A config file is required (-f).")
+
+    # Remove the options that are set for each run
+    config_text = ""
+    with open(options.filename) as f:
+        for line in f:
+            key = line.split("=")[0].strip()
+            if key not in ("POINT_ORDERING", "EDGE_ORDERING", "ITER"):
+                config_text += line
+
+    results = []
+    for point in options.point.split(","):
+        for edge in options.edge.split(","):
+            print("Running POINT_ORDERING= %s, EDGE_ORDERING= %s" % (point, edge))
+            times, fill = run_case(config_text, options, point.strip(), edge.strip())
+            results.append((point, edge, times, fill))
+
+    if not results[0][2]:
+        print("\nNo profiling data, SU2_CFD must be compiled with -DPROFILE to report timings.")
+
+    # Report, the speed-ups are relative to the first combination (RCM, NATURAL by default)
+    names = ["Upwind_Residual", "MatrixVectorProduct"]
+    ref = results[0][2]
+
+    print("\n%-8s %-12s %20s %8s %24s %8s %14s %8s" % ("Points", "Edges", "Upwind_Residual [s]",
+          "Speedup", "MatrixVectorProduct [s]", "Speedup", "ILU non-zeros", "Fill"))
+    for point, edge, times, fill in results:
+        line = "%-8s %-12s" % (point, edge)
+        for name, width in zip(names, [20, 24]):
+            if name in times:
+                line += " %*.4e %8.2f" % (width, times[name], ref.get(name, times[name])/times[name])
+            else:
+                line += " %*s %8s" % (width, "-", "-")
+        line += " %14d %8.3f" % fill if fill else " %14s %8s" % ("-", "-")
+        print(line)
+
+if __name__ == "__main__":
+    main()
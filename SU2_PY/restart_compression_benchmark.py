@@ -0,0 +1,144 @@
+#!/usr/bin/env python
+
+## \file restart_compression_benchmark.py
+#  \brief Python script to compare the size and write/read times of the binary restart formats.
+#  \author SU2 Contributors
+#  \version 7.0.2 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# Runs SU2_CFD on a synthetic hexahedral mesh (MESH_FORMAT= BOX) writing the
+# restart file at every iteration with each restart format (plain, single
+# precision fields, compressed, both), then restarts from each file. Reports
+# the size of the files, the write time (from the restart bandwidth reported
+# with WRT_PERFORMANCE= YES) and the read time (Read_SU2_Restart_Binary, from
+# the SU2 custom profiling, i.e. SU2_CFD must be compiled with -DPROFILE).
+# The script fails if a run fails, or if the restarted runs give different
+# residuals, since the solution is always stored losslessly.
+#
+# Example: restart_compression_benchmark.py -s 64,64,64 -n 4
+
+from optparse import OptionParser
+import os, sys, re, csv, time, subprocess
+
+config_base = """
+SOLVER= EULER
+MATH_PROBLEM= DIRECT
+MACH_NUMBER= 0.5
+AOA= 0.0
+FREESTREAM_PRESSURE= 101325.0
+FREESTREAM_TEMPERATURE= 288.15
+MESH_FORMAT= BOX
+MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus )
+MARKER_FAR= ( z_minus, z_plus )
+NUM_METHOD_GRAD= GREEN_GAUSS
+CFL_NUMBER= 1.0
+CONV_NUM_METHOD_FLOW= ROE
+MUSCL_FLOW= YES
+SLOPE_LIMITER_FLOW= VENKATAKRISHNAN
+TIME_DISCRE_FLOW= EULER_EXPLICIT
+SCREEN_OUTPUT= (INNER_ITER, RMS_DENSITY)
+VOLUME_OUTPUT= (COORDINATES, SOLUTION, PRIMITIVE, RESIDUAL, LIMITER)
+WRT_PERFORMANCE= YES
+"""
+
+modes = [("plain", ""),
+         ("single", "RESTART_SINGLE_PRECISION= (PRIMITIVE, RESIDUAL, LIMITER)\n"),
+         ("compressed", "RESTART_COMPRESSION= YES\n"),
+         ("both", "RESTART_COMPRESSION= YES\nRESTART_SINGLE_PRECISION= (PRIMITIVE, RESIDUAL, LIMITER)\n")]
+
+def run(config_text, options, filename):
+
+    with open(filename, "w") as f:
+        f.write(config_text)
+
+    command = [os.path.join(os.environ.get("SU2_RUN", ""), "SU2_CFD"), filename]
+    if int(options.partitions) > 1:
+        command = ["mpirun", "-n", str(options.partitions)] + command
+
+    if os.path.exists("profiling.csv"): os.remove("profiling.csv")
+
+    proc = subprocess.Popen(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    screen = proc.communicate()[0].decode(errors="replace")
+
+    if proc.returncode != 0:
+        sys.stdout.write(screen)
+        raise RuntimeError("SU2_CFD failed for %s" % filename)
+
+    return screen
+
+def main():
+
+    parser = OptionParser()
+    parser.add_option("-s", "--size", dest="size", default="32,32,32",
+                      help="number of cells of the box in each direction", metavar="NX,NY,NZ")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of MPI ranks", metavar="PARTITIONS")
+    parser.add_option("-r", "--repeat", dest="repeat", default=3, type="int",
+                      help="number of writes and reads per format, the best read time is reported", metavar="REPEAT")
+    (options, args) = parser.parse_args()
+
+    box = config_base + "MESH_BOX_SIZE= (%s)\n" % options.size.replace(" ", "").replace(",", ", ")
+
+    results = []
+    residuals = {}
+    for mode, mode_options in modes:
+
+        # Write the restart file at every iteration, the bandwidth is averaged over the writes
+        restart = "restart_benchmark_%s" % mode
+        screen = run(box + mode_options + "ITER= %d\nOUTPUT_WRT_FREQ= 1\nOUTPUT_FILES= RESTART\n"
+                     "RESTART_FILENAME= %s\n" % (options.repeat, restart), options, "restart_benchmark_write.cfg")
+
+        nbytes = os.path.getsize(restart + ".dat")
+        bandwidth = re.findall(r"Restart Aggr\. BW \(MB/s\):\s+(\S+)", screen)
+        write = nbytes/1.0e6/float(bandwidth[-1]) if bandwidth and float(bandwidth[-1]) > 0 else None
+
+        # Restart from it
+        best_read = None
+        for i in range(options.repeat):
+            screen = run(box + "ITER= 1\nOUTPUT_FILES= NONE\nRESTART_SOL= YES\nSOLUTION_FILENAME= %s.dat\n" %
+                         restart, options, "restart_benchmark_read.cfg")
+
+            if os.path.exists("profiling.csv"):
+                with open("profiling.csv") as f:
+                    for row in csv.DictReader(f, skipinitialspace=True):
+                        if row["Function_Name"].strip() == "Read_SU2_Restart_Binary":
+                            read = float(row["Max_Time"])
+                            best_read = read if best_read is None else min(best_read, read)
+
+        residual = re.findall(r"^\|\s+0\|\s+(\S+)\|", screen, re.MULTILINE)
+        residuals[mode] = residual[-1] if residual else None
+        results.append((mode, nbytes, write, best_read))
+
+    print("\n%-12s %14s %10s %14s %14s" % ("Format", "Size [MB]", "Ratio", "Write [s]", "Read [s]"))
+    for mode, nbytes, write, read in results:
+        print("%-12s %14.2f %10.3f %14s %14s" % (mode, nbytes/1.0e6, float(nbytes)/results[0][1],
+              "%.4f" % write if write is not None else "-", "%.4f" % read if read is not None else "-"))
+
+    if results[0][3] is None:
+        print("\nNo profiling data, SU2_CFD must be compiled with -DPROFILE to report the reading time.")
+
+    if len(set(residuals.values())) != 1 or None in residuals.values():
+        print("\nThe residuals after restarting differ: %s" % residuals)
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
@@ -120,6 +120,83 @@ def main():
     bluntbody.tol       = 0.00001
     test_list.append(bluntbody)
 
+    # Rectangle, AMG preconditioner
+    rect_amg           = TestCase('rect_amg')
+    rect_amg.cfg_dir   = "euler/rectangle"
+    rect_amg.cfg_file  = "rect_amg.cfg"
+    rect_amg.test_iter = 9
+    rect_amg.test_vals = [-1.837268, 0.741128, 0.022985, 3.624387] #last 4 columns
+    rect_amg.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_amg.timeout   = 1600
+    rect_amg.tol       = 0.00001
+    test_list.append(rect_amg)
+
+    # Rectangle, pipelined GMRES
+    rect_pipelined_gmres           = TestCase('rect_pipelined_gmres')
+    rect_pipelined_gmres.cfg_dir   = "euler/rectangle"
+    rect_pipelined_gmres.cfg_file  = "rect_pipelined_gmres.cfg"
+    rect_pipelined_gmres.test_iter = 9
+    rect_pipelined_gmres.test_vals = [-1.843163, 0.740177, 0.017251, 3.621688] #last 4 columns
+    rect_pipelined_gmres.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_pipelined_gmres.timeout   = 1600
+    rect_pipelined_gmres.tol       = 0.00001
+    test_list.append(rect_pipelined_gmres)
+
+    # Rectangle, pipelined BiCGStab
+    rect_pipelined_bcgstab           = TestCase('rect_pipelined_bcgstab')
+    rect_pipelined_bcgstab.cfg_dir   = "euler/rectangle"
+    rect_pipelined_bcgstab.cfg_file  = "rect_pipelined_bcgstab.cfg"
+    rect_pipelined_bcgstab.test_iter = 9
+    rect_pipelined_bcgstab.test_vals = [-1.843186, 0.740174, 0.017210, 3.621689] #last 4 columns
+    rect_pipelined_bcgstab.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_pipelined_bcgstab.timeout   = 1600
+    rect_pipelined_bcgstab.tol       = 0.00001
+    test_list.append(rect_pipelined_bcgstab)
+
+    # Rectangle, Newton-Krylov
+    rect_newton_krylov           = TestCase('rect_newton_krylov')
+    rect_newton_krylov.cfg_dir   = "euler/rectangle"
+    rect_newton_krylov.cfg_file  = "rect_newton_krylov.cfg"
+    rect_newton_krylov.test_iter = 9
+    rect_newton_krylov.test_vals = [-2.143167, 0.462940, -1.065098, 3.297844] #last 4 columns
+    rect_newton_krylov.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_newton_krylov.timeout   = 1600
+    rect_newton_krylov.tol       = 0.00001
+    test_list.append(rect_newton_krylov)
+
+    # Rectangle, fused gradient and limiter reconstruction
+    rect_fused           = TestCase('rect_fused')
+    rect_fused.cfg_dir   = "euler/rectangle"
+    rect_fused.cfg_file  = "rect_fused.cfg"
+    rect_fused.test_iter = 9
+    rect_fused.test_vals = [-1.843163, 0.740177, 0.017251, 3.621688] #last 4 columns
+    rect_fused.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_fused.timeout   = 1600
+    rect_fused.tol       = 0.00001
+    test_list.append(rect_fused)
+
+    # Rectangle, compressed restart file (written, then read by the next case)
+    rect_compressed           = TestCase('rect_compressed')
+    rect_compressed.cfg_dir   = "euler/rectangle"
+    rect_compressed.cfg_file  = "rect_compressed.cfg"
+    rect_compressed.test_iter = 4
+    rect_compressed.test_vals = [-1.875907, 0.802163, 0.041217, 3.721534] #last 4 columns
+    rect_compressed.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_compressed.timeout   = 1600
+    rect_compressed.tol       = 0.00001
+    test_list.append(rect_compressed)
+
+    # Rectangle, restart from the compressed file
+    rect_compressed_restart           = TestCase('rect_compressed_restart')
+    rect_compressed_restart.cfg_dir   = "euler/rectangle"
+    rect_compressed_restart.cfg_file  = "rect_compressed_restart.cfg"
+    rect_compressed_restart.test_iter = 4
+    rect_compressed_restart.test_vals = [-1.843163, 0.740177, 0.017251, 3.621688] #last 4 columns
+    rect_compressed_restart.su2_exec  = "mpirun -n 2 SU2_CFD"
+    rect_compressed_restart.timeout   = 1600
+    rect_compressed_restart.tol       = 0.00001
+    test_list.append(rect_compressed_restart)
+
     ##########################
     ###  Compressible N-S  ###
     ##########################
@@ -982,6 +1059,18 @@ def main():
     bars_SST_2D.tol       = 0.00001
     bars_SST_2D.multizone = True
     test_list.append(bars_SST_2D)
+
+    # Channel with sparse RBF interpolation at the interface
+    channel_rbf           = TestCase('channel_rbf')
+    channel_rbf.cfg_dir   = "sliding_interface/channel_rbf"
+    channel_rbf.cfg_file  = "channel_rbf.cfg"
+    channel_rbf.test_iter = 14
+    channel_rbf.test_vals = [-1.937461, 3.547225, -2.401243, 3.110368] #last 4 columns
+    channel_rbf.su2_exec  = "mpirun -n 2 SU2_CFD"
+    channel_rbf.timeout   = 1600
+    channel_rbf.tol       = 0.00001
+    channel_rbf.multizone = True
+    test_list.append(channel_rbf)
     
     # Sliding mesh with incompressible flows (steady)
     slinc_steady           = TestCase('slinc_steady')
@@ -1022,6 +1111,28 @@ def main():
     statbeam3d.tol       = 0.00001
     test_list.append(statbeam3d)
 
+    # Static beam, 3d, AMG preconditioner
+    beam_amg           = TestCase('beam_amg')
+    beam_amg.cfg_dir   = "fea_fsi/StatBeam_box"
+    beam_amg.cfg_file  = "beam_amg.cfg"
+    beam_amg.test_iter = 0
+    beam_amg.test_vals = [156.000000, -7.092358, -7.024015, 2.6735e+05] #last 4 columns
+    beam_amg.su2_exec  = "mpirun -n 2 SU2_CFD"
+    beam_amg.timeout   = 1600
+    beam_amg.tol       = 0.00001
+    test_list.append(beam_amg)
+
+    # Static beam, 3d, matrix-free with Chebyshev preconditioner
+    beam_matrix_free           = TestCase('beam_matrix_free')
+    beam_matrix_free.cfg_dir   = "fea_fsi/StatBeam_box"
+    beam_matrix_free.cfg_file  = "beam_matrix_free.cfg"
+    beam_matrix_free.test_iter = 0
+    beam_matrix_free.test_vals = [325.000000, -7.728037, -7.008811, 2.6735e+05] #last 4 columns
+    beam_matrix_free.su2_exec  = "mpirun -n 2 SU2_CFD"
+    beam_matrix_free.timeout   = 1600
+    beam_matrix_free.tol       = 0.00001
+    test_list.append(beam_matrix_free)
+
     # Dynamic beam, 2d
     dynbeam2d           = TestCase('dynbeam2d')
     dynbeam2d.cfg_dir   = "fea_fsi/DynBeam_2d"
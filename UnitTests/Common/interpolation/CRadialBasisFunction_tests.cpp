@@ -0,0 +1,126 @@
+/*!
+ * \file CRadialBasisFunction_tests.cpp
+ * \brief Unit tests of the sparse (local) computation of the RBF interpolation weights.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../UnitTests.hpp"
+#include "../../../Common/include/interpolation_structure.hpp"
+
+#include <random>
+
+namespace {
+
+using Weights = vector<vector<pair<unsigned long, passivedouble> > >;
+
+/*--- Jittered n x n grid on a wavy surface (spacing 1/n), like the vertices of an interface. ---*/
+vector<passivedouble> WavySurface(unsigned long n, passivedouble shift, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<passivedouble> jitter(-0.2, 0.2);
+  const passivedouble h = 1.0 / n;
+
+  vector<passivedouble> coord;
+  for (unsigned long j = 0; j < n; ++j) {
+    for (unsigned long i = 0; i < n; ++i) {
+      const passivedouble x = (i + shift + jitter(gen))*h, y = (j + shift + jitter(gen))*h;
+      coord.insert(coord.end(), {x, y, 0.05*sin(6*x)*cos(4*y)});
+    }
+  }
+  return coord;
+}
+
+passivedouble Field(const passivedouble* x) { return sin(3*x[0])*cos(2*x[1]) + x[2]; }
+
+/*--- Interpolate the field from the centers to the targets. ---*/
+vector<passivedouble> Interpolate(const Weights& weights, const vector<passivedouble>& centers) {
+  vector<passivedouble> values(weights.size(), 0.0);
+  for (size_t iTarget = 0; iTarget < weights.size(); ++iTarget)
+    for (const auto& weight : weights[iTarget])
+      values[iTarget] += weight.second * Field(&centers[3*weight.first]);
+  return values;
+}
+
+}
+
+TEST_CASE(SparseRBFReproducesCenters) {
+
+  /*--- Targets at the centers get the values of the centers (the weights are the unit vectors). ---*/
+  const unsigned long n = 20;
+  const auto centers = WavySurface(n, 0.0, 1);
+  const passivedouble radius = 3.0 / n;
+
+  for (unsigned short nLayer : {0, 1}) {
+    Weights weights;
+    CRadialBasisFunction::Get_SparseInterpolationWeights(3, WENDLAND_C2, radius, nLayer, centers, centers, weights);
+
+    CHECK(weights.size() == n*n);
+    const auto values = Interpolate(weights, centers);
+    for (unsigned long i = 0; i < n*n; ++i) CHECK_CLOSE(values[i], Field(&centers[3*i]), 1e-9);
+  }
+}
+
+TEST_CASE(SparseRBFConvergesToGlobal) {
+
+  /*--- With enough layers all the centers are used, i.e. the result of the global interpolation.
+   *    The local approximation must converge to it quickly, and be much more accurate than the
+   *    interpolation itself already with one layer. ---*/
+  const unsigned long n = 24;
+  const auto centers = WavySurface(n, 0.0, 1);
+  const auto targets = WavySurface(n-1, 0.5, 2);
+  const passivedouble radius = 3.0 / n;
+  const unsigned long nTarget = targets.size() / 3;
+
+  Weights weights;
+  CRadialBasisFunction::Get_SparseInterpolationWeights(3, WENDLAND_C2, radius, n, centers, targets, weights);
+  const auto global = Interpolate(weights, centers);
+
+  passivedouble interpError = 0.0;
+  for (unsigned long i = 0; i < nTarget; ++i)
+    interpError = max(interpError, fabs(global[i] - Field(&targets[3*i])));
+
+  passivedouble previousDiff = 1.0;
+  size_t previousDonors = 0;
+
+  for (unsigned short nLayer : {0, 1, 2}) {
+    CRadialBasisFunction::Get_SparseInterpolationWeights(3, WENDLAND_C2, radius, nLayer, centers, targets, weights);
+    const auto local = Interpolate(weights, centers);
+
+    passivedouble diff = 0.0;
+    size_t nDonor = 0;
+    for (unsigned long i = 0; i < nTarget; ++i) {
+      diff = max(diff, fabs(local[i] - global[i]));
+      nDonor += weights[i].size();
+    }
+
+    CHECK(diff < 0.5*previousDiff);
+    if (nLayer > 0) CHECK(diff < 0.1*interpError);
+
+    /*--- The number of donors grows with the layers, with one layer it is much smaller than the centers. ---*/
+    CHECK(nDonor > previousDonors);
+    if (nLayer < 2) CHECK(nDonor < nTarget*n*n/2);
+
+    previousDiff = diff;
+    previousDonors = nDonor;
+  }
+}
@@ -0,0 +1,131 @@
+/*!
+ * \file CSysMatrixAMG_tests.cpp
+ * \brief Unit tests of the smoothed aggregation AMG preconditioner on model problems.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../UnitTests.hpp"
+#include "test_matrices.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/linear_algebra/CSysMatrixAMG.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+#include <memory>
+
+namespace {
+
+/*--- One V-cycle of the hierarchy of a CTestMatrix. ---*/
+class CTestAMGPreconditioner final : public CPreconditioner<su2double> {
+  CSysMatrixAMG<su2double> amg;
+public:
+  CTestAMGPreconditioner(const CTestMatrix& A) {
+    amg.Build(A.nVar, A.nPoint, A.row_ptr.data(), A.col_ind.data(), A.dia_ptr.data(), A.values.data(), false);
+  }
+
+  void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+    amg.Apply(&u[0], &v[0]);
+  }
+
+  const CSysMatrixAMG<su2double>& GetAMG() const { return amg; }
+};
+
+/*--- Solve A x = 1 with CG (symmetric) or FGMRES, return the number of iterations. ---*/
+template<class Precond>
+unsigned long SolveModelProblem(const CTestMatrix& A, const Precond& precond, CConfig* config, bool symmetric) {
+
+  const unsigned long nPoint = A.nPoint, nVar = A.nVar;
+  CSysVector<su2double> b(nPoint, nPoint, nVar, 1.0), x(nPoint, nPoint, nVar, 0.0);
+  CSysVector<su2double> Ax(nPoint, nPoint, nVar, 0.0);
+
+  CTestMatrixProduct product(A);
+  CSysSolve<su2double> solver;
+  su2double residual = 0.0;
+  const su2double tol = 1e-8;
+  const unsigned long maxIter = 500;
+
+  const auto iter = symmetric? solver.CG_LinSolver(b, x, product, precond, tol, maxIter, residual, false, config)
+                             : solver.FGMRES_LinSolver(b, x, product, precond, tol, maxIter, residual, false, config);
+
+  /*--- If converged, the solution must be right irrespective of the residual reported by the solver. ---*/
+  if (iter < maxIter) {
+    product(x, Ax);
+    Ax -= b;
+    CHECK(Ax.norm() <= 10*tol*b.norm());
+  }
+
+  return iter;
+}
+
+}
+
+TEST_CASE(AMGHierarchy) {
+
+  for (unsigned long nVar : {1, 3}) {
+    CTestMatrix A(64, nVar, 0.0);
+    CTestAMGPreconditioner precond(A);
+    const auto& amg = precond.GetAMG();
+
+    /*--- Several levels, each much smaller than the previous. ---*/
+    CHECK(amg.GetnLevel() > 2);
+    CHECK(amg.GetnPoint(0) == A.nPoint);
+    for (unsigned long iLevel = 1; iLevel < amg.GetnLevel(); ++iLevel)
+      CHECK(amg.GetnPoint(iLevel) < amg.GetnPoint(iLevel-1)/2);
+  }
+}
+
+TEST_CASE(AMGPoissonIterations) {
+
+  std::unique_ptr<CConfig> config(UnitTests::CreateConfig("amg_poisson", "SOLVER= EULER\n"));
+
+  /*--- The number of iterations of AMG-CG must not grow (much) with the size of the problem,
+   *    that of Jacobi-CG doubles when the grid is refined by 2. ---*/
+  for (unsigned long nVar : {1, 2}) {
+    unsigned long iterAMG[3] = {0}, iterJacobi[3] = {0}, n = 32;
+
+    for (int iSize = 0; iSize < 3; ++iSize, n *= 2) {
+      CTestMatrix A(n, nVar, 0.0);
+      iterAMG[iSize] = SolveModelProblem(A, CTestAMGPreconditioner(A), config.get(), true);
+      iterJacobi[iSize] = SolveModelProblem(A, CTestJacobiPreconditioner(A), config.get(), true);
+    }
+
+    CHECK(iterAMG[2] <= 30);
+    CHECK(iterAMG[2] <= iterAMG[0] + 8);
+    CHECK(iterJacobi[2] > 3*iterJacobi[0]);
+    CHECK(5*iterAMG[2] < iterJacobi[2]);
+  }
+}
+
+TEST_CASE(AMGConvectionDiffusion) {
+
+  std::unique_ptr<CConfig> config(UnitTests::CreateConfig("amg_convection", "SOLVER= EULER\n"));
+
+  /*--- Non-symmetric matrix (plain aggregation) with moderate and strong convection. ---*/
+  for (su2double convection : {10.0, 1000.0}) {
+    CTestMatrix A(64, 2, convection);
+    const auto iterAMG = SolveModelProblem(A, CTestAMGPreconditioner(A), config.get(), false);
+    const auto iterJacobi = SolveModelProblem(A, CTestJacobiPreconditioner(A), config.get(), false);
+    CHECK(iterAMG <= 60);
+    CHECK(iterAMG < iterJacobi);
+  }
+}
@@ -0,0 +1,145 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests of the pipelined Krylov solvers, compared with the standard implementations.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../UnitTests.hpp"
+#include "test_matrices.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+#include <memory>
+
+namespace {
+
+constexpr unsigned long MAX_ITER = 400;
+constexpr passivedouble TOL = 1e-8;
+
+enum class ESolver {FGMRES, PGMRES, BCGSTAB, PBCGSTAB};
+
+struct CResult {
+  unsigned long iter = 0;
+  su2double residual = -1.0;
+  std::vector<su2double> solution;
+};
+
+/*--- Solve A x = b, starting from x0, with a Jacobi preconditioner. ---*/
+CResult Solve(ESolver kind, const CTestMatrix& A, const std::vector<su2double>& x0, CConfig* config) {
+
+  const unsigned long nPoint = A.nPoint, nVar = A.nVar;
+
+  /*--- Smooth right hand side, that is not an eigenvector of the operator. ---*/
+  CSysVector<su2double> b(nPoint, nPoint, nVar, 0.0), x(nPoint, nPoint, nVar, x0.data());
+  for (unsigned long i = 0; i < nPoint*nVar; ++i) b[i] = 1.0 + sin(0.01*i);
+
+  CTestMatrixProduct product(A);
+  CTestJacobiPreconditioner precond(A);
+  CSysSolve<su2double> solver;
+
+  CResult result;
+  switch (kind) {
+    case ESolver::FGMRES:
+      result.iter = solver.FGMRES_LinSolver(b, x, product, precond, TOL, MAX_ITER, result.residual, false, config);
+      break;
+    case ESolver::PGMRES:
+      result.iter = solver.PGMRES_LinSolver(b, x, product, precond, TOL, MAX_ITER, result.residual, false, config);
+      break;
+    case ESolver::BCGSTAB:
+      result.iter = solver.BCGSTAB_LinSolver(b, x, product, precond, TOL, MAX_ITER, result.residual, false, config);
+      break;
+    case ESolver::PBCGSTAB:
+      result.iter = solver.PBCGSTAB_LinSolver(b, x, product, precond, TOL, MAX_ITER, result.residual, false, config);
+      break;
+  }
+
+  /*--- Check the true residual, the pipelined methods update it recursively. ---*/
+  CSysVector<su2double> r(nPoint, nPoint, nVar, 0.0);
+  product(x, r);
+  r -= b;
+  CHECK(r.norm() <= 100*TOL*b.norm());
+
+  result.solution.resize(nPoint*nVar);
+  for (unsigned long i = 0; i < nPoint*nVar; ++i) result.solution[i] = x[i];
+
+  return result;
+}
+
+su2double MaxDifference(const std::vector<su2double>& a, const std::vector<su2double>& b) {
+  su2double diff = 0.0, scale = 0.0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    diff = max(diff, fabs(a[i]-b[i]));
+    scale = max(scale, fabs(b[i]));
+  }
+  return diff / scale;
+}
+
+}
+
+TEST_CASE(PipelinedGMRES) {
+
+  std::unique_ptr<CConfig> config(UnitTests::CreateConfig("pipelined_gmres", "SOLVER= EULER\n"));
+
+  for (su2double convection : {0.0, 50.0}) {
+    CTestMatrix A(40, 2, convection);
+    const std::vector<su2double> x0(A.nPoint*A.nVar, 0.0);
+
+    const auto reference = Solve(ESolver::FGMRES, A, x0, config.get());
+    const auto pipelined = Solve(ESolver::PGMRES, A, x0, config.get());
+
+    /*--- Same Krylov space, the iterations only differ by round-off. ---*/
+    CHECK(reference.iter < MAX_ITER);
+    CHECK(pipelined.iter <= reference.iter + 2);
+    CHECK(pipelined.iter + 2 >= reference.iter);
+    CHECK(pipelined.residual < TOL);
+    CHECK(MaxDifference(pipelined.solution, reference.solution) < 1e-6);
+
+    /*--- Starting from the solution there is nothing to do, but the residual must still be set. ---*/
+    const auto restart = Solve(ESolver::PGMRES, A, pipelined.solution, config.get());
+    CHECK(restart.iter <= 1);
+    CHECK((restart.residual >= 0.0) && (restart.residual < 1.0));
+  }
+}
+
+TEST_CASE(PipelinedBiCGStab) {
+
+  std::unique_ptr<CConfig> config(UnitTests::CreateConfig("pipelined_bcgstab", "SOLVER= EULER\n"));
+
+  for (su2double convection : {0.0, 50.0}) {
+    CTestMatrix A(40, 2, convection);
+    const std::vector<su2double> x0(A.nPoint*A.nVar, 0.0);
+
+    const auto reference = Solve(ESolver::BCGSTAB, A, x0, config.get());
+    const auto pipelined = Solve(ESolver::PBCGSTAB, A, x0, config.get());
+
+    /*--- BiCGStab is more sensitive to round-off than GMRES, allow some more iterations. ---*/
+    CHECK(reference.iter < MAX_ITER);
+    CHECK(pipelined.iter <= reference.iter + reference.iter/5 + 2);
+    CHECK(MaxDifference(pipelined.solution, reference.solution) < 1e-6);
+
+    const auto restart = Solve(ESolver::PBCGSTAB, A, pipelined.solution, config.get());
+    CHECK(restart.iter <= 1);
+    CHECK((restart.residual >= 0.0) && (restart.residual < 1.0));
+  }
+}
@@ -0,0 +1,147 @@
+/*!
+ * \file test_matrices.hpp
+ * \brief Block sparse model problems for the tests of the linear solvers and preconditioners.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+#include <vector>
+
+/*!
+ * \class CTestMatrix
+ * \brief Block CSR matrix (same layout as CSysMatrix) of -lap(u) + c du/dx on an n x n grid.
+ * \note Five point stencil with first order upwinding of the convection and Dirichlet boundaries
+ *       (eliminated). Each coefficient multiplies the same nVar x nVar SPD block, hence the matrix
+ *       is SPD when c = 0, and a non-symmetric M-matrix like a flow Jacobian otherwise.
+ */
+struct CTestMatrix {
+  unsigned long nVar = 1, nPoint = 0;
+  std::vector<unsigned long> row_ptr, col_ind, dia_ptr;
+  std::vector<su2double> values;
+
+  CTestMatrix(unsigned long n, unsigned long val_nVar, su2double convection) : nVar(val_nVar), nPoint(n*n) {
+
+    const su2double h = 1.0 / (n+1);
+    const su2double diffusion = 1.0 / (h*h), upwind = convection / h;
+
+    /*--- Block of the coefficients, diagonally dominant and symmetric. ---*/
+    std::vector<su2double> block(nVar*nVar);
+    for (unsigned long i = 0; i < nVar; ++i)
+      for (unsigned long j = 0; j < nVar; ++j)
+        block[i*nVar+j] = (i == j)? 1.0 : 0.5/nVar;
+
+    row_ptr.push_back(0);
+
+    for (unsigned long iy = 0; iy < n; ++iy) {
+      for (unsigned long ix = 0; ix < n; ++ix) {
+
+        /*--- Neighbors in increasing order of column index. ---*/
+        struct { long col; su2double coeff; } entries[5] = {
+          {(iy > 0)? long((iy-1)*n+ix) : -1, -diffusion},
+          {(ix > 0)? long(iy*n+ix-1) : -1, -diffusion - upwind},
+          {long(iy*n+ix), 4*diffusion + upwind},
+          {(ix < n-1)? long(iy*n+ix+1) : -1, -diffusion},
+          {(iy < n-1)? long((iy+1)*n+ix) : -1, -diffusion}};
+
+        for (const auto& entry : entries) {
+          if (entry.col < 0) continue;
+          if (entry.col == long(iy*n+ix)) dia_ptr.push_back(col_ind.size());
+          col_ind.push_back(entry.col);
+          for (auto b : block) values.push_back(entry.coeff * b);
+        }
+        row_ptr.push_back(col_ind.size());
+      }
+    }
+  }
+
+  /*!
+   * \brief y = A x.
+   */
+  void Multiply(const su2double* x, su2double* y) const {
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      for (unsigned long iVar = 0; iVar < nVar; ++iVar) y[iPoint*nVar+iVar] = 0.0;
+      for (auto k = row_ptr[iPoint]; k < row_ptr[iPoint+1]; ++k) {
+        const su2double* block = &values[k*nVar*nVar];
+        const su2double* xj = &x[col_ind[k]*nVar];
+        for (unsigned long iVar = 0; iVar < nVar; ++iVar)
+          for (unsigned long jVar = 0; jVar < nVar; ++jVar)
+            y[iPoint*nVar+iVar] += block[iVar*nVar+jVar] * xj[jVar];
+      }
+    }
+  }
+};
+
+/*!
+ * \class CTestMatrixProduct
+ * \brief Matrix-vector product with a CTestMatrix, for CSysSolve.
+ */
+class CTestMatrixProduct final : public CMatrixVectorProduct<su2double> {
+  const CTestMatrix& matrix;
+public:
+  CTestMatrixProduct(const CTestMatrix& A) : matrix(A) {}
+
+  void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+    matrix.Multiply(&u[0], &v[0]);
+  }
+};
+
+/*!
+ * \class CTestJacobiPreconditioner
+ * \brief Point (block diagonal) Jacobi preconditioner of a CTestMatrix, whose diagonal blocks are
+ *        a multiple of the same block, i.e. they are inverted by solving a system per point.
+ */
+class CTestJacobiPreconditioner final : public CPreconditioner<su2double> {
+  const CTestMatrix& matrix;
+public:
+  CTestJacobiPreconditioner(const CTestMatrix& A) : matrix(A) {}
+
+  void operator()(const CSysVector<su2double>& u, CSysVector<su2double>& v) const override {
+    const auto nVar = matrix.nVar;
+    std::vector<su2double> a(nVar*nVar), b(nVar);
+
+    for (unsigned long iPoint = 0; iPoint < matrix.nPoint; ++iPoint) {
+      const su2double* diag = &matrix.values[matrix.dia_ptr[iPoint]*nVar*nVar];
+      a.assign(diag, diag+nVar*nVar);
+      for (unsigned long iVar = 0; iVar < nVar; ++iVar) b[iVar] = u[iPoint*nVar+iVar];
+
+      /*--- Gaussian elimination, the blocks are diagonally dominant. ---*/
+      for (unsigned long k = 0; k < nVar; ++k) {
+        for (unsigned long i = k+1; i < nVar; ++i) {
+          const su2double factor = a[i*nVar+k] / a[k*nVar+k];
+          for (unsigned long j = k; j < nVar; ++j) a[i*nVar+j] -= factor * a[k*nVar+j];
+          b[i] -= factor * b[k];
+        }
+      }
+      for (unsigned long k = nVar; k-- > 0; ) {
+        for (unsigned long j = k+1; j < nVar; ++j) b[k] -= a[k*nVar+j] * b[j];
+        b[k] /= a[k*nVar+k];
+        v[iPoint*nVar+k] = b[k];
+      }
+    }
+  }
+};
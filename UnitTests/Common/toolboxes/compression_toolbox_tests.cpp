@@ -0,0 +1,161 @@
+/*!
+ * \file compression_toolbox_tests.cpp
+ * \brief Unit tests of the byte shuffle and of the LZ4 block compression.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../UnitTests.hpp"
+#include "../../../Common/include/toolboxes/compression_toolbox.hpp"
+
+#include <cstring>
+#include <random>
+
+namespace {
+
+using Bytes = std::vector<uint8_t>;
+
+/*--- Compress with enough space for incompressible data, decompress, and compare. ---*/
+size_t RoundTrip(const Bytes& data) {
+
+  Bytes compressed(data.size() + data.size()/255 + 16);
+  const size_t compressedSize = CompressionToolbox::LZ4Compress(data.data(), data.size(),
+                                                                compressed.data(), compressed.size());
+  CHECK(compressedSize > 0);
+
+  Bytes decompressed(data.size());
+  CHECK(CompressionToolbox::LZ4Decompress(compressed.data(), compressedSize, decompressed.data(), data.size()));
+  CHECK(decompressed == data);
+
+  return compressedSize;
+}
+
+/*--- Bytes of a smooth field of doubles, like the solution of a restart file. ---*/
+Bytes SmoothField(size_t nValue) {
+  std::vector<double> values(nValue);
+  for (size_t i = 0; i < nValue; ++i) values[i] = 101325.0 * (1.0 + 0.1*sin(0.001*i));
+  Bytes bytes(nValue*sizeof(double));
+  memcpy(bytes.data(), values.data(), bytes.size());
+  return bytes;
+}
+
+}
+
+TEST_CASE(ByteShuffleRoundTrip) {
+
+  for (size_t elemSize : {1, 4, 8}) {
+    const size_t nElem = 1001;
+    Bytes data(nElem*elemSize), shuffled(data.size()), restored(data.size());
+    for (size_t i = 0; i < data.size(); ++i) data[i] = uint8_t(i*7 + i/elemSize);
+
+    CompressionToolbox::ByteShuffle(data.data(), nElem, elemSize, shuffled.data());
+    CompressionToolbox::ByteUnshuffle(shuffled.data(), nElem, elemSize, restored.data());
+    CHECK(restored == data);
+
+    /*--- Byte 0 of element 1 is the second shuffled byte. ---*/
+    CHECK(shuffled[1] == data[elemSize]);
+  }
+}
+
+TEST_CASE(LZ4RoundTrip) {
+
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> byte(0, 255);
+
+  /*--- Sizes around the limits of the format (min. match, last literals, 15 and 255 length codes). ---*/
+  for (size_t size : {1, 4, 5, 12, 13, 20, 64, 270, 300, 4096, 100000}) {
+
+    Bytes random(size), zeros(size, 0), pattern(size);
+    for (size_t i = 0; i < size; ++i) {
+      random[i] = uint8_t(byte(gen));
+      pattern[i] = uint8_t("abcdefg"[i % 7]);
+    }
+
+    RoundTrip(random);
+    const auto zerosSize = RoundTrip(zeros);
+    const auto patternSize = RoundTrip(pattern);
+
+    /*--- Long runs (overlapping matches) must compress as much as the format allows, i.e. one
+     *    byte per 255 of match length, plus the token, offset, first and last literals. ---*/
+    CHECK(zerosSize <= size/255 + 20);
+    CHECK(patternSize <= size/255 + 20);
+  }
+
+  /*--- Long literal run followed by long matches, then literals again. ---*/
+  Bytes mixed(5000);
+  for (size_t i = 0; i < mixed.size(); ++i)
+    mixed[i] = (i < 1000 || i > 4000)? uint8_t(byte(gen)) : uint8_t(i % 3);
+  RoundTrip(mixed);
+}
+
+TEST_CASE(LZ4Incompressible) {
+
+  /*--- The writer requires compressed blocks to be smaller than the raw ones, LZ4Compress must
+   *    return 0 when the output does not fit instead of writing past the end of the buffer. ---*/
+  std::mt19937 gen(3);
+  std::uniform_int_distribution<int> byte(0, 255);
+
+  Bytes random(10000);
+  for (auto& b : random) b = uint8_t(byte(gen));
+
+  Bytes compressed(random.size() + 64, 0xAB);
+  const size_t capacity = random.size() - 1;
+  CHECK(CompressionToolbox::LZ4Compress(random.data(), random.size(), compressed.data(), capacity) == 0);
+  for (size_t i = capacity; i < compressed.size(); ++i) CHECK(compressed[i] == 0xAB);
+}
+
+TEST_CASE(LZ4ShuffledDoubles) {
+
+  /*--- Shuffling smooth floating point data makes it compressible. ---*/
+  const size_t nValue = 16384;
+  const auto data = SmoothField(nValue);
+
+  Bytes shuffled(data.size());
+  CompressionToolbox::ByteShuffle(data.data(), nValue, sizeof(double), shuffled.data());
+
+  const auto plainSize = RoundTrip(data);
+  const auto shuffledSize = RoundTrip(shuffled);
+  CHECK(shuffledSize < plainSize);
+  CHECK(shuffledSize < 3*data.size()/4);
+}
+
+TEST_CASE(LZ4DecodeReferenceBlock) {
+
+  /*--- Block in the standard format: 1 literal 'a', match (offset 1, length 10), and the last
+   *    sequence of 5 literals 'b'. This checks the compatibility with other LZ4 implementations. ---*/
+  const Bytes block = {0x16, 'a', 0x01, 0x00, 0x50, 'b', 'b', 'b', 'b', 'b'};
+  const std::string expected = std::string(11, 'a') + std::string(5, 'b');
+
+  Bytes decoded(expected.size());
+  CHECK(CompressionToolbox::LZ4Decompress(block.data(), block.size(), decoded.data(), decoded.size()));
+  CHECK(std::string(decoded.begin(), decoded.end()) == expected);
+
+  /*--- Corrupted blocks are rejected: wrong size, truncated, offset before the start. ---*/
+  Bytes buffer(64);
+  CHECK(!CompressionToolbox::LZ4Decompress(block.data(), block.size(), buffer.data(), expected.size()+1));
+  CHECK(!CompressionToolbox::LZ4Decompress(block.data(), 3, buffer.data(), expected.size()));
+
+  Bytes badOffset = block;
+  badOffset[2] = 0x02;
+  CHECK(!CompressionToolbox::LZ4Decompress(badOffset.data(), badOffset.size(), buffer.data(), expected.size()));
+}
@@ -0,0 +1,139 @@
+/*!
+ * \file CEdgeBatch_tests.cpp
+ * \brief Unit tests of the batched upwind fluxes, compared with the scalar (per-lane) implementation.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../UnitTests.hpp"
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/roe.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/hllc.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/ausm_slau.hpp"
+
+#include <memory>
+#include <random>
+
+namespace {
+
+constexpr auto W = CEdgeBatch::WIDTH;
+
+/*--- Random states around sonic conditions (subsonic and supersonic, all flow directions),
+ *    the primitives of the batch are T, velocity, p, rho, h of an ideal gas. ---*/
+void FillBatch(unsigned short nDim, su2double gamma, su2double gasConstant, std::mt19937& gen, CEdgeBatch& batch) {
+
+  std::uniform_real_distribution<double> normal(-1.0, 1.0), density(0.5, 1.5),
+                                         pressure(0.5, 1.0), velocity(-1.5, 1.5);
+
+  batch.nLane = W;
+
+  for (size_t k = 0; k < W; ++k) {
+    batch.iEdge[k] = batch.iPoint[k] = batch.jPoint[k] = k;
+
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+      batch.Normal[iDim][k] = normal(gen);
+
+    for (auto V : {batch.V_i, batch.V_j}) {
+      su2double sqVel = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+        V[iDim+1][k] = velocity(gen);
+        sqVel += pow(V[iDim+1][k], 2);
+      }
+      const su2double p = pressure(gen), rho = density(gen);
+      V[0][k] = p / (rho*gasConstant);
+      V[nDim+1][k] = p;
+      V[nDim+2][k] = rho;
+      V[nDim+3][k] = gamma/(gamma-1) * p/rho + 0.5*sqVel;
+    }
+  }
+}
+
+/*--- Compare the batched kernel of the numerics with the default per-lane implementation. ---*/
+void CompareWithScalar(CNumerics& numerics, unsigned short nDim, bool implicit, const CConfig* config) {
+
+  const unsigned short nVar = nDim+2;
+  std::mt19937 gen(42);
+
+  for (int iTest = 0; iTest < 100; ++iTest) {
+
+    CEdgeBatch batch, reference;
+    FillBatch(nDim, config->GetGamma(), config->GetGas_Constant(), gen, batch);
+
+    /*--- Partially filled batches are padded by the solver. ---*/
+    if (iTest % 10 == 0) {
+      batch.nLane = 1 + iTest % W;
+      batch.PadLanes(nDim, nDim+4);
+    }
+    reference = batch;
+
+    numerics.ComputeResidualBatch(batch, config);
+    numerics.CNumerics::ComputeResidualBatch(reference, config);
+
+    for (unsigned short k = 0; k < batch.nLane; ++k) {
+      for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+        CHECK_CLOSE(batch.Flux[iVar][k], reference.Flux[iVar][k], 1e-12*(1.0+fabs(reference.Flux[iVar][k])));
+        if (!implicit) continue;
+        for (unsigned short jVar = 0; jVar < nVar; ++jVar) {
+          const su2double jac_i = reference.Jacobian_i[iVar][jVar][k], jac_j = reference.Jacobian_j[iVar][jVar][k];
+          CHECK_CLOSE(batch.Jacobian_i[iVar][jVar][k], jac_i, 1e-12*(1.0+fabs(jac_i)));
+          CHECK_CLOSE(batch.Jacobian_j[iVar][jVar][k], jac_j, 1e-12*(1.0+fabs(jac_j)));
+        }
+      }
+    }
+  }
+}
+
+const char* ConfigOptions(bool implicit) {
+  return implicit? "SOLVER= EULER\nTIME_DISCRE_FLOW= EULER_IMPLICIT\n" : "SOLVER= EULER\nTIME_DISCRE_FLOW= EULER_EXPLICIT\n";
+}
+
+}
+
+TEST_CASE(EdgeBatchRoe) {
+  for (bool implicit : {false, true}) {
+    std::unique_ptr<CConfig> config(UnitTests::CreateConfig("edge_batch_roe", ConfigOptions(implicit)));
+    for (unsigned short nDim : {2, 3}) {
+      CUpwRoe_Flow numerics(nDim, nDim+2, config.get(), false);
+      CompareWithScalar(numerics, nDim, implicit, config.get());
+    }
+  }
+}
+
+TEST_CASE(EdgeBatchHLLC) {
+  /*--- Implicit HLLC falls back to the per-lane implementation. ---*/
+  std::unique_ptr<CConfig> config(UnitTests::CreateConfig("edge_batch_hllc", ConfigOptions(false)));
+  for (unsigned short nDim : {2, 3}) {
+    CUpwHLLC_Flow numerics(nDim, nDim+2, config.get());
+    CompareWithScalar(numerics, nDim, false, config.get());
+  }
+}
+
+TEST_CASE(EdgeBatchAUSM) {
+  for (bool implicit : {false, true}) {
+    std::unique_ptr<CConfig> config(UnitTests::CreateConfig("edge_batch_ausm", ConfigOptions(implicit)));
+    for (unsigned short nDim : {2, 3}) {
+      CUpwAUSM_Flow numerics(nDim, nDim+2, config.get());
+      CompareWithScalar(numerics, nDim, implicit, config.get());
+    }
+  }
+}
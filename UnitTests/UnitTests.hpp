@@ -0,0 +1,112 @@
+/*!
+ * \file UnitTests.hpp
+ * \brief Minimal framework for the unit tests (test registry and checks).
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <sstream>
+
+class CConfig;
+
+/*!
+ * \namespace UnitTests
+ * \brief Registry of the test cases and helpers used by the checks, see test_driver.cpp.
+ * \note A test case is a function defined with TEST_CASE, it passes if none of its checks fail.
+ *       The tests are linked with the objects of SU2_CFD and run on one rank (see UnitTests/meson.build).
+ */
+namespace UnitTests {
+
+/*!
+ * \brief Name and function of a test case.
+ */
+struct CTestCase {
+  const char* name;
+  void (*function)();
+};
+
+/*!
+ * \brief Get the test cases defined by all the translation units.
+ */
+std::vector<CTestCase>& GetRegistry();
+
+/*!
+ * \brief Adds a test case to the registry during static initialization.
+ */
+struct CRegistrar {
+  CRegistrar(const char* name, void (*function)()) { GetRegistry().push_back({name, function}); }
+};
+
+/*!
+ * \brief Record a failed check of the current test case.
+ * \param[in] file - Source file of the check.
+ * \param[in] line - Line of the check.
+ * \param[in] message - Description of the failure.
+ */
+void Fail(const char* file, int line, const std::string& message);
+
+/*!
+ * \brief Create a config from the text of a config file (e.g. "SOLVER= EULER\n...").
+ * \note The options are written to a temporary file in the working directory, which is removed.
+ * \param[in] name - Name of the temporary file (without extension).
+ * \param[in] options - Config options.
+ * \return New config object (owned by the caller).
+ */
+CConfig* CreateConfig(const std::string& name, const std::string& options);
+
+}
+
+/*!
+ * \brief Define and register a test case, e.g. TEST_CASE(LZ4RoundTrip) { CHECK(...); }
+ */
+#define TEST_CASE(NAME)                                                \
+  static void NAME();                                                  \
+  static UnitTests::CRegistrar NAME##_registrar(#NAME, NAME);          \
+  static void NAME()
+
+/*!
+ * \brief Check that a condition is true.
+ */
+#define CHECK(COND)                                                    \
+  do {                                                                 \
+    if (!(COND)) UnitTests::Fail(__FILE__, __LINE__, #COND);           \
+  } while (0)
+
+/*!
+ * \brief Check that |A-B| <= TOL.
+ */
+#define CHECK_CLOSE(A, B, TOL)                                         \
+  do {                                                                 \
+    const double a_ = (A), b_ = (B);                                   \
+    if (!(std::abs(a_-b_) <= (TOL))) {                                 \
+      std::ostringstream msg_;                                         \
+      msg_ << #A << " = " << a_ << ", " << #B << " = " << b_           \
+           << ", tolerance " << (TOL);                                 \
+      UnitTests::Fail(__FILE__, __LINE__, msg_.str());                 \
+    }                                                                  \
+  } while (0)
@@ -0,0 +1,115 @@
+/*!
+ * \file test_driver.cpp
+ * \brief Runs the unit tests, optionally only those whose name contains the given filters.
+ * \author SU2 Contributors
+ * \version 7.0.2 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UnitTests.hpp"
+#include "../Common/include/mpi_structure.hpp"
+#include "../Common/include/CConfig.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace UnitTests {
+
+namespace {
+unsigned long nFailedChecks = 0;
+}
+
+std::vector<CTestCase>& GetRegistry() {
+  static std::vector<CTestCase> registry;
+  return registry;
+}
+
+void Fail(const char* file, int line, const std::string& message) {
+  std::cout << "  " << file << ":" << line << ": check failed: " << message << std::endl;
+  nFailedChecks++;
+}
+
+CConfig* CreateConfig(const std::string& name, const std::string& options) {
+
+  const std::string filename = name + ".cfg";
+  {
+    std::ofstream file(filename);
+    file << options << std::endl;
+  }
+
+  char config_file_name[MAX_STRING_SIZE];
+  strncpy(config_file_name, filename.c_str(), MAX_STRING_SIZE-1);
+  config_file_name[MAX_STRING_SIZE-1] = '\0';
+
+  /*--- The config output is only printed with verbose mode. ---*/
+  auto config = new CConfig(config_file_name, SU2_CFD, false);
+
+  std::remove(filename.c_str());
+
+  return config;
+}
+
+}
+
+int main(int argc, char *argv[]) {
+
+#ifdef HAVE_MPI
+  SU2_MPI::Init(&argc, &argv);
+  SU2_Comm MPICommunicator(MPI_COMM_WORLD);
+#else
+  SU2_Comm MPICommunicator(0);
+#endif
+  SU2_MPI::SetComm(MPICommunicator);
+
+  /*--- Run the tests whose name contains any of the arguments (all if none is given). ---*/
+
+  unsigned long nTest = 0, nFailedTest = 0;
+
+  for (const auto& test : UnitTests::GetRegistry()) {
+
+    bool selected = (argc < 2);
+    for (int iArg = 1; iArg < argc; iArg++)
+      selected |= (std::string(test.name).find(argv[iArg]) != std::string::npos);
+    if (!selected) continue;
+
+    std::cout << "Running " << test.name << std::endl;
+
+    const auto nFailedBefore = UnitTests::nFailedChecks;
+    test.function();
+
+    nTest++;
+    if (UnitTests::nFailedChecks != nFailedBefore) {
+      std::cout << "FAILED " << test.name << std::endl;
+      nFailedTest++;
+    }
+  }
+
+  std::cout << "\n" << nTest-nFailedTest << " of " << nTest << " tests passed." << std::endl;
+
+#ifdef HAVE_MPI
+  SU2_MPI::Finalize();
+#endif
+
+  return (nFailedTest || !nTest)? 1 : 0;
+}